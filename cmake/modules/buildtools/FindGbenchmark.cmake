@@ -0,0 +1,52 @@
+#.rst:
+# FindGbenchmark
+# --------------
+# Finds the Google Benchmark library
+#
+# This will define the following variables::
+#
+# GBENCHMARK_FOUND - system has benchmark
+# GBENCHMARK_INCLUDE_DIRS - the benchmark include directories
+# GBENCHMARK_LIBRARIES - the benchmark libraries
+#
+# and the following imported targets:
+#
+#   Gbenchmark::Gbenchmark   - The benchmark library
+
+find_package(PkgConfig ${SEARCH_QUIET})
+if(PKG_CONFIG_FOUND)
+  pkg_check_modules(PC_GBENCHMARK benchmark ${SEARCH_QUIET})
+  set(GBENCHMARK_VERSION ${PC_GBENCHMARK_VERSION})
+endif()
+
+find_path(GBENCHMARK_INCLUDE_DIR NAMES benchmark/benchmark.h
+                                 HINTS ${PC_GBENCHMARK_INCLUDEDIR})
+
+find_library(GBENCHMARK_LIBRARY_RELEASE NAMES benchmark
+                                        HINTS ${PC_GBENCHMARK_LIBDIR})
+find_library(GBENCHMARK_LIBRARY_DEBUG NAMES benchmarkd
+                                      HINTS ${PC_GBENCHMARK_LIBDIR})
+
+include(SelectLibraryConfigurations)
+select_library_configurations(GBENCHMARK)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Gbenchmark
+                                  REQUIRED_VARS GBENCHMARK_LIBRARY GBENCHMARK_INCLUDE_DIR
+                                  VERSION_VAR GBENCHMARK_VERSION)
+
+if(GBENCHMARK_FOUND)
+  set(GBENCHMARK_LIBRARIES ${GBENCHMARK_LIBRARY})
+  set(GBENCHMARK_INCLUDE_DIRS ${GBENCHMARK_INCLUDE_DIR})
+
+  if(NOT TARGET Gbenchmark::Gbenchmark)
+    find_package(Threads REQUIRED ${SEARCH_QUIET})
+    add_library(Gbenchmark::Gbenchmark UNKNOWN IMPORTED)
+    set_target_properties(Gbenchmark::Gbenchmark PROPERTIES
+                                                 IMPORTED_LOCATION "${GBENCHMARK_LIBRARY}"
+                                                 INTERFACE_INCLUDE_DIRECTORIES "${GBENCHMARK_INCLUDE_DIR}"
+                                                 INTERFACE_LINK_LIBRARIES Threads::Threads)
+  endif()
+endif()
+
+mark_as_advanced(GBENCHMARK_INCLUDE_DIR GBENCHMARK_LIBRARY)
@@ -117,6 +117,18 @@ function(core_add_test_library name)
   endforeach()
 endfunction()
 
+# Add benchmark sources to the list for the kodi-bench executable
+# Arguments:
+#   name name of the benchmark set
+# Implicit arguments:
+#   BENCH_SOURCES the sources of the benchmarks
+function(core_add_bench_library name)
+  foreach(src IN LISTS BENCH_SOURCES)
+    get_filename_component(src_path "${src}" ABSOLUTE)
+    set(bench_sources "${src_path}" ${bench_sources} CACHE STRING "" FORCE)
+  endforeach()
+endfunction()
+
 # Add addon dev kit headers to main application
 # Arguments:
 #   name name of the header part to add
@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "TextureDatabase.h"
 #include "addons/AddonDatabase.h"
+#include "dbwrappers/DatabaseReaderPool.h"
 #include "music/MusicDatabase.h"
 #include "pvr/PVRDatabase.h"
 #include "pvr/epg/EpgDatabase.h"
@@ -41,6 +42,9 @@ bool CDatabaseManager::Initialize()
 
   m_dbStatus.clear();
 
+  // readers of the previous profile or of databases about to be updated
+  CDatabaseReaderPool::GetInstance().Clear();
+
   CLog::Log(LOGDEBUG, "{}, updating databases...", __FUNCTION__);
 
   const std::shared_ptr<CAdvancedSettings> advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
@@ -351,26 +351,25 @@ void CFileItemList::Sort(SortDescription sortDescription)
         static_cast<SortAttribute>(sortDescription.sortAttributes | SortAttributeIgnoreFolders);
   }
 
-  const Fields fields = SortUtils::GetFieldsForSorting(sortDescription.sortBy);
-  SortItems sortItems(static_cast<size_t>(Size()));
-  for (int index = 0; index < Size(); index++)
-  {
-    sortItems[index] = std::make_shared<SortItem>();
-    m_items[index]->ToSortable(*sortItems[index], fields);
-    (*sortItems[index])[FieldId] = index;
-  }
-
-  // do the sorting
-  SortUtils::Sort(sortDescription, sortItems);
+  // only the sort keys are extracted, the items are reordered once at the end
+  const Fields& fields = SortUtils::GetFieldsForSorting(sortDescription.sortBy);
+  const SortUtils::SortedIndices sorted =
+      SortUtils::SortIndices(sortDescription, m_items.size(),
+                             [this, &fields](size_t index, SortItem& scratch) -> SortItem&
+                             {
+                               m_items[index]->ToSortable(scratch, fields);
+                               scratch[FieldId] = static_cast<int64_t>(index);
+                               return scratch;
+                             });
 
   // apply the new order to the existing CFileItems
   std::vector<std::shared_ptr<CFileItem>> sortedFileItems;
-  sortedFileItems.reserve(Size());
-  for (const auto& sortItem : sortItems)
+  sortedFileItems.reserve(sorted.order.size());
+  for (size_t index : sorted.order)
   {
-    std::shared_ptr<CFileItem> item = m_items[static_cast<int>(sortItem->at(FieldId).asInteger())];
+    std::shared_ptr<CFileItem>& item = m_items[index];
     // Set the sort label in the CFileItem
-    item->SetSortLabel(sortItem->at(FieldSort).asWideString());
+    item->SetSortLabel(std::wstring(sorted.GetSortLabel(index)));
 
     sortedFileItems.emplace_back(std::move(item));
   }
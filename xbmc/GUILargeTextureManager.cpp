@@ -148,7 +148,8 @@ bool CGUILargeTextureManager::CLargeTexture::DeleteIfRequired(bool deleteImmedia
   return false;
 }
 
-void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture> texture)
+void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture> texture,
+                                                         bool uploadPending)
 {
   assert(!m_texture.size());
   if (texture)
@@ -156,9 +157,21 @@ void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture
     const auto width = texture->GetWidth();
     const auto height = texture->GetHeight();
     m_texture.Set(std::move(texture), width, height);
+    m_uploadPending = uploadPending;
   }
 }
 
+bool CGUILargeTextureManager::CLargeTexture::Upload()
+{
+  // nobody is waiting for it, it is uploaded on first use if it gets requested again
+  if (m_refCount == 0)
+    return false;
+
+  m_texture.m_textures[0]->LoadToGPU();
+  m_uploadPending = false;
+  return true;
+}
+
 CGUILargeTextureManager::CGUILargeTextureManager() = default;
 
 CGUILargeTextureManager::~CGUILargeTextureManager() = default;
@@ -197,6 +210,8 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
     {
       if (firstRequest)
         image->AddRef();
+      if (image->IsUploadPending())
+        return true; // not ready as yet
       texture = image->GetTexture();
       return texture.size() > 0;
     }
@@ -281,7 +296,13 @@ void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJ
     { // found our job
       CImageLoader *loader = static_cast<CImageLoader*>(job);
       CLargeTexture *image = it->second;
-      image->SetTexture(std::move(loader->m_texture));
+      // unless it was uploaded through a shared context already, the upload is left to
+      // ProcessUploads() so it doesn't happen on first draw together with all other new images
+      const bool uploadPending =
+          loader->m_texture && !loader->m_texture->IsLoadedToGPU() &&
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiTextureUploadBudget >
+              0;
+      image->SetTexture(std::move(loader->m_texture), uploadPending);
       loader->m_texture = NULL; // we want to keep the texture, and jobs are auto-deleted.
       m_queued.erase(it);
       m_allocated.push_back(image);
@@ -289,3 +310,46 @@ void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJ
     }
   }
 }
+
+void CGUILargeTextureManager::ProcessUploads()
+{
+  const std::chrono::milliseconds budget{
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiTextureUploadBudget};
+
+  std::unique_lock lock(m_listSection);
+  const auto start = std::chrono::steady_clock::now();
+  auto now = start;
+  bool uploaded = false;
+  // oldest first, m_allocated is in order of completion
+  for (CLargeTexture* image : m_allocated)
+  {
+    if (!image->IsUploadPending())
+      continue;
+
+    if (uploaded && now - start >= budget)
+      break;
+
+    if (image->Upload())
+    {
+      m_uploaded++;
+      uploaded = true;
+      now = std::chrono::steady_clock::now();
+    }
+  }
+  m_lastUploadTime = std::chrono::duration_cast<std::chrono::microseconds>(now - start);
+}
+
+CGUILargeTextureManager::UploadStats CGUILargeTextureManager::GetUploadStats() const
+{
+  std::unique_lock lock(m_listSection);
+  UploadStats stats;
+  stats.loading = m_queued.size();
+  for (const CLargeTexture* image : m_allocated)
+  {
+    if (image->IsUploadPending())
+      stats.pending++;
+  }
+  stats.lastFrame = m_lastUploadTime;
+  stats.uploaded = m_uploaded;
+  return stats;
+}
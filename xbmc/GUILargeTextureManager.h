@@ -13,6 +13,9 @@
 #include "threads/CriticalSection.h"
 #include "utils/Job.h"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -65,6 +68,14 @@ private:
 class CGUILargeTextureManager : public IJobCallback
 {
 public:
+  struct UploadStats
+  {
+    size_t loading{0}; //!< images queued for or being decoded
+    size_t pending{0}; //!< decoded images waiting to be uploaded
+    std::chrono::microseconds lastFrame{0}; //!< upload time spent in the last frame
+    uint64_t uploaded{0}; //!< images uploaded so far
+  };
+
   CGUILargeTextureManager();
   ~CGUILargeTextureManager() override;
 
@@ -131,6 +142,18 @@ public:
    */
   void CleanupUnusedImages(bool immediately = false);
 
+  /*!
+   \brief Upload decoded images to the GPU, called from the render thread once per frame.
+
+   Images finished by CImageLoader are only handed out to controls after they have been uploaded
+   here, which keeps the cost of a burst of images (e.g. scrolling a wall of posters) within the
+   per frame budget set by the advanced setting gui/textureuploadbudget. At least one image is
+   uploaded per frame so the queue always drains.
+   */
+  void ProcessUploads();
+
+  UploadStats GetUploadStats() const;
+
 private:
   class CLargeTexture
   {
@@ -144,7 +167,9 @@ private:
     void AddRef();
     bool DecrRef(bool deleteImmediately);
     bool DeleteIfRequired(bool deleteImmediately = false);
-    void SetTexture(std::unique_ptr<CTexture> texture);
+    void SetTexture(std::unique_ptr<CTexture> texture, bool uploadPending);
+    bool IsUploadPending() const { return m_uploadPending; }
+    bool Upload();
 
     const std::string& GetPath() const { return m_path; }
     const CTextureArray& GetTexture() const { return m_texture; }
@@ -162,6 +187,7 @@ private:
     unsigned int m_targetHeight;
     CAspectRatio::AspectRatio m_aspectRatio;
     unsigned int m_timeToDelete;
+    bool m_uploadPending{false};
   };
 
   void QueueImage(const std::string& path,
@@ -175,6 +201,9 @@ private:
   typedef std::vector<CLargeTexture *>::iterator listIterator;
   typedef std::vector< std::pair<unsigned int, CLargeTexture *> >::iterator queueIterator;
 
-  CCriticalSection m_listSection;
+  mutable CCriticalSection m_listSection;
+
+  std::chrono::microseconds m_lastUploadTime{0};
+  uint64_t m_uploaded{0};
 };
 
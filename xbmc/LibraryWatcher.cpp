@@ -0,0 +1,326 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LibraryWatcher.h"
+
+#include "ServiceBroker.h"
+#include "filesystem/SpecialProtocol.h"
+#include "interfaces/AnnouncementManager.h"
+#include "music/MusicDatabase.h"
+#include "music/MusicLibraryQueue.h"
+#include "music/infoscanner/MusicInfoScanner.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+#include "video/VideoDatabase.h"
+#include "video/VideoLibraryQueue.h"
+
+#include <algorithm>
+#include <mutex>
+#include <ranges>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+//! How long a directory has to be quiet before it is scanned
+constexpr auto SETTLE_TIME = 2s;
+
+//! More changed directories than this are handled by a full library update
+constexpr size_t MAX_CHANGED_DIRECTORIES = 1000;
+
+//! Keep only the paths that are not below another path of the set
+template<typename Container>
+std::vector<std::string> GetTopLevelPaths(const Container& paths)
+{
+  // paths sharing a prefix are adjacent in an ordered set
+  std::vector<std::string> topLevel;
+  for (const auto& path : paths)
+  {
+    if (topLevel.empty() || !StringUtils::StartsWith(path, topLevel.back()))
+      topLevel.push_back(path);
+  }
+  return topLevel;
+}
+} // namespace
+
+CLibraryWatcher& CLibraryWatcher::GetInstance()
+{
+  static CLibraryWatcher s_instance;
+  return s_instance;
+}
+
+CLibraryWatcher::CLibraryWatcher() : CThread("LibraryWatcher")
+{
+}
+
+CLibraryWatcher::~CLibraryWatcher()
+{
+  Stop();
+}
+
+void CLibraryWatcher::Start()
+{
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  unsigned int libraries = 0;
+  if (advancedSettings->m_videoLibraryWatchSources)
+    libraries |= LIBRARY_VIDEO;
+  if (advancedSettings->m_musicLibraryWatchSources)
+    libraries |= LIBRARY_MUSIC;
+
+  if (libraries == 0)
+  {
+    Stop();
+    return;
+  }
+
+  {
+    std::unique_lock lock(m_section);
+    m_libraries = libraries;
+    m_refresh = true;
+  }
+
+  if (!IsRunning())
+  {
+    CServiceBroker::GetAnnouncementManager()->AddAnnouncer(
+        this, ANNOUNCEMENT::VideoLibrary | ANNOUNCEMENT::AudioLibrary);
+    Create();
+  }
+  m_wakeup.Set();
+}
+
+void CLibraryWatcher::Stop()
+{
+  if (!IsRunning())
+    return;
+
+  const auto announcementManager = CServiceBroker::GetAnnouncementManager();
+  if (announcementManager)
+    announcementManager->RemoveAnnouncer(this);
+
+  m_bStop = true;
+  m_wakeup.Set();
+  StopThread();
+
+  std::unique_lock lock(m_section);
+  m_changed.clear();
+  m_overflow = false;
+}
+
+void CLibraryWatcher::OnDirectoryChanged(const std::string& directory)
+{
+  std::unique_lock lock(m_section);
+  if (m_overflow)
+    return;
+
+  m_changed[directory] = std::chrono::steady_clock::now();
+  if (m_changed.size() > MAX_CHANGED_DIRECTORIES)
+  {
+    m_overflow = true;
+    m_changed.clear();
+    m_wakeup.Set();
+  }
+}
+
+void CLibraryWatcher::OnWatchOverflow()
+{
+  std::unique_lock lock(m_section);
+  m_overflow = true;
+  m_changed.clear();
+  m_wakeup.Set();
+}
+
+void CLibraryWatcher::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                               const std::string& sender,
+                               const std::string& message,
+                               const CVariant& data)
+{
+  // scans and cleans add and remove library paths
+  if (message == "OnScanFinished" || message == "OnCleanFinished")
+  {
+    std::unique_lock lock(m_section);
+    m_refresh = true;
+    m_wakeup.Set();
+  }
+}
+
+void CLibraryWatcher::Process()
+{
+  m_watcher = XFILE::IDirectoryWatcher::CreateInstance(*this);
+  if (!m_watcher)
+  {
+    CLog::Log(LOGINFO, "LibraryWatcher: Watching sources is not supported on this platform");
+    return;
+  }
+
+  while (!m_bStop)
+  {
+    unsigned int libraries = 0;
+    bool refresh = false;
+    bool overflow = false;
+    {
+      std::unique_lock lock(m_section);
+      libraries = m_libraries;
+      std::swap(refresh, m_refresh);
+      std::swap(overflow, m_overflow);
+    }
+
+    if (refresh)
+      UpdateWatches(libraries);
+
+    if (overflow)
+    {
+      CLog::Log(LOGINFO, "LibraryWatcher: Too many changes, updating the whole library");
+      ScanLibraries(libraries);
+    }
+
+    m_wakeup.Wait(ScanSettledChanges());
+  }
+
+  m_watcher.reset();
+  m_watched.clear();
+  m_roots.clear();
+  m_videoPaths.clear();
+}
+
+void CLibraryWatcher::UpdateWatches(unsigned int libraries)
+{
+  m_roots.clear();
+  m_videoPaths.clear();
+
+  if (libraries & LIBRARY_VIDEO)
+  {
+    CVideoDatabase database;
+    if (database.Open())
+    {
+      database.GetPaths(m_videoPaths);
+      database.Close();
+    }
+    AddRoots(m_videoPaths, LIBRARY_VIDEO);
+  }
+
+  if (libraries & LIBRARY_MUSIC)
+  {
+    CMusicDatabase database;
+    std::set<std::string, std::less<>> paths;
+    if (database.Open())
+    {
+      database.GetPaths(paths);
+      database.Close();
+    }
+    AddRoots(paths, LIBRARY_MUSIC);
+  }
+
+  std::set<std::string> watch;
+  for (auto& root : GetTopLevelPaths(m_roots | std::views::keys))
+    watch.insert(std::move(root));
+
+  for (const auto& path : m_watched)
+  {
+    if (!watch.contains(path))
+      m_watcher->RemoveTree(path);
+  }
+
+  for (const auto& path : watch)
+  {
+    if (!m_watched.contains(path) && !m_watcher->AddTree(path))
+      CLog::Log(LOGWARNING, "LibraryWatcher: Changes below '{}' may be missed", path);
+  }
+
+  m_watched = std::move(watch);
+  CLog::Log(LOGDEBUG, "LibraryWatcher: Watching {} local source(s)", m_watched.size());
+}
+
+void CLibraryWatcher::AddRoots(const std::set<std::string, std::less<>>& paths, Library library)
+{
+  for (const auto& path : GetTopLevelPaths(paths))
+  {
+    // only local sources can be watched, network shares report no changes made by other hosts
+    std::string nativePath = CSpecialProtocol::TranslatePath(path);
+    URIUtils::AddSlashAtEnd(nativePath);
+    if (!URIUtils::IsHD(nativePath) || !StringUtils::StartsWith(nativePath, "/"))
+      continue;
+
+    Root& root = m_roots[nativePath];
+    root.path = path;
+    root.libraries |= library;
+  }
+}
+
+std::chrono::steady_clock::duration CLibraryWatcher::ScanSettledChanges()
+{
+  const auto now = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::duration wait = 1h;
+
+  std::set<std::string> settled;
+  {
+    std::unique_lock lock(m_section);
+    for (auto it = m_changed.begin(); it != m_changed.end();)
+    {
+      if (now - it->second >= SETTLE_TIME)
+      {
+        settled.insert(it->first);
+        it = m_changed.erase(it);
+      }
+      else
+      {
+        wait = std::min<std::chrono::steady_clock::duration>(wait, it->second + SETTLE_TIME - now);
+        ++it;
+      }
+    }
+  }
+
+  // a scan covers the tree below the scanned directory
+  for (const auto& directory : GetTopLevelPaths(settled))
+    ScanDirectory(directory);
+
+  return wait;
+}
+
+void CLibraryWatcher::ScanDirectory(const std::string& directory)
+{
+  for (const auto& [nativePath, root] : m_roots)
+  {
+    if (!StringUtils::StartsWith(directory, nativePath))
+      continue;
+
+    std::string path = root.path + directory.substr(nativePath.size());
+
+    if (root.libraries & LIBRARY_VIDEO)
+    {
+      // start from the closest path a library update would scan, so that a season or extras
+      // folder is handled as part of its show or movie
+      std::string videoPath = path;
+      while (!m_videoPaths.contains(videoPath) && videoPath.size() > root.path.size())
+        videoPath = URIUtils::GetParentPath(videoPath);
+
+      CLog::Log(LOGDEBUG, "LibraryWatcher: Updating video library for '{}'", videoPath);
+      CVideoLibraryQueue::GetInstance().ScanLibrary(videoPath, false, false);
+    }
+
+    if (root.libraries & LIBRARY_MUSIC)
+    {
+      CLog::Log(LOGDEBUG, "LibraryWatcher: Updating music library for '{}'", path);
+      CMusicLibraryQueue::GetInstance().ScanLibrary(
+          path, MUSIC_INFO::CMusicInfoScanner::SCAN_NORMAL, false);
+    }
+  }
+}
+
+void CLibraryWatcher::ScanLibraries(unsigned int libraries)
+{
+  if (libraries & LIBRARY_VIDEO)
+    CVideoLibraryQueue::GetInstance().ScanLibrary("", false, false);
+
+  if (libraries & LIBRARY_MUSIC)
+    CMusicLibraryQueue::GetInstance().ScanLibrary("", MUSIC_INFO::CMusicInfoScanner::SCAN_NORMAL,
+                                                  false);
+}
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/DirectoryWatcher.h"
+#include "interfaces/IAnnouncer.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+/*!
+ \brief Keeps the libraries up to date by watching their local sources.
+
+ Changes to local (including bind mounted) video and music sources are collected per directory.
+ Once a directory has been quiet for a moment, a library update is queued for just that
+ directory instead of hashing every source. If change events are lost, a full library update
+ is queued instead. Network sources are not watched and still rely on regular updates.
+ */
+class CLibraryWatcher : public XFILE::IDirectoryWatcherCallback,
+                        public ANNOUNCEMENT::IAnnouncer,
+                        private CThread
+{
+public:
+  /*!
+   \brief Gets the singleton instance of the library watcher.
+   */
+  static CLibraryWatcher& GetInstance();
+
+  /*!
+   \brief Watch the sources of every library that has watching enabled in advancedsettings.xml.
+   Re-reads the sources when already running, so it can be called again e.g. after a profile
+   change. Stops watching if no library has watching enabled.
+   */
+  void Start();
+
+  /*!
+   \brief Stop watching and drop any changes that haven't been handled yet.
+   */
+  void Stop();
+
+  // implementation of IDirectoryWatcherCallback
+  void OnDirectoryChanged(const std::string& directory) override;
+  void OnWatchOverflow() override;
+
+  // implementation of IAnnouncer
+  void Announce(ANNOUNCEMENT::AnnouncementFlag flag,
+                const std::string& sender,
+                const std::string& message,
+                const CVariant& data) override;
+
+protected:
+  void Process() override;
+
+private:
+  CLibraryWatcher();
+  ~CLibraryWatcher() override;
+  CLibraryWatcher(const CLibraryWatcher&) = delete;
+  CLibraryWatcher& operator=(const CLibraryWatcher&) = delete;
+
+  enum Library : unsigned int
+  {
+    LIBRARY_VIDEO = 1 << 0,
+    LIBRARY_MUSIC = 1 << 1,
+  };
+
+  struct Root
+  {
+    std::string path; //!< the source path as stored in the library
+    unsigned int libraries = 0;
+  };
+
+  void UpdateWatches(unsigned int libraries);
+  void AddRoots(const std::set<std::string, std::less<>>& paths, Library library);
+  std::chrono::steady_clock::duration ScanSettledChanges();
+  void ScanDirectory(const std::string& directory);
+  void ScanLibraries(unsigned int libraries);
+
+  std::unique_ptr<XFILE::IDirectoryWatcher> m_watcher;
+  std::map<std::string, Root> m_roots; //!< top level sources, keyed by native path
+  std::set<std::string> m_watched; //!< native paths currently watched
+  std::set<std::string, std::less<>> m_videoPaths; //!< paths the video scanner starts from
+
+  CCriticalSection m_section;
+  CEvent m_wakeup;
+  unsigned int m_libraries = 0; //!< libraries to watch
+  bool m_refresh = false;
+  bool m_overflow = false;
+  std::map<std::string, std::chrono::steady_clock::time_point> m_changed; //!< native directory -> last change
+};
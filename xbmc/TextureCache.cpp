@@ -202,6 +202,18 @@ std::string CTextureCache::CacheImage(
   return cachedpath;
 }
 
+std::string CTextureCache::CacheGeneratedImage(const std::string& image, CTexture& texture)
+{
+  const std::string url = IMAGE_FILES::ToCacheKey(image);
+  if (url.empty() || !StartCacheImage(url))
+    return "";
+
+  CTextureCacheJob job(url);
+  bool success = job.CacheGeneratedTexture(texture);
+  OnCachingComplete(success, &job);
+  return success ? GetCachedPath(job.m_details.file) : "";
+}
+
 bool CTextureCache::CacheImage(const std::string &image, CTextureDetails &details)
 {
   std::string path = GetCachedImage(image, details);
@@ -107,6 +107,17 @@ public:
                          unsigned int idealHeight = 0,
                          CAspectRatio::AspectRatio aspectRatio = CAspectRatio::CENTER);
 
+  /*! \brief Cache an image generated by the caller, e.g. a thumbnail extracted from a video.
+
+   The texture goes straight to the cache, it isn't loaded again through the image url.
+
+   \param image url of the image
+   \param texture the generated image
+   \return cached url of this image, empty if caching failed or the image is being cached already
+   \sa CTextureCacheJob::CacheGeneratedTexture
+   */
+  std::string CacheGeneratedImage(const std::string& image, CTexture& texture);
+
   /*! \brief Cache an image to image cache if not already cached, returning the image details.
    \param image url of the image to cache.
    \param details [out] the image details.
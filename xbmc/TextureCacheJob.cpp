@@ -115,31 +115,53 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
   }
 
   std::unique_ptr<CTexture> texture = LoadImage(imageURL);
-  if (texture)
+  if (texture && StoreTexture(*texture, image))
   {
-    if (texture->HasAlpha())
-      m_details.file = m_cachePath + ".png";
-    else
-      m_details.file = m_cachePath + ".jpg";
-
-    CLog::Log(LOGDEBUG, "{} image '{}' to '{}':", m_oldHash.empty() ? "Caching" : "Recaching",
-              CURL::GetRedacted(image), m_details.file);
-
-    unsigned int cached_width = 0;
-    unsigned int cached_height = 0;
-    if (CPicture::CacheTexture(texture.get(), cached_width, cached_height,
-                               CTextureCache::GetCachedPath(m_details.file)))
-    {
-      m_details.width = cached_width;
-      m_details.height = cached_height;
-      if (out_texture) // caller wants the texture
-        *out_texture = std::move(texture);
-      return true;
-    }
+    if (out_texture) // caller wants the texture
+      *out_texture = std::move(texture);
+    return true;
   }
   return false;
 }
 
+bool CTextureCacheJob::CacheGeneratedTexture(CTexture& texture)
+{
+  const IMAGE_FILES::CImageFileURL imageURL{m_url};
+
+  // generated images are special images, which are never checked for changes
+  const auto& image = imageURL.GetTargetFile();
+  m_details.updateable = ShouldCheckForChanges(imageURL.GetSpecialType(), image);
+  if (m_details.updateable)
+  {
+    m_details.hash = GetImageHash(image);
+    if (m_details.hash.empty())
+      return false;
+  }
+
+  return StoreTexture(texture, image);
+}
+
+bool CTextureCacheJob::StoreTexture(CTexture& texture, const std::string& image)
+{
+  if (texture.HasAlpha())
+    m_details.file = m_cachePath + ".png";
+  else
+    m_details.file = m_cachePath + ".jpg";
+
+  CLog::Log(LOGDEBUG, "{} image '{}' to '{}':", m_oldHash.empty() ? "Caching" : "Recaching",
+            CURL::GetRedacted(image), m_details.file);
+
+  unsigned int cached_width = 0;
+  unsigned int cached_height = 0;
+  if (!CPicture::CacheTexture(&texture, cached_width, cached_height,
+                              CTextureCache::GetCachedPath(m_details.file)))
+    return false;
+
+  m_details.width = cached_width;
+  m_details.height = cached_height;
+  return true;
+}
+
 bool CTextureCacheJob::ResizeTexture(const std::string& url,
                                      unsigned int height,
                                      unsigned int width,
@@ -67,6 +67,12 @@ public:
    */
   bool CacheTexture(std::unique_ptr<CTexture>* texture = nullptr);
 
+  /*! \brief Cache a texture that was generated for the image by the caller
+   \param texture the generated image, e.g. a thumbnail extracted from a video
+   \return true if the texture was written to the cache
+   */
+  bool CacheGeneratedTexture(CTexture& texture);
+
   static bool ResizeTexture(const std::string& url,
                             unsigned int height,
                             unsigned int width,
@@ -95,6 +101,13 @@ private:
    */
   static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL);
 
+  /*! \brief Write a loaded or generated texture to the cache file of the image
+   \param texture the texture to write
+   \param image the file the texture was made of, for logging
+   \return true if the texture was written
+   */
+  bool StoreTexture(CTexture& texture, const std::string& image);
+
   std::string    m_cachePath;
 };
 
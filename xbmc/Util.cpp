@@ -646,6 +646,44 @@ bool CUtil::ExcludeFileOrFolder(const std::string& strFileOrFolder, const std::v
   return false;
 }
 
+void CUtil::ExcludeFilesOrFolders(CFileItemList& items, const std::vector<std::string>& regexps)
+{
+  if (regexps.empty() || items.IsEmpty())
+    return;
+
+  VECCREGEXP regExExcludes;
+  std::vector<std::string> validRegexps;
+  for (const auto& regexp : regexps)
+  {
+    CRegExp regExExclude(true, CRegExp::autoUtf8); // case insensitive regex
+    if (!regExExclude.RegComp(regexp))
+    { // invalid regexp - complain in logs
+      CLog::Log(LOGERROR, "{}: Invalid exclude RegExp:'{}'", __FUNCTION__, regexp);
+      continue;
+    }
+    regExExcludes.push_back(regExExclude);
+    validRegexps.push_back(regexp);
+  }
+
+  std::vector<std::string> paths;
+  paths.reserve(items.Size());
+  for (const auto& item : items)
+    paths.push_back(item->GetPath());
+
+  const std::vector<int> matches = CRegExp::FindFirstMatching(regExExcludes, paths);
+
+  // removing from the end moves fewer items
+  for (int i = items.Size() - 1; i >= 0; i--)
+  {
+    if (matches[i] < 0 || paths[i].empty())
+      continue;
+
+    CLog::LogF(LOGDEBUG, "File '{}' excluded. (Matches exclude rule RegExp: '{}')",
+               CURL::GetRedacted(paths[i]), validRegexps[matches[i]]);
+    items.Remove(i);
+  }
+}
+
 void CUtil::GetFileAndProtocol(const std::string& strURL, std::string& strDir)
 {
   strDir = strURL;
@@ -87,6 +87,13 @@ public:
   static std::string GetHomePath(
       const std::string& strTarget = "KODI_HOME"); // default target is "KODI_HOME"
   static bool ExcludeFileOrFolder(const std::string& strFileOrFolder, const std::vector<std::string>& regexps);
+  /*!
+   \brief Remove the files and folders matching any of the exclude regexps from a list
+
+   Same as calling ExcludeFileOrFolder() for each item, but the regexps are compiled once and
+   matched against all items in one go.
+   */
+  static void ExcludeFilesOrFolders(CFileItemList& items, const std::vector<std::string>& regexps);
   static void GetFileAndProtocol(const std::string& strURL, std::string& strDir);
   static int GetDVDIfoTitle(const std::string& strPathFile);
 
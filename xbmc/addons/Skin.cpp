@@ -12,6 +12,7 @@
 #include "FileItemList.h"
 #include "ServiceBroker.h"
 #include "Util.h"
+#include "addons/AddonVersion.h"
 #include "addons/addoninfo/AddonType.h"
 #include "dialogs/GUIDialogKaiToast.h"
 #include "filesystem/Directory.h"
@@ -298,6 +299,7 @@ void CSkinInfo::LoadIncludes()
   CLog::Log(LOGINFO, "Loading skin includes from {}", includesPath);
   m_includes.Clear();
   m_includes.Load(includesPath);
+  m_windowCache.Reset(ID() + "-" + Version().asString());
 }
 
 void CSkinInfo::LoadTimers()
@@ -323,6 +325,20 @@ void CSkinInfo::ResolveIncludes(TiXmlElement* node,
   m_includes.Resolve(node, xmlIncludeConditions);
 }
 
+std::unique_ptr<TiXmlElement> CSkinInfo::LoadCachedWindow(
+    const std::string& window, std::map<INFO::InfoPtr, bool>& xmlIncludeConditions)
+{
+  return m_windowCache.Load(window, m_includes.GetFiles(), xmlIncludeConditions);
+}
+
+void CSkinInfo::CacheWindow(const std::string& window,
+                            const std::string& file,
+                            const TiXmlElement& root,
+                            const std::map<INFO::InfoPtr, bool>& xmlIncludeConditions)
+{
+  m_windowCache.Save(window, file, m_includes.GetFiles(), root, xmlIncludeConditions);
+}
+
 int CSkinInfo::GetStartWindow() const
 {
   int windowID = CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(CSettings::SETTING_LOOKANDFEEL_STARTUPWINDOW);
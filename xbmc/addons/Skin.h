@@ -11,6 +11,7 @@
 #include "addons/Addon.h"
 #include "addons/gui/skin/SkinTimerManager.h"
 #include "guilib/GUIIncludes.h" // needed for the GUIInclude member
+#include "guilib/GUIWindowCache.h"
 #include "windowing/GraphicContext.h" // needed for the RESOLUTION members
 
 #include <map>
@@ -157,6 +158,25 @@ public:
   void ResolveIncludes(TiXmlElement* node,
                        std::map<INFO::InfoPtr, bool>* xmlIncludeConditions = nullptr);
 
+  /*! \brief Get a window with all includes resolved from the window cache
+   \param window the path the window is loaded from
+   \param xmlIncludeConditions [out] the conditions used to resolve the includes and their values
+   \return the resolved <window> element, nullptr if it isn't cached or the cache is outdated
+   */
+  std::unique_ptr<TiXmlElement> LoadCachedWindow(
+      const std::string& window, std::map<INFO::InfoPtr, bool>& xmlIncludeConditions);
+
+  /*! \brief Store a window with all includes resolved in the window cache
+   \param window the path the window is loaded from
+   \param file the window file that was actually read
+   \param root the resolved <window> element
+   \param xmlIncludeConditions the conditions used to resolve the includes and their values
+   */
+  void CacheWindow(const std::string& window,
+                   const std::string& file,
+                   const TiXmlElement& root,
+                   const std::map<INFO::InfoPtr, bool>& xmlIncludeConditions);
+
   float GetEffectsSlowdown() const { return m_effectsSlowDown; }
 
   const std::vector<CStartupWindow>& GetStartupWindows() const { return m_startupWindows; }
@@ -273,6 +293,7 @@ protected:
 
   float m_effectsSlowDown;
   CGUIIncludes m_includes;
+  CGUIWindowCache m_windowCache;
   std::string m_currentAspect;
 
   std::vector<CStartupWindow> m_startupWindows;
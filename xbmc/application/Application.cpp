@@ -18,6 +18,7 @@
 #include "GUIUserMessages.h"
 #include "HDRStatus.h"
 #include "LangInfo.h"
+#include "LibraryWatcher.h"
 #include "PartyModeManager.h"
 #include "PlayListPlayer.h"
 #include "SectionLoader.h"
@@ -850,6 +851,9 @@ void CApplication::Render()
   // render gui layer
   if (appPower->GetRenderGUI() && !m_skipGuiRender)
   {
+    // hand out images that finished loading in the background, within the per frame budget
+    CServiceBroker::GetGUI()->GetLargeTextureManager().ProcessUploads();
+
     if (CServiceBroker::GetWinSystem()->GetGfxContext().GetStereoMode())
     {
       CServiceBroker::GetWinSystem()->GetGfxContext().SetStereoView(RENDER_STEREO_VIEW_LEFT);
@@ -1981,6 +1985,7 @@ bool CApplication::Cleanup()
     g_localizeStrings.Clear();
     g_LangCodeExpander.Clear();
     g_charsetConverter.clear();
+    g_directoryCache.PrintStats();
     g_directoryCache.Clear();
     //CServiceBroker::GetInputManager().ClearKeymaps(); //! @todo
     CEventServer::RemoveInstance();
@@ -2125,6 +2130,8 @@ bool CApplication::Stop(int exitCode)
     CServiceBroker::GetJobManager()->CancelJobs();
 
     // stop scanning before we kill the network and so on
+    CLibraryWatcher::GetInstance().Stop();
+
     if (CMusicLibraryQueue::GetInstance().IsRunning())
       CMusicLibraryQueue::GetInstance().CancelAllJobs();
 
@@ -3606,6 +3613,8 @@ void CApplication::UpdateLibraries()
         "", MUSIC_INFO::CMusicInfoScanner::SCAN_NORMAL,
         !settings->GetBool(CSettings::SETTING_MUSICLIBRARY_BACKGROUNDUPDATE));
   }
+
+  CLibraryWatcher::GetInstance().Start();
 }
 
 void CApplication::UpdateCurrentPlayArt()
@@ -15,6 +15,7 @@
 #include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Encoders/AEEncoderFFmpeg.h"
 #include "cores/AudioEngine/Interfaces/IAudioCallback.h"
+#include "cores/AudioEngine/Utils/AEKernels.h"
 #include "cores/AudioEngine/Utils/AEStreamData.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
@@ -2096,38 +2097,20 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
-            for(int i=0; i<nb_loops; i++)
+            const CAEKernels::Table& kernels = CAEKernels::Get();
+            if (nb_loops > 1)
+            {
+              const float* gains = GetFrameGains(*it, *out->pkt, nb_loops, fadingStep);
+              for (int j = 0; j < out->pkt->planes; j++)
+                kernels.mulFrames(reinterpret_cast<float*>(out->pkt->data[j]), gains, nb_floats,
+                                  nb_loops);
+            }
+            else
             {
-              if ((*it)->m_fadingSamples > 0)
-              {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
-              }
-
               // volume for stream
-              float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)out->pkt->data, out->pkt->config.channels, i*nb_floats, out->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes; j++)
-              {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
-              }
+              const float volume = (*it)->m_volume * (*it)->m_rgain;
+              for (int j = 0; j < out->pkt->planes; j++)
+                kernels.mul(reinterpret_cast<float*>(out->pkt->data[j]), volume, nb_floats);
             }
           }
           else
@@ -2163,49 +2146,21 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
-            for(int i=0; i<nb_loops; i++)
-            {
-              if ((*it)->m_fadingSamples > 0)
-              {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
-              }
+            const CAEKernels::Table& kernels = CAEKernels::Get();
+            const float* gains = nullptr;
+            // volume for stream
+            const float volume = (*it)->m_volume * (*it)->m_rgain;
+            if (nb_loops > 1)
+              gains = GetFrameGains(*it, *mix->pkt, nb_loops, fadingStep);
 
-              // volume for stream
-              float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)mix->pkt->data, mix->pkt->config.channels, i*nb_floats, mix->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes && j<mix->pkt->planes; j++)
-              {
-                float *dst = (float*)out->pkt->data[j]+i*nb_floats;
-                float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
-              }
+            for (int j = 0; j < out->pkt->planes && j < mix->pkt->planes; j++)
+            {
+              float* dst = reinterpret_cast<float*>(out->pkt->data[j]);
+              const float* src = reinterpret_cast<const float*>(mix->pkt->data[j]);
+              const float peak = gains ? kernels.mulAddFrames(dst, src, gains, nb_floats, nb_loops)
+                                       : kernels.mulAdd(dst, src, volume, nb_floats);
+              if (peak > 1.0f)
+                needClamp = true;
             }
             mix->Return();
           }
@@ -2593,12 +2548,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEKernels::Get().mulAdd(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2613,6 +2563,47 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
   }
 }
 
+const float* CActiveAE::GetFrameGains(CActiveAEStream* stream,
+                                      const CSoundPacket& pkt,
+                                      int frames,
+                                      float fadingStep)
+{
+  const CAEKernels::Table& kernels = CAEKernels::Get();
+  m_frameGains.assign(frames, 0.0f);
+  float* gains = m_frameGains.data();
+
+  // the limiter works on the loudest sample of each frame
+  if (pkt.planes > 1)
+  {
+    for (int j = 0; j < pkt.planes; j++)
+      kernels.framePeaks(gains, reinterpret_cast<const float*>(pkt.data[j]), 1, frames);
+  }
+  else
+    kernels.framePeaks(gains, reinterpret_cast<const float*>(pkt.data[0]), pkt.config.channels,
+                       frames);
+  stream->m_limiter.Run(gains, frames);
+
+  for (int i = 0; i < frames; i++)
+  {
+    if (stream->m_fadingSamples > 0)
+    {
+      stream->m_volume += fadingStep;
+      stream->m_fadingSamples--;
+
+      if (stream->m_fadingSamples == 0)
+      {
+        // set variables being polled via stream interface
+        std::unique_lock lock(stream->m_streamLock);
+        stream->m_streamFading = false;
+      }
+    }
+
+    gains[i] *= stream->m_volume * stream->m_rgain;
+  }
+
+  return gains;
+}
+
 void CActiveAE::Deamplify(CSoundPacket &dstSample)
 {
   if (m_volumeScaled < 1.0f || m_muted)
@@ -2623,13 +2614,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEKernels::Get().mul(buffer, volume, nb_floats);
     }
   }
 }
@@ -334,6 +334,10 @@ protected:
   bool ResampleSound(CActiveAESound *sound);
   void MixSounds(CSoundPacket &dstSample);
   void Deamplify(CSoundPacket &dstSample);
+  const float* GetFrameGains(CActiveAEStream* stream,
+                             const CSoundPacket& pkt,
+                             int frames,
+                             float fadingStep);
 
   bool CompareFormat(const AEAudioFormat& lhs, const AEAudioFormat& rhs);
 
@@ -393,6 +397,7 @@ protected:
   };
   std::list<SoundState> m_sounds_playing;
   std::vector<CActiveAESound*> m_sounds;
+  std::vector<float> m_frameGains; // per frame stream volume, see GetFrameGains
 
   float m_volume; // volume on a 0..1 scale corresponding to a proportion along the dB scale
   float m_volumeScaled; // multiplier to scale samples in order to achieve the volume specified in m_volume
@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+// built with -mavx2, only ever called if CCPUInfo reports AVX2
+#if defined(__AVX2__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+
+#include "AEKernelsImpl.h"
+
+#include <immintrin.h>
+
+namespace
+{
+
+struct AVX2Vector
+{
+  using V = __m256;
+  static constexpr size_t width = 8;
+
+  static V Load(const float* p) { return _mm256_loadu_ps(p); }
+  static void Store(float* p, V v) { _mm256_storeu_ps(p, v); }
+  static V Set(float f) { return _mm256_set1_ps(f); }
+  static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+  static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+  static V Div(V a, V b) { return _mm256_div_ps(a, b); }
+  static V Min(V a, V b) { return _mm256_min_ps(a, b); }
+  static V Max(V a, V b) { return _mm256_max_ps(a, b); }
+  static V Abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+
+  static float ReduceMax(V v)
+  {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(m);
+  }
+
+  static void Interleave2(V a, V b, V& lo, V& hi)
+  {
+    // unpack works within the 128 bit lanes, put the lanes back in order afterwards
+    const V l = _mm256_unpacklo_ps(a, b);
+    const V h = _mm256_unpackhi_ps(a, b);
+    lo = _mm256_permute2f128_ps(l, h, 0x20);
+    hi = _mm256_permute2f128_ps(l, h, 0x31);
+  }
+
+  static void Deinterleave2(V lo, V hi, V& a, V& b)
+  {
+    const V l = _mm256_permute2f128_ps(lo, hi, 0x20);
+    const V h = _mm256_permute2f128_ps(lo, hi, 0x31);
+    a = _mm256_shuffle_ps(l, h, _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm256_shuffle_ps(l, h, _MM_SHUFFLE(3, 1, 3, 1));
+  }
+};
+
+} // unnamed namespace
+
+const CAEKernels::Table* CAEKernels::GetAVX2()
+{
+  static constexpr Table table = MakeTable<AVX2Vector>("AVX2");
+  return &table;
+}
+
+#else
+
+const CAEKernels::Table* CAEKernels::GetAVX2()
+{
+  return nullptr;
+}
+
+#endif
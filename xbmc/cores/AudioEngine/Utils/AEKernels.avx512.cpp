@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+// built with -mavx512f, only ever called if CCPUInfo reports AVX-512
+#if defined(__AVX512F__) || (defined(_MSC_VER) && defined(_M_X64))
+
+#include "AEKernelsImpl.h"
+
+#include <immintrin.h>
+
+namespace
+{
+
+struct AVX512Vector
+{
+  using V = __m512;
+  static constexpr size_t width = 16;
+
+  static V Load(const float* p) { return _mm512_loadu_ps(p); }
+  static void Store(float* p, V v) { _mm512_storeu_ps(p, v); }
+  static V Set(float f) { return _mm512_set1_ps(f); }
+  static V Add(V a, V b) { return _mm512_add_ps(a, b); }
+  static V Mul(V a, V b) { return _mm512_mul_ps(a, b); }
+  static V Div(V a, V b) { return _mm512_div_ps(a, b); }
+  static V Min(V a, V b) { return _mm512_min_ps(a, b); }
+  static V Max(V a, V b) { return _mm512_max_ps(a, b); }
+  static V Abs(V a) { return _mm512_abs_ps(a); }
+  static float ReduceMax(V v) { return _mm512_reduce_max_ps(v); }
+
+  static void Interleave2(V a, V b, V& lo, V& hi)
+  {
+    // indices 0-15 select from the first operand, 16-31 from the second
+    const __m512i loIndex =
+        _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hiIndex =
+        _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    lo = _mm512_permutex2var_ps(a, loIndex, b);
+    hi = _mm512_permutex2var_ps(a, hiIndex, b);
+  }
+
+  static void Deinterleave2(V lo, V hi, V& a, V& b)
+  {
+    const __m512i evenIndex =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i oddIndex =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    a = _mm512_permutex2var_ps(lo, evenIndex, hi);
+    b = _mm512_permutex2var_ps(lo, oddIndex, hi);
+  }
+};
+
+} // unnamed namespace
+
+const CAEKernels::Table* CAEKernels::GetAVX512()
+{
+  static constexpr Table table = MakeTable<AVX512Vector>("AVX-512");
+  return &table;
+}
+
+#else
+
+const CAEKernels::Table* CAEKernels::GetAVX512()
+{
+  return nullptr;
+}
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#include "AEKernelsImpl.h"
+#include "ServiceBroker.h"
+#include "utils/CPUInfo.h"
+#include "utils/log.h"
+
+const CAEKernels::Table* CAEKernels::GetGeneric()
+{
+  static constexpr Table table = MakeTable<ScalarVector>("generic");
+  return &table;
+}
+
+std::vector<const CAEKernels::Table*> CAEKernels::GetSupported(unsigned int cpuFeatures)
+{
+  std::vector<const Table*> tables{GetGeneric()};
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+  // part of the base instruction set, not reported everywhere
+  cpuFeatures |= CPU_FEATURE_NEON;
+#endif
+
+  if ((cpuFeatures & CPU_FEATURE_SSE2) && GetSSE2())
+    tables.emplace_back(GetSSE2());
+  if ((cpuFeatures & CPU_FEATURE_AVX2) && GetAVX2())
+    tables.emplace_back(GetAVX2());
+  if ((cpuFeatures & CPU_FEATURE_AVX512) && GetAVX512())
+    tables.emplace_back(GetAVX512());
+  if ((cpuFeatures & CPU_FEATURE_NEON) && GetNEON())
+    tables.emplace_back(GetNEON());
+
+  return tables;
+}
+
+const CAEKernels::Table& CAEKernels::Get()
+{
+  static const Table& table = []() -> const Table& {
+    const auto cpuInfo = CServiceBroker::GetCPUInfo();
+    const Table* best = GetSupported(cpuInfo ? cpuInfo->GetCPUFeatures() : 0).back();
+    CLog::Log(LOGDEBUG, "CAEKernels::Get - using {} kernels", best->name);
+    return *best;
+  }();
+
+  return table;
+}
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \brief Float sample kernels of the audio engine.
+ *
+ * Every kernel has a portable implementation and, depending on what the compiler can target,
+ * SSE2, AVX2, AVX-512 and NEON ones. Get() returns the best set the running CPU supports, chosen
+ * once from the features reported by CCPUInfo. Buffers don't need any particular alignment and
+ * interleaved data is laid out frame by frame with channels samples per frame.
+ */
+class CAEKernels
+{
+public:
+  struct Table
+  {
+    const char* name;
+
+    //! data[i] *= mul
+    void (*mul)(float* data, float mul, size_t count);
+
+    //! data[i] += add[i] * mul, returns the largest absolute value written
+    float (*mulAdd)(float* data, const float* add, float mul, size_t count);
+
+    //! data[frame * channels + c] *= gains[frame]
+    void (*mulFrames)(float* data, const float* gains, int channels, size_t frames);
+
+    //! data[frame * channels + c] += add[frame * channels + c] * gains[frame], returns the
+    //! largest absolute value written
+    float (*mulAddFrames)(
+        float* data, const float* add, const float* gains, int channels, size_t frames);
+
+    //! tanh like soft clipper, values beyond +-3 end up at +-1
+    void (*softClamp)(float* data, size_t count);
+
+    //! peaks[frame] = max(peaks[frame], |data[frame * channels + c]|)
+    void (*framePeaks)(float* peaks, const float* data, int channels, size_t frames);
+
+    //! dst[frame * channels + c] = src[c][frame]
+    void (*interleave)(float* dst, const float* const* src, int channels, size_t frames);
+
+    //! dst[c][frame] = src[frame * channels + c]
+    void (*deinterleave)(float* const* dst, const float* src, int channels, size_t frames);
+  };
+
+  /*!
+   * \brief The kernels for the CPU we run on.
+   */
+  static const Table& Get();
+
+  /*!
+   * \brief All kernel sets usable with the given CCPUInfo features, the portable one first.
+   */
+  static std::vector<const Table*> GetSupported(unsigned int cpuFeatures);
+
+private:
+  // defined by the instruction set specific files, nullptr if not built for this target
+  static const Table* GetGeneric();
+  static const Table* GetSSE2();
+  static const Table* GetAVX2();
+  static const Table* GetAVX512();
+  static const Table* GetNEON();
+};
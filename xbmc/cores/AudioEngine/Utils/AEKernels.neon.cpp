@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+
+#include "AEKernelsImpl.h"
+
+#include <arm_neon.h>
+
+namespace
+{
+
+struct NEONVector
+{
+  using V = float32x4_t;
+  static constexpr size_t width = 4;
+
+  static V Load(const float* p) { return vld1q_f32(p); }
+  static void Store(float* p, V v) { vst1q_f32(p, v); }
+  static V Set(float f) { return vdupq_n_f32(f); }
+  static V Add(V a, V b) { return vaddq_f32(a, b); }
+  static V Mul(V a, V b) { return vmulq_f32(a, b); }
+  static V Min(V a, V b) { return vminq_f32(a, b); }
+  static V Max(V a, V b) { return vmaxq_f32(a, b); }
+  static V Abs(V a) { return vabsq_f32(a); }
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+  static V Div(V a, V b) { return vdivq_f32(a, b); }
+  static float ReduceMax(V v) { return vmaxvq_f32(v); }
+#else
+  static V Div(V a, V b)
+  {
+    // no divide on 32 bit ARM, refine the reciprocal estimate to full precision instead
+    V reciprocal = vrecpeq_f32(b);
+    reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+    reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+    return vmulq_f32(a, reciprocal);
+  }
+
+  static float ReduceMax(V v)
+  {
+    float32x2_t m = vpmax_f32(vget_low_f32(v), vget_high_f32(v));
+    m = vpmax_f32(m, m);
+    return vget_lane_f32(m, 0);
+  }
+#endif
+
+  static void Interleave2(V a, V b, V& lo, V& hi)
+  {
+    const float32x4x2_t zipped = vzipq_f32(a, b);
+    lo = zipped.val[0];
+    hi = zipped.val[1];
+  }
+
+  static void Deinterleave2(V lo, V hi, V& a, V& b)
+  {
+    const float32x4x2_t unzipped = vuzpq_f32(lo, hi);
+    a = unzipped.val[0];
+    b = unzipped.val[1];
+  }
+};
+
+} // unnamed namespace
+
+const CAEKernels::Table* CAEKernels::GetNEON()
+{
+  static constexpr Table table = MakeTable<NEONVector>("NEON");
+  return &table;
+}
+
+#else
+
+const CAEKernels::Table* CAEKernels::GetNEON()
+{
+  return nullptr;
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEKernels.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include "AEKernelsImpl.h"
+
+#include <emmintrin.h>
+
+namespace
+{
+
+struct SSE2Vector
+{
+  using V = __m128;
+  static constexpr size_t width = 4;
+
+  static V Load(const float* p) { return _mm_loadu_ps(p); }
+  static void Store(float* p, V v) { _mm_storeu_ps(p, v); }
+  static V Set(float f) { return _mm_set1_ps(f); }
+  static V Add(V a, V b) { return _mm_add_ps(a, b); }
+  static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+  static V Div(V a, V b) { return _mm_div_ps(a, b); }
+  static V Min(V a, V b) { return _mm_min_ps(a, b); }
+  static V Max(V a, V b) { return _mm_max_ps(a, b); }
+  static V Abs(V a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+  static float ReduceMax(V v)
+  {
+    v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_max_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(v);
+  }
+
+  static void Interleave2(V a, V b, V& lo, V& hi)
+  {
+    lo = _mm_unpacklo_ps(a, b);
+    hi = _mm_unpackhi_ps(a, b);
+  }
+
+  static void Deinterleave2(V lo, V hi, V& a, V& b)
+  {
+    a = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+    b = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+  }
+};
+
+} // unnamed namespace
+
+const CAEKernels::Table* CAEKernels::GetSSE2()
+{
+  static constexpr Table table = MakeTable<SSE2Vector>("SSE2");
+  return &table;
+}
+
+#else
+
+const CAEKernels::Table* CAEKernels::GetSSE2()
+{
+  return nullptr;
+}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+// Kernel templates shared by the AEKernels.*.cpp files. Each of them is built for a different
+// instruction set, so everything here has internal linkage: an inline function compiled with
+// -mavx512f must never be merged with the portable copy of another file. For the same reason
+// nothing from the standard library that isn't a builtin is used.
+
+#include "AEKernels.h"
+
+#include <cstddef>
+
+namespace
+{
+
+/*!
+ * Operations a kernel needs on a vector of V::width floats. The portable implementation uses
+ * ScalarVector, the others wrap intrinsics with the same interface. Interleave2 and
+ * Deinterleave2 are only required if width is larger than one.
+ */
+struct ScalarVector
+{
+  using V = float;
+  static constexpr size_t width = 1;
+
+  static V Load(const float* p) { return *p; }
+  static void Store(float* p, V v) { *p = v; }
+  static V Set(float f) { return f; }
+  static V Add(V a, V b) { return a + b; }
+  static V Mul(V a, V b) { return a * b; }
+  static V Div(V a, V b) { return a / b; }
+  static V Min(V a, V b) { return b < a ? b : a; }
+  static V Max(V a, V b) { return a < b ? b : a; }
+  static V Abs(V a) { return a < 0.0f ? -a : a; }
+  static float ReduceMax(V v) { return v; }
+};
+
+inline float ScalarMax(float a, float b)
+{
+  return a < b ? b : a;
+}
+
+inline float ScalarAbs(float a)
+{
+  return a < 0.0f ? -a : a;
+}
+
+/*
+   This is a rational function to approximate a tanh-like soft clipper.
+   It is based on the pade-approximation of the tanh function with tweaked coefficients.
+   See: http://www.musicdsp.org/showone.php?id=238
+   The result is exactly +-1 at +-3, so clamping the input there gives the clip beyond.
+*/
+template<typename T>
+typename T::V SoftClampVector(typename T::V x)
+{
+  x = T::Min(T::Max(x, T::Set(-3.0f)), T::Set(3.0f));
+  const typename T::V y = T::Mul(x, x);
+  return T::Div(T::Mul(x, T::Add(T::Set(27.0f), y)),
+                T::Add(T::Set(27.0f), T::Mul(T::Set(9.0f), y)));
+}
+
+template<typename T>
+void Mul(float* data, float mul, size_t count)
+{
+  const typename T::V m = T::Set(mul);
+  size_t i = 0;
+  for (; i + T::width <= count; i += T::width)
+    T::Store(data + i, T::Mul(T::Load(data + i), m));
+  for (; i < count; ++i)
+    data[i] *= mul;
+}
+
+template<typename T>
+float MulAdd(float* data, const float* add, float mul, size_t count)
+{
+  const typename T::V m = T::Set(mul);
+  typename T::V peak = T::Set(0.0f);
+  size_t i = 0;
+  for (; i + T::width <= count; i += T::width)
+  {
+    const typename T::V v = T::Add(T::Load(data + i), T::Mul(T::Load(add + i), m));
+    T::Store(data + i, v);
+    peak = T::Max(peak, T::Abs(v));
+  }
+
+  float result = T::ReduceMax(peak);
+  for (; i < count; ++i)
+  {
+    data[i] += add[i] * mul;
+    result = ScalarMax(result, ScalarAbs(data[i]));
+  }
+  return result;
+}
+
+template<typename T>
+void MulFrames(float* data, const float* gains, int channels, size_t frames)
+{
+  if (channels == 1)
+  {
+    size_t i = 0;
+    for (; i + T::width <= frames; i += T::width)
+      T::Store(data + i, T::Mul(T::Load(data + i), T::Load(gains + i)));
+    for (; i < frames; ++i)
+      data[i] *= gains[i];
+    return;
+  }
+
+  const size_t frameSize = static_cast<size_t>(channels);
+  for (size_t frame = 0; frame < frames; ++frame, data += frameSize)
+    Mul<T>(data, gains[frame], frameSize);
+}
+
+template<typename T>
+float MulAddFrames(float* data, const float* add, const float* gains, int channels, size_t frames)
+{
+  if (channels == 1)
+  {
+    typename T::V peak = T::Set(0.0f);
+    size_t i = 0;
+    for (; i + T::width <= frames; i += T::width)
+    {
+      const typename T::V v =
+          T::Add(T::Load(data + i), T::Mul(T::Load(add + i), T::Load(gains + i)));
+      T::Store(data + i, v);
+      peak = T::Max(peak, T::Abs(v));
+    }
+
+    float result = T::ReduceMax(peak);
+    for (; i < frames; ++i)
+    {
+      data[i] += add[i] * gains[i];
+      result = ScalarMax(result, ScalarAbs(data[i]));
+    }
+    return result;
+  }
+
+  const size_t frameSize = static_cast<size_t>(channels);
+  float result = 0.0f;
+  for (size_t frame = 0; frame < frames; ++frame, data += frameSize, add += frameSize)
+    result = ScalarMax(result, MulAdd<T>(data, add, gains[frame], frameSize));
+  return result;
+}
+
+template<typename T>
+void SoftClamp(float* data, size_t count)
+{
+  size_t i = 0;
+  for (; i + T::width <= count; i += T::width)
+    T::Store(data + i, SoftClampVector<T>(T::Load(data + i)));
+  for (; i < count; ++i)
+    data[i] = SoftClampVector<ScalarVector>(data[i]);
+}
+
+template<typename T>
+void FramePeaks(float* peaks, const float* data, int channels, size_t frames)
+{
+  if (channels == 1)
+  {
+    size_t i = 0;
+    for (; i + T::width <= frames; i += T::width)
+      T::Store(peaks + i, T::Max(T::Load(peaks + i), T::Abs(T::Load(data + i))));
+    for (; i < frames; ++i)
+      peaks[i] = ScalarMax(peaks[i], ScalarAbs(data[i]));
+    return;
+  }
+
+  const size_t frameSize = static_cast<size_t>(channels);
+  for (size_t frame = 0; frame < frames; ++frame, data += frameSize)
+  {
+    typename T::V peak = T::Set(0.0f);
+    size_t c = 0;
+    for (; c + T::width <= frameSize; c += T::width)
+      peak = T::Max(peak, T::Abs(T::Load(data + c)));
+
+    float result = ScalarMax(peaks[frame], T::ReduceMax(peak));
+    for (; c < frameSize; ++c)
+      result = ScalarMax(result, ScalarAbs(data[c]));
+    peaks[frame] = result;
+  }
+}
+
+template<typename T>
+void Interleave(float* dst, const float* const* src, int channels, size_t frames)
+{
+  size_t frame = 0;
+  if constexpr (T::width > 1)
+  {
+    // stereo is by far the most common interleaved layout
+    if (channels == 2)
+    {
+      for (; frame + T::width <= frames; frame += T::width, dst += 2 * T::width)
+      {
+        typename T::V lo;
+        typename T::V hi;
+        T::Interleave2(T::Load(src[0] + frame), T::Load(src[1] + frame), lo, hi);
+        T::Store(dst, lo);
+        T::Store(dst + T::width, hi);
+      }
+    }
+  }
+
+  for (; frame < frames; ++frame)
+  {
+    for (int c = 0; c < channels; ++c)
+      *dst++ = src[c][frame];
+  }
+}
+
+template<typename T>
+void Deinterleave(float* const* dst, const float* src, int channels, size_t frames)
+{
+  size_t frame = 0;
+  if constexpr (T::width > 1)
+  {
+    if (channels == 2)
+    {
+      for (; frame + T::width <= frames; frame += T::width, src += 2 * T::width)
+      {
+        typename T::V a;
+        typename T::V b;
+        T::Deinterleave2(T::Load(src), T::Load(src + T::width), a, b);
+        T::Store(dst[0] + frame, a);
+        T::Store(dst[1] + frame, b);
+      }
+    }
+  }
+
+  for (; frame < frames; ++frame)
+  {
+    for (int c = 0; c < channels; ++c)
+      dst[c][frame] = *src++;
+  }
+}
+
+template<typename T>
+constexpr CAEKernels::Table MakeTable(const char* name)
+{
+  return {name,
+          Mul<T>,
+          MulAdd<T>,
+          MulFrames<T>,
+          MulAddFrames<T>,
+          SoftClamp<T>,
+          FramePeaks<T>,
+          Interleave<T>,
+          Deinterleave<T>};
+}
+
+} // unnamed namespace
@@ -43,6 +43,17 @@ float CAELimiter::Run(float* frame[AE_CH_MAX], int channels, int offset /*= 0*/,
     }
   }
 
+  return Process(highest);
+}
+
+void CAELimiter::Run(float* gains, int frames)
+{
+  for (int i = 0; i < frames; i++)
+    gains[i] = Process(gains[i]);
+}
+
+float CAELimiter::Process(float highest)
+{
   float sample = highest * m_amplify;
   if (sample * m_attenuation > 1.0f)
   {
@@ -21,6 +21,8 @@ class CAELimiter
     int   m_holdcounter;
     float m_increase;
 
+    float Process(float highest);
+
   public:
     CAELimiter();
 
@@ -40,4 +42,11 @@ class CAELimiter
     }
 
     float Run(float* frame[AE_CH_MAX], int channels, int offset = 0, bool planar = false);
+
+    /*!
+     * \brief Run the limiter over a block of frames at once
+     * \param gains the peak level of each frame on input, the gain to apply to it on output
+     * \param frames the number of frames
+     */
+    void Run(float* gains, int frames);
 };
@@ -0,0 +1,136 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEKernels.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// one ActiveAE cycle of 7.1 float at 192 kHz, processed planar
+constexpr int CHANNELS = 8;
+constexpr size_t FRAMES = 192000 / 50;
+
+std::vector<float> RandomSamples(size_t count)
+{
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> distribution(-1.5f, 1.5f);
+  std::vector<float> samples(count);
+  for (float& sample : samples)
+    sample = distribution(random);
+  return samples;
+}
+
+const CAEKernels::Table& Kernels(const benchmark::State& state)
+{
+  static const auto tables = CAEKernels::GetSupported(CCPUInfo::GetCPUInfo()->GetCPUFeatures());
+  return *tables[state.range(0)];
+}
+
+void Label(benchmark::State& state)
+{
+  state.SetLabel(Kernels(state).name);
+  state.SetItemsProcessed(state.iterations() * FRAMES * CHANNELS);
+}
+
+void BM_Mul(benchmark::State& state)
+{
+  std::vector<float> data = RandomSamples(FRAMES * CHANNELS);
+  for (auto _ : state)
+  {
+    Kernels(state).mul(data.data(), 0.999f, data.size());
+    benchmark::ClobberMemory();
+  }
+  Label(state);
+}
+
+void BM_MulAdd(benchmark::State& state)
+{
+  const std::vector<float> add = RandomSamples(FRAMES * CHANNELS);
+  std::vector<float> data = RandomSamples(FRAMES * CHANNELS);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(Kernels(state).mulAdd(data.data(), add.data(), 1e-3f, data.size()));
+  Label(state);
+}
+
+void BM_SoftClamp(benchmark::State& state)
+{
+  const std::vector<float> source = RandomSamples(FRAMES * CHANNELS);
+  std::vector<float> data = source;
+  for (auto _ : state)
+  {
+    Kernels(state).softClamp(data.data(), data.size());
+    benchmark::ClobberMemory();
+  }
+  Label(state);
+}
+
+// what the limiter and fading path runs per cycle: peaks of all planes, then one gain per frame
+void BM_Limiter(benchmark::State& state)
+{
+  std::vector<std::vector<float>> planes(CHANNELS, RandomSamples(FRAMES));
+  std::vector<float> gains(FRAMES);
+  for (auto _ : state)
+  {
+    std::fill(gains.begin(), gains.end(), 0.0f);
+    for (const auto& plane : planes)
+      Kernels(state).framePeaks(gains.data(), plane.data(), 1, FRAMES);
+    for (float& gain : gains)
+      gain = gain > 1.0f ? 1.0f / gain : 1.0f;
+    for (auto& plane : planes)
+      Kernels(state).mulFrames(plane.data(), gains.data(), 1, FRAMES);
+    benchmark::ClobberMemory();
+  }
+  Label(state);
+}
+
+void BM_Interleave(benchmark::State& state)
+{
+  std::vector<std::vector<float>> planes(2, RandomSamples(FRAMES * CHANNELS / 2));
+  const float* src[] = {planes[0].data(), planes[1].data()};
+  std::vector<float> dst(FRAMES * CHANNELS);
+  for (auto _ : state)
+  {
+    Kernels(state).interleave(dst.data(), src, 2, FRAMES * CHANNELS / 2);
+    benchmark::ClobberMemory();
+  }
+  Label(state);
+}
+
+void BM_Deinterleave(benchmark::State& state)
+{
+  const std::vector<float> src = RandomSamples(FRAMES * CHANNELS);
+  std::vector<std::vector<float>> planes(2, std::vector<float>(FRAMES * CHANNELS / 2));
+  float* dst[] = {planes[0].data(), planes[1].data()};
+  for (auto _ : state)
+  {
+    Kernels(state).deinterleave(dst, src.data(), 2, FRAMES * CHANNELS / 2);
+    benchmark::ClobberMemory();
+  }
+  Label(state);
+}
+
+void AllKernels(benchmark::internal::Benchmark* benchmark)
+{
+  const auto tables = CAEKernels::GetSupported(CCPUInfo::GetCPUInfo()->GetCPUFeatures());
+  for (size_t i = 0; i < tables.size(); ++i)
+    benchmark->Arg(static_cast<int64_t>(i));
+}
+
+BENCHMARK(BM_Mul)->Apply(AllKernels);
+BENCHMARK(BM_MulAdd)->Apply(AllKernels);
+BENCHMARK(BM_SoftClamp)->Apply(AllKernels);
+BENCHMARK(BM_Limiter)->Apply(AllKernels);
+BENCHMARK(BM_Interleave)->Apply(AllKernels);
+BENCHMARK(BM_Deinterleave)->Apply(AllKernels);
+} // namespace
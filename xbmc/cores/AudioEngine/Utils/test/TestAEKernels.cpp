@@ -0,0 +1,208 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AEKernels.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// odd sizes and offsets so every kernel runs its vector loop as well as the tail
+constexpr size_t COUNT = 1000 + 13;
+
+std::vector<float> RandomSamples(size_t count, float range, unsigned int seed)
+{
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<float> distribution(-range, range);
+  std::vector<float> samples(count);
+  for (float& sample : samples)
+    sample = distribution(random);
+  return samples;
+}
+
+void ExpectSame(const std::vector<float>& expected, const std::vector<float>& actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(expected[i], actual[i], 1e-6f * std::max(1.0f, std::fabs(expected[i]))) << i;
+}
+
+std::vector<const CAEKernels::Table*> GetTables()
+{
+  return CAEKernels::GetSupported(CCPUInfo::GetCPUInfo()->GetCPUFeatures());
+}
+} // namespace
+
+class TestAEKernels : public ::testing::TestWithParam<int>
+{
+protected:
+  const CAEKernels::Table& Reference() const { return *GetTables().front(); }
+  const CAEKernels::Table& Kernels() const { return *GetTables()[GetParam()]; }
+};
+
+TEST(TestAEKernelsGeneric, Values)
+{
+  const CAEKernels::Table& kernels = *CAEKernels::GetSupported(0).front();
+
+  std::vector<float> data{1.0f, -2.0f, 0.5f};
+  kernels.mul(data.data(), 2.0f, data.size());
+  EXPECT_EQ(std::vector<float>({2.0f, -4.0f, 1.0f}), data);
+
+  const std::vector<float> add{1.0f, 1.0f, 1.0f};
+  EXPECT_EQ(3.5f, kernels.mulAdd(data.data(), add.data(), 0.5f, data.size()));
+  EXPECT_EQ(std::vector<float>({2.5f, -3.5f, 1.5f}), data);
+
+  std::vector<float> clamp{-10.0f, -3.0f, 0.0f, 3.0f, 10.0f};
+  kernels.softClamp(clamp.data(), clamp.size());
+  EXPECT_EQ(std::vector<float>({-1.0f, -1.0f, 0.0f, 1.0f, 1.0f}), clamp);
+
+  // stereo, frame peaks and gains
+  const std::vector<float> stereo{0.5f, -0.25f, -1.5f, 1.0f};
+  std::vector<float> peaks{0.0f, 0.0f};
+  kernels.framePeaks(peaks.data(), stereo.data(), 2, 2);
+  EXPECT_EQ(std::vector<float>({0.5f, 1.5f}), peaks);
+
+  std::vector<float> gained = stereo;
+  const std::vector<float> gains{2.0f, 0.5f};
+  kernels.mulFrames(gained.data(), gains.data(), 2, 2);
+  EXPECT_EQ(std::vector<float>({1.0f, -0.5f, -0.75f, 0.5f}), gained);
+}
+
+TEST_P(TestAEKernels, Mul)
+{
+  std::vector<float> expected = RandomSamples(COUNT, 1.0f, 1);
+  std::vector<float> actual = expected;
+
+  Reference().mul(expected.data() + 1, 0.7f, COUNT - 1);
+  Kernels().mul(actual.data() + 1, 0.7f, COUNT - 1);
+  ExpectSame(expected, actual);
+}
+
+TEST_P(TestAEKernels, MulAdd)
+{
+  const std::vector<float> add = RandomSamples(COUNT, 1.0f, 2);
+  std::vector<float> expected = RandomSamples(COUNT, 1.0f, 3);
+  std::vector<float> actual = expected;
+
+  const float expectedPeak = Reference().mulAdd(expected.data() + 3, add.data() + 1, 0.9f, COUNT - 3);
+  const float actualPeak = Kernels().mulAdd(actual.data() + 3, add.data() + 1, 0.9f, COUNT - 3);
+  ExpectSame(expected, actual);
+  EXPECT_FLOAT_EQ(expectedPeak, actualPeak);
+}
+
+TEST_P(TestAEKernels, MulFrames)
+{
+  for (int channels : {1, 2, 6, 8})
+  {
+    const size_t frames = COUNT / channels;
+    const std::vector<float> gains = RandomSamples(frames, 2.0f, 4);
+    std::vector<float> expected = RandomSamples(frames * channels, 1.0f, 5);
+    std::vector<float> actual = expected;
+
+    Reference().mulFrames(expected.data(), gains.data(), channels, frames);
+    Kernels().mulFrames(actual.data(), gains.data(), channels, frames);
+    ExpectSame(expected, actual);
+  }
+}
+
+TEST_P(TestAEKernels, MulAddFrames)
+{
+  for (int channels : {1, 2, 6, 8})
+  {
+    const size_t frames = COUNT / channels;
+    const std::vector<float> gains = RandomSamples(frames, 2.0f, 6);
+    const std::vector<float> add = RandomSamples(frames * channels, 1.0f, 7);
+    std::vector<float> expected = RandomSamples(frames * channels, 1.0f, 8);
+    std::vector<float> actual = expected;
+
+    const float expectedPeak =
+        Reference().mulAddFrames(expected.data(), add.data(), gains.data(), channels, frames);
+    const float actualPeak =
+        Kernels().mulAddFrames(actual.data(), add.data(), gains.data(), channels, frames);
+    ExpectSame(expected, actual);
+    EXPECT_FLOAT_EQ(expectedPeak, actualPeak);
+  }
+}
+
+TEST_P(TestAEKernels, SoftClamp)
+{
+  std::vector<float> expected = RandomSamples(COUNT, 5.0f, 9);
+  std::vector<float> actual = expected;
+
+  Reference().softClamp(expected.data(), COUNT);
+  Kernels().softClamp(actual.data(), COUNT);
+  ExpectSame(expected, actual);
+  for (float sample : actual)
+  {
+    EXPECT_LE(sample, 1.0f);
+    EXPECT_GE(sample, -1.0f);
+  }
+}
+
+TEST_P(TestAEKernels, FramePeaks)
+{
+  for (int channels : {1, 2, 6, 8})
+  {
+    const size_t frames = COUNT / channels;
+    const std::vector<float> data = RandomSamples(frames * channels, 1.0f, 10);
+    std::vector<float> expected = RandomSamples(frames, 0.5f, 11);
+    for (float& peak : expected)
+      peak = std::fabs(peak);
+    std::vector<float> actual = expected;
+
+    Reference().framePeaks(expected.data(), data.data(), channels, frames);
+    Kernels().framePeaks(actual.data(), data.data(), channels, frames);
+    ExpectSame(expected, actual);
+  }
+}
+
+TEST_P(TestAEKernels, InterleaveRoundTrip)
+{
+  for (int channels : {1, 2, 6, 8})
+  {
+    const size_t frames = COUNT / channels;
+    std::vector<std::vector<float>> planes;
+    std::vector<const float*> src;
+    for (int c = 0; c < channels; ++c)
+    {
+      planes.emplace_back(RandomSamples(frames, 1.0f, 12 + c));
+      src.emplace_back(planes.back().data());
+    }
+
+    std::vector<float> expected(frames * channels);
+    std::vector<float> actual(frames * channels);
+    Reference().interleave(expected.data(), src.data(), channels, frames);
+    Kernels().interleave(actual.data(), src.data(), channels, frames);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(planes[channels - 1][frames - 1], actual.back());
+
+    std::vector<std::vector<float>> result(channels, std::vector<float>(frames));
+    std::vector<float*> dst;
+    for (auto& plane : result)
+      dst.emplace_back(plane.data());
+    Kernels().deinterleave(dst.data(), actual.data(), channels, frames);
+    EXPECT_EQ(planes, result);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Supported,
+                         TestAEKernels,
+                         ::testing::Range(0, static_cast<int>(GetTables().size())),
+                         [](const ::testing::TestParamInfo<int>& info)
+                         {
+                           std::string name = GetTables()[info.param]->name;
+                           name.erase(std::remove(name.begin(), name.end(), '-'), name.end());
+                           return name;
+                         });
@@ -16,7 +16,7 @@
 #include "cores/RetroPlayer/rendering/RPRenderManager.h"
 #include "cores/RetroPlayer/savestates/ISavestate.h"
 #include "cores/RetroPlayer/savestates/SavestateDatabase.h"
-#include "cores/RetroPlayer/streams/memory/DeltaPairMemoryStream.h"
+#include "cores/RetroPlayer/streams/memory/RunLengthMemoryStream.h"
 #include "filesystem/File.h"
 #include "games/GameServices.h"
 #include "games/GameSettings.h"
@@ -414,7 +414,7 @@ void CReversiblePlayback::UpdateMemoryStream()
 
     if (!m_memoryStream)
     {
-      m_memoryStream = std::make_unique<CDeltaPairMemoryStream>();
+      m_memoryStream = std::make_unique<CRunLengthMemoryStream>();
       m_memoryStream->Init(m_gameClient->SerializeSize(), frameCount);
     }
 
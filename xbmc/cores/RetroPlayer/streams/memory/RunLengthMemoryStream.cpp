@@ -0,0 +1,316 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RunLengthMemoryStream.h"
+
+#include "utils/log.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace KODI;
+using namespace RETRO;
+
+namespace
+{
+// A run is preceded by its header: the number of unchanged words skipped
+// since the previous run, and the number of words in the run
+constexpr size_t RunHeaderWords = 2;
+
+// Unchanged words between two runs are stored as part of one run if that's
+// no larger than the header of another run
+constexpr size_t MaxMergeGap = RunHeaderWords;
+
+// The arena starts small for cores with small states
+constexpr size_t MinArenaWords = 256 * 1024;
+
+// Return the first position from pos on where the words of a and b differ,
+// or words if there is none
+size_t FindChange(const uint32_t* a, const uint32_t* b, size_t pos, size_t words)
+{
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  // most of a state is unchanged, check 8 words at a time
+  for (; pos + 8 <= words; pos += 8)
+  {
+    const __m128i eq0 =
+        _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + pos)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + pos)));
+    const __m128i eq1 =
+        _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + pos + 4)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + pos + 4)));
+    if (_mm_movemask_epi8(_mm_and_si128(eq0, eq1)) != 0xFFFF)
+    {
+      const int mask = _mm_movemask_ps(_mm_castsi128_ps(eq0)) |
+                       (_mm_movemask_ps(_mm_castsi128_ps(eq1)) << 4);
+      return pos + std::countr_one(static_cast<unsigned int>(mask));
+    }
+  }
+#else
+  for (; pos + 2 <= words; pos += 2)
+  {
+    uint64_t va;
+    uint64_t vb;
+    std::memcpy(&va, a + pos, sizeof(va));
+    std::memcpy(&vb, b + pos, sizeof(vb));
+    if (va != vb)
+      return a[pos] != b[pos] ? pos : pos + 1;
+  }
+#endif
+
+  for (; pos < words; pos++)
+  {
+    if (a[pos] != b[pos])
+      return pos;
+  }
+  return words;
+}
+
+// Return the first position from pos on where the words of a and b are
+// equal, or words if there is none
+size_t FindEqual(const uint32_t* a, const uint32_t* b, size_t pos, size_t words)
+{
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; pos + 4 <= words; pos += 4)
+  {
+    const __m128i eq =
+        _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + pos)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + pos)));
+    const int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+    if (mask != 0)
+      return pos + std::countr_zero(static_cast<unsigned int>(mask));
+  }
+#endif
+
+  for (; pos < words; pos++)
+  {
+    if (a[pos] == b[pos])
+      return pos;
+  }
+  return words;
+}
+
+// dest[i] = a[i] ^ b[i], dest may be a
+void XorWords(uint32_t* dest, const uint32_t* a, const uint32_t* b, size_t words)
+{
+  size_t i = 0;
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; i + 4 <= words; i += 4)
+  {
+    const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_xor_si128(va, vb));
+  }
+#endif
+
+  for (; i < words; i++)
+    dest[i] = a[i] ^ b[i];
+}
+
+// Encode the runs of words that differ between from and to, returning the
+// number of words written to out
+size_t EncodeDelta(const uint32_t* from, const uint32_t* to, size_t words, uint32_t* out)
+{
+  uint32_t* const begin = out;
+  size_t previousEnd = 0;
+
+  size_t change = FindChange(from, to, 0, words);
+  while (change < words)
+  {
+    size_t end = FindEqual(from, to, change + 1, words);
+    size_t nextChange = FindChange(from, to, end, words);
+    while (nextChange < words && nextChange - end <= MaxMergeGap)
+    {
+      end = FindEqual(from, to, nextChange + 1, words);
+      nextChange = FindChange(from, to, end, words);
+    }
+
+    *out++ = static_cast<uint32_t>(change - previousEnd);
+    *out++ = static_cast<uint32_t>(end - change);
+    XorWords(out, from + change, to + change, end - change);
+    out += end - change;
+
+    previousEnd = end;
+    change = nextChange;
+  }
+
+  return static_cast<size_t>(out - begin);
+}
+
+// Apply the runs encoded by EncodeDelta() to frame
+void DecodeDelta(uint32_t* frame, const uint32_t* delta, size_t deltaWords)
+{
+  const uint32_t* const end = delta + deltaWords;
+  while (delta < end)
+  {
+    frame += delta[0];
+    const size_t length = delta[1];
+    delta += RunHeaderWords;
+
+    XorWords(frame, frame, delta, length);
+    frame += length;
+    delta += length;
+  }
+}
+} // namespace
+
+CRunLengthMemoryStream::CRunLengthMemoryStream(size_t maxArenaSize /* = DefaultMaxArenaSize */)
+  : m_maxArenaWords(maxArenaSize / sizeof(uint32_t))
+{
+}
+
+void CRunLengthMemoryStream::Reset()
+{
+  CLinearMemoryStream::Reset();
+
+  m_rewindBuffer.clear();
+  m_arena.reset();
+  m_arenaWords = 0;
+  m_encodeBuffer = {};
+}
+
+void CRunLengthMemoryStream::SubmitFrameInternal()
+{
+  const size_t frameWords = (FrameSize() + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+  // Every run holds at least one word and is followed by more than
+  // MaxMergeGap unchanged words, except for the last one
+  const size_t maxDeltaWords = frameWords + RunHeaderWords * (frameWords / (MaxMergeGap + 1) + 1);
+  if (m_encodeBuffer.size() < maxDeltaWords)
+    m_encodeBuffer.resize(maxDeltaWords);
+
+  const size_t deltaWords =
+      EncodeDelta(m_currentFrame.get(), m_nextFrame.get(), frameWords, m_encodeBuffer.data());
+
+  // Allocating may drop the oldest frames, so record the new one afterwards
+  const uint64_t offset = Allocate(deltaWords);
+  const MemoryFrame& frame =
+      m_rewindBuffer.emplace_back(MemoryFrame{offset, deltaWords, m_currentFrameHistory++});
+  std::copy_n(m_encodeBuffer.data(), deltaWords, Data(frame));
+
+  // Delta is generated, bring the new frame forward (m_nextFrame is now disposable)
+  std::swap(m_currentFrame, m_nextFrame);
+
+  m_bHasNextFrame = false;
+
+  if (PastFramesAvailable() + 1 > MaxFrameCount())
+    CullPastFrames(1);
+}
+
+uint64_t CRunLengthMemoryStream::PastFramesAvailable() const
+{
+  return static_cast<uint64_t>(m_rewindBuffer.size());
+}
+
+uint64_t CRunLengthMemoryStream::RewindFrames(uint64_t frameCount)
+{
+  uint64_t rewound;
+
+  for (rewound = 0; rewound < frameCount; rewound++)
+  {
+    if (m_rewindBuffer.empty())
+      break;
+
+    const MemoryFrame& frame = m_rewindBuffer.back();
+
+    DecodeDelta(m_currentFrame.get(), Data(frame), frame.words);
+
+    // Restore frame history
+    m_currentFrameHistory = frame.frameHistoryCount;
+
+    m_rewindBuffer.pop_back();
+  }
+
+  return rewound;
+}
+
+void CRunLengthMemoryStream::CullPastFrames(uint64_t frameCount)
+{
+  for (uint64_t removedCount = 0; removedCount < frameCount; removedCount++)
+  {
+    if (m_rewindBuffer.empty())
+    {
+      CLog::Log(LOGDEBUG,
+                "CRunLengthMemoryStream: Tried to cull {} frames too many. Check your math!",
+                frameCount - removedCount);
+      break;
+    }
+    m_rewindBuffer.pop_front();
+  }
+}
+
+uint64_t CRunLengthMemoryStream::Allocate(size_t words)
+{
+  uint64_t offset = 0;
+  while (!FindSpace(words, offset))
+  {
+    // A delta larger than the whole arena replaces all of the past frames
+    if (m_arenaWords < m_maxArenaWords || m_rewindBuffer.empty())
+      Grow(words);
+    else
+      m_rewindBuffer.pop_front();
+  }
+
+  return offset;
+}
+
+bool CRunLengthMemoryStream::FindSpace(size_t words, uint64_t& offset) const
+{
+  if (m_rewindBuffer.empty())
+  {
+    offset = 0;
+    return m_arenaWords > 0 && words <= m_arenaWords;
+  }
+
+  const uint64_t tail = m_rewindBuffer.front().offset;
+  uint64_t head = m_rewindBuffer.back().offset + m_rewindBuffer.back().words;
+
+  // A delta that doesn't fit before the end of the arena starts over at its beginning
+  const size_t position = static_cast<size_t>(head % m_arenaWords);
+  if (position + words > m_arenaWords)
+    head += m_arenaWords - position;
+
+  if (head + words - tail > m_arenaWords)
+    return false;
+
+  offset = head;
+  return true;
+}
+
+void CRunLengthMemoryStream::Grow(size_t words)
+{
+  size_t usedWords = 0;
+  for (const MemoryFrame& frame : m_rewindBuffer)
+    usedWords += frame.words;
+
+  size_t arenaWords = std::max({m_arenaWords * 2, MinArenaWords, usedWords + words});
+  arenaWords = std::min(arenaWords, std::max(m_maxArenaWords, usedWords + words));
+
+  // Compact the past frames at the beginning of the new arena
+  std::unique_ptr<uint32_t[]> arena(new uint32_t[arenaWords]);
+  uint64_t offset = 0;
+  for (MemoryFrame& frame : m_rewindBuffer)
+  {
+    std::copy_n(Data(frame), frame.words, arena.get() + offset);
+    frame.offset = offset;
+    offset += frame.words;
+  }
+
+  m_arena = std::move(arena);
+  m_arenaWords = arenaWords;
+}
+
+uint32_t* CRunLengthMemoryStream::Data(const MemoryFrame& frame) const
+{
+  return m_arena.get() + frame.offset % m_arenaWords;
+}
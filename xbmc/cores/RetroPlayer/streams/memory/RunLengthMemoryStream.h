@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "LinearMemoryStream.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace KODI
+{
+namespace RETRO
+{
+/*!
+ * \brief Implementation of a linear memory stream using run-length encoded
+ *        XOR deltas, stored in a ring arena
+ *
+ * Like CDeltaPairMemoryStream, a frame is stored as the XOR delta to the
+ * frame after it. Instead of a position for every changed word, the delta
+ * is stored as runs of changed words, each with a header holding the number
+ * of unchanged words skipped before it and its length. A changed word costs
+ * 4 bytes instead of 16.
+ *
+ * The deltas of all frames live in one arena, which is used as a ring
+ * buffer. It grows up to the given size, after which the oldest frames
+ * make room for new ones.
+ */
+class CRunLengthMemoryStream : public CLinearMemoryStream
+{
+public:
+  static constexpr size_t DefaultMaxArenaSize = 64 * 1024 * 1024;
+
+  /*!
+   * \param maxArenaSize The size in bytes the deltas of past frames may use
+   */
+  explicit CRunLengthMemoryStream(size_t maxArenaSize = DefaultMaxArenaSize);
+
+  ~CRunLengthMemoryStream() override = default;
+
+  // implementation of IMemoryStream via CLinearMemoryStream
+  void Reset() override;
+  uint64_t PastFramesAvailable() const override;
+  uint64_t RewindFrames(uint64_t frameCount) override;
+
+protected:
+  // implementation of CLinearMemoryStream
+  void SubmitFrameInternal() override;
+  void CullPastFrames(uint64_t frameCount) override;
+
+private:
+  /*!
+   * Offsets count words in a virtual arena that is unrolled: the word at
+   * offset lives at offset % m_arenaWords. The words of a frame are never
+   * split at the end of the arena.
+   */
+  struct MemoryFrame
+  {
+    uint64_t offset;
+    size_t words;
+    uint64_t frameHistoryCount;
+  };
+
+  uint64_t Allocate(size_t words);
+  bool FindSpace(size_t words, uint64_t& offset) const;
+  void Grow(size_t words);
+  uint32_t* Data(const MemoryFrame& frame) const;
+
+  const size_t m_maxArenaWords;
+  std::unique_ptr<uint32_t[]> m_arena;
+  size_t m_arenaWords = 0;
+  std::deque<MemoryFrame> m_rewindBuffer;
+  std::vector<uint32_t> m_encodeBuffer;
+};
+} // namespace RETRO
+} // namespace KODI
@@ -0,0 +1,214 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/RetroPlayer/streams/memory/DeltaPairMemoryStream.h"
+#include "cores/RetroPlayer/streams/memory/RunLengthMemoryStream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI;
+using namespace RETRO;
+
+namespace
+{
+constexpr uint64_t MAX_FRAME_COUNT = 200;
+
+/*!
+ * \brief Generates game states that change a few scattered words, a few
+ *        clustered blocks or most of the state from one frame to the next
+ */
+class CStateGenerator
+{
+public:
+  explicit CStateGenerator(size_t frameSize) : m_state(frameSize)
+  {
+    for (uint8_t& byte : m_state)
+      byte = static_cast<uint8_t>(m_rng());
+  }
+
+  const std::vector<uint8_t>& Next()
+  {
+    const size_t size = m_state.size();
+    switch (m_rng() % 4)
+    {
+      case 0:
+        // most of the state
+        for (size_t i = 0; i < size; i++)
+        {
+          if (m_rng() % 4 != 0)
+            m_state[i] = static_cast<uint8_t>(m_rng());
+        }
+        break;
+      case 1:
+      {
+        // a block, long enough to span several runs
+        const size_t start = m_rng() % size;
+        const size_t length = std::min<size_t>(size - start, m_rng() % 300);
+        for (size_t i = start; i < start + length; i++)
+          m_state[i] = static_cast<uint8_t>(m_rng());
+        break;
+      }
+      default:
+      {
+        // scattered bytes, some of them close enough to be merged into one run
+        const unsigned int changes = m_rng() % 8;
+        for (unsigned int i = 0; i < changes; i++)
+          m_state[m_rng() % size] = static_cast<uint8_t>(m_rng());
+        break;
+      }
+    }
+    return m_state;
+  }
+
+  void Set(const uint8_t* state) { std::memcpy(m_state.data(), state, m_state.size()); }
+
+  unsigned int Random() { return m_rng(); }
+
+private:
+  std::vector<uint8_t> m_state;
+  std::mt19937 m_rng{1};
+};
+
+void Submit(IMemoryStream& stream, const std::vector<uint8_t>& state)
+{
+  std::memcpy(stream.BeginFrame(), state.data(), state.size());
+  stream.SubmitFrame();
+}
+
+struct TestParams
+{
+  size_t frameSize;
+  size_t maxArenaSize;
+};
+
+class TestRunLengthMemoryStream : public testing::TestWithParam<TestParams>
+{
+};
+} // namespace
+
+// With an arena large enough for all frames, the stream must behave exactly
+// like CDeltaPairMemoryStream
+TEST(TestRunLengthMemoryStream, MatchesDeltaPairMemoryStream)
+{
+  for (size_t frameSize : {1, 3, 7, 64, 1001, 100000})
+  {
+    CDeltaPairMemoryStream reference;
+    CRunLengthMemoryStream stream;
+    reference.Init(frameSize, MAX_FRAME_COUNT);
+    stream.Init(frameSize, MAX_FRAME_COUNT);
+
+    CStateGenerator generator(frameSize);
+    for (int step = 0; step < 1000; step++)
+    {
+      const unsigned int operation = generator.Random() % 10;
+      if (operation < 7)
+      {
+        const std::vector<uint8_t>& state = generator.Next();
+        Submit(reference, state);
+        Submit(stream, state);
+      }
+      else if (operation < 9)
+      {
+        const uint64_t frameCount = generator.Random() % 20;
+        ASSERT_EQ(reference.RewindFrames(frameCount), stream.RewindFrames(frameCount));
+        if (reference.CurrentFrame() == nullptr)
+          continue;
+        ASSERT_NE(nullptr, stream.CurrentFrame());
+        ASSERT_EQ(0, std::memcmp(reference.CurrentFrame(), stream.CurrentFrame(), frameSize))
+            << "frame size " << frameSize << ", step " << step;
+        ASSERT_EQ(reference.GetFrameCounter(), stream.GetFrameCounter());
+        generator.Set(stream.CurrentFrame());
+      }
+      else
+      {
+        const uint64_t maxFrameCount = 1 + generator.Random() % 300;
+        reference.SetMaxFrameCount(maxFrameCount);
+        stream.SetMaxFrameCount(maxFrameCount);
+      }
+      ASSERT_EQ(reference.PastFramesAvailable(), stream.PastFramesAvailable());
+    }
+  }
+}
+
+// With a small arena the deltas wrap around its end, the arena grows and
+// compacts up to its size, and then the oldest frames are dropped. Every
+// frame still held must be restored exactly.
+TEST_P(TestRunLengthMemoryStream, RewindsHeldFrames)
+{
+  const TestParams& params = GetParam();
+
+  CRunLengthMemoryStream stream(params.maxArenaSize);
+  stream.Init(params.frameSize, MAX_FRAME_COUNT);
+
+  CStateGenerator generator(params.frameSize);
+  std::vector<std::vector<uint8_t>> history;
+  bool evicted = false;
+
+  for (int step = 0; step < 2000; step++)
+  {
+    if (generator.Random() % 10 < 8)
+    {
+      history.emplace_back(generator.Next());
+      Submit(stream, history.back());
+
+      // the current frame doesn't count towards the past frames
+      const uint64_t maxPastFrames = std::min<uint64_t>(history.size(), MAX_FRAME_COUNT) - 1;
+      const uint64_t pastFrames = stream.PastFramesAvailable();
+      ASSERT_LE(pastFrames, maxPastFrames);
+      if (pastFrames < maxPastFrames)
+        evicted = true;
+    }
+    else
+    {
+      const uint64_t pastFrames = stream.PastFramesAvailable();
+      const uint64_t frameCount = generator.Random() % 20;
+      const uint64_t rewound = stream.RewindFrames(frameCount);
+      ASSERT_EQ(std::min(frameCount, pastFrames), rewound);
+      ASSERT_EQ(pastFrames - rewound, stream.PastFramesAvailable());
+
+      history.resize(history.size() - rewound);
+      if (history.empty())
+        continue;
+
+      ASSERT_NE(nullptr, stream.CurrentFrame());
+      ASSERT_EQ(0, std::memcmp(history.back().data(), stream.CurrentFrame(), params.frameSize))
+          << "step " << step;
+      generator.Set(stream.CurrentFrame());
+    }
+  }
+
+  // rewinding everything that is held ends at the oldest frame still held
+  const uint64_t pastFrames = stream.PastFramesAvailable();
+  ASSERT_EQ(pastFrames, stream.RewindFrames(pastFrames + 1));
+  ASSERT_EQ(0u, stream.PastFramesAvailable());
+  ASSERT_GE(history.size(), pastFrames + 1);
+  EXPECT_EQ(0, std::memcmp(history[history.size() - 1 - pastFrames].data(),
+                           stream.CurrentFrame(), params.frameSize));
+
+  if (params.maxArenaSize < params.frameSize * MAX_FRAME_COUNT / 4)
+    EXPECT_TRUE(evicted);
+}
+
+namespace
+{
+// Frames of more than a few words don't fit into the smallest arenas at all,
+// each of them then replaces the frames before it
+const TestParams Params[] = {
+    {7, 64},         {64, 64},          {64, 4096},          {1001, 4096},
+    {1001, 65536},   {100000, 65536},   {100000, 1048576},
+};
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(RunLengthMemoryStream,
+                         TestRunLengthMemoryStream,
+                         testing::ValuesIn(Params));
@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DemuxPacketPool.h"
+
+#include "utils/MemUtils.h"
+
+#include <cstring>
+#include <mutex>
+#include <new>
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+}
+
+struct CDemuxPacketPool::PooledPacket : DemuxPacket
+{
+  int sizeClass{-1}; //!< size class of pData, -1 if it was allocated outside of the classes
+};
+
+CDemuxPacketPool& CDemuxPacketPool::GetInstance()
+{
+  static CDemuxPacketPool pool;
+  return pool;
+}
+
+CDemuxPacketPool::~CDemuxPacketPool()
+{
+  Trim();
+}
+
+int CDemuxPacketPool::GetSizeClass(size_t size)
+{
+  for (unsigned int shift = MIN_CLASS_SHIFT; shift <= MAX_CLASS_SHIFT; ++shift)
+  {
+    if (size <= (static_cast<size_t>(1) << shift))
+      return static_cast<int>(shift - MIN_CLASS_SHIFT);
+  }
+  return -1;
+}
+
+DemuxPacket* CDemuxPacketPool::Allocate(int dataSize)
+{
+  const size_t bufferSize =
+      dataSize > 0 ? static_cast<size_t>(dataSize) + AV_INPUT_BUFFER_PADDING_SIZE : 0;
+  const int sizeClass = bufferSize > 0 ? GetSizeClass(bufferSize) : -1;
+
+  PooledPacket* packet = nullptr;
+  uint8_t* data = nullptr;
+  {
+    std::unique_lock lock(m_critSection);
+    if (!m_freePackets.empty())
+    {
+      packet = m_freePackets.back();
+      m_freePackets.pop_back();
+    }
+    if (sizeClass >= 0 && !m_freeBuffers[sizeClass].empty())
+    {
+      data = m_freeBuffers[sizeClass].back();
+      m_freeBuffers[sizeClass].pop_back();
+      m_cachedBytes -= static_cast<size_t>(1) << (sizeClass + MIN_CLASS_SHIFT);
+    }
+  }
+
+  bool hit = true;
+  if (packet)
+  {
+    *packet = PooledPacket();
+  }
+  else
+  {
+    hit = false;
+    packet = new (std::nothrow) PooledPacket();
+    if (!packet)
+    {
+      KODI::MEMORY::AlignedFree(data);
+      return nullptr;
+    }
+  }
+
+  if (bufferSize > 0)
+  {
+    if (!data)
+    {
+      hit = false;
+      const size_t allocSize =
+          sizeClass >= 0 ? static_cast<size_t>(1) << (sizeClass + MIN_CLASS_SHIFT) : bufferSize;
+      data = static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(allocSize, 16));
+      if (!data)
+      {
+        Release(packet);
+        return nullptr;
+      }
+    }
+
+    // Required number of additionally allocated bytes at the end of the input bitstream for
+    // decoding, see AV_INPUT_BUFFER_PADDING_SIZE in avcodec.h
+    memset(data + dataSize, 0, AV_INPUT_BUFFER_PADDING_SIZE);
+    packet->pData = data;
+    packet->sizeClass = sizeClass;
+  }
+
+  if (hit)
+    m_hits++;
+  else
+    m_misses++;
+
+  return packet;
+}
+
+void CDemuxPacketPool::Release(DemuxPacket* packet)
+{
+  if (!packet)
+    return;
+
+  PooledPacket* pooled = static_cast<PooledPacket*>(packet);
+  uint8_t* data = pooled->pData;
+  const int sizeClass = pooled->sizeClass;
+  pooled->pData = nullptr;
+
+  {
+    std::unique_lock lock(m_critSection);
+    if (data && sizeClass >= 0)
+    {
+      const size_t classSize = static_cast<size_t>(1) << (sizeClass + MIN_CLASS_SHIFT);
+      if (m_cachedBytes + classSize <= MAX_CACHED_BYTES)
+      {
+        m_freeBuffers[sizeClass].push_back(data);
+        m_cachedBytes += classSize;
+        data = nullptr;
+      }
+    }
+    if (m_freePackets.size() < MAX_CACHED_PACKETS)
+    {
+      m_freePackets.push_back(pooled);
+      pooled = nullptr;
+    }
+  }
+
+  if (data)
+    KODI::MEMORY::AlignedFree(data);
+  delete pooled;
+}
+
+void CDemuxPacketPool::Trim()
+{
+  std::array<std::vector<uint8_t*>, NUM_CLASSES> buffers;
+  std::vector<PooledPacket*> packets;
+  {
+    std::unique_lock lock(m_critSection);
+    buffers.swap(m_freeBuffers);
+    packets.swap(m_freePackets);
+    m_cachedBytes = 0;
+  }
+
+  for (const auto& sizeClass : buffers)
+  {
+    for (uint8_t* data : sizeClass)
+      KODI::MEMORY::AlignedFree(data);
+  }
+  for (PooledPacket* packet : packets)
+    delete packet;
+}
+
+CDemuxPacketPool::Stats CDemuxPacketPool::GetStats() const
+{
+  Stats stats;
+  stats.hits = m_hits;
+  stats.misses = m_misses;
+
+  std::unique_lock lock(m_critSection);
+  stats.cachedBytes = m_cachedBytes;
+  stats.cachedPackets = m_freePackets.size();
+  return stats;
+}
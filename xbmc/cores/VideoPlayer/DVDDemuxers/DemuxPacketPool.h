@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief Process wide recycler for DemuxPacket headers and payload buffers.
+ *
+ * Payloads are rounded up to power of two size classes so a returned buffer can serve any later
+ * request of the same class. Payloads larger than the biggest class and anything above the
+ * configured budget are released to the heap as before. All packets handed out by
+ * CDVDDemuxUtils::AllocateDemuxPacket come from here, so demuxers, the inputstream addon
+ * callbacks and PVR clients share the same pool.
+ */
+class CDemuxPacketPool
+{
+public:
+  struct Stats
+  {
+    uint64_t hits{0}; //!< allocations served from recycled memory
+    uint64_t misses{0}; //!< allocations that had to go to the heap
+    size_t cachedBytes{0}; //!< payload bytes currently held for reuse
+    size_t cachedPackets{0}; //!< packet headers currently held for reuse
+  };
+
+  static CDemuxPacketPool& GetInstance();
+
+  /*!
+   * \brief Get a reset packet with room for dataSize bytes plus the ffmpeg input padding.
+   * \param dataSize payload size, 0 for a packet without payload
+   * \return packet or nullptr if memory could not be allocated
+   */
+  DemuxPacket* Allocate(int dataSize);
+
+  /*!
+   * \brief Return header and payload of a packet obtained from Allocate().
+   * \note Side data and crypto info are owned by the caller and must be released before.
+   */
+  void Release(DemuxPacket* packet);
+
+  /*!
+   * \brief Drop all cached memory, e.g. when playback ends.
+   */
+  void Trim();
+
+  Stats GetStats() const;
+
+private:
+  CDemuxPacketPool() = default;
+  ~CDemuxPacketPool();
+  CDemuxPacketPool(const CDemuxPacketPool&) = delete;
+  CDemuxPacketPool& operator=(const CDemuxPacketPool&) = delete;
+
+  static constexpr unsigned int MIN_CLASS_SHIFT = 10; // 1 KiB
+  static constexpr unsigned int MAX_CLASS_SHIFT = 22; // 4 MiB
+  static constexpr size_t NUM_CLASSES = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+  static constexpr size_t MAX_CACHED_BYTES = 64 * 1024 * 1024;
+  static constexpr size_t MAX_CACHED_PACKETS = 2048;
+
+  struct PooledPacket;
+
+  static int GetSizeClass(size_t size);
+
+  mutable CCriticalSection m_critSection;
+  std::array<std::vector<uint8_t*>, NUM_CLASSES> m_freeBuffers;
+  std::vector<PooledPacket*> m_freePackets;
+  size_t m_cachedBytes{0};
+
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+};
@@ -17,9 +17,26 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+double GetPacketTime(const std::shared_ptr<CDVDMsg>& msg)
+{
+  if (msg && msg->IsType(CDVDMsg::DEMUXER_PACKET))
+  {
+    DemuxPacket* packet = std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket();
+    if (packet)
+    {
+      if (packet->dts != DVD_NOPTS_VALUE)
+        return packet->dts;
+      return packet->pts;
+    }
+  }
+  return DVD_NOPTS_VALUE;
+}
+} // namespace
+
 CDVDMessageQueue::CDVDMessageQueue(const std::string &owner) : m_hEvent(true), m_owner(owner)
 {
-  m_iDataSize     = 0;
   m_bInitialized = false;
 
   m_TimeBack = DVD_NOPTS_VALUE;
@@ -32,13 +49,34 @@ CDVDMessageQueue::~CDVDMessageQueue()
 {
   // remove all remaining messages
   Flush(CDVDMsg::NONE);
+  DrainRing();
+}
+
+void CDVDMessageQueue::SetRingSize(unsigned int slots)
+{
+  std::unique_lock lock(m_section);
+
+  DrainRing();
+  m_ring.reset();
+  m_ringMask = 0;
+
+  if (slots == 0)
+    return;
+
+  uint64_t size = 1;
+  while (size < slots)
+    size <<= 1;
+
+  m_ring = std::make_unique<RingSlot[]>(size);
+  m_ringMask = size - 1;
 }
 
 void CDVDMessageQueue::Init()
 {
-  m_iDataSize = 0;
+  ResetDataSize();
   m_bAbortRequest = false;
   m_bInitialized = true;
+  m_lockedCount = 0;
   m_TimeBack = DVD_NOPTS_VALUE;
   m_TimeFront = DVD_NOPTS_VALUE;
   m_drain = false;
@@ -56,9 +94,26 @@ void CDVDMessageQueue::Flush(CDVDMsg::Message type)
     return type == CDVDMsg::NONE || item.message->IsType(type);
   });
 
+  if (m_ring)
+  {
+    m_spillMessages.remove_if([type](const DVDMessageListItem& item) {
+      return type == CDVDMsg::NONE || item.message->IsType(type);
+    });
+    m_spillCount = static_cast<int>(m_spillMessages.size());
+    m_lockedCount = static_cast<int>(m_messages.size() + m_prioMessages.size());
+
+    // the consumer owns the ring slots, let it drop what has been flushed when it gets there
+    const uint64_t head = m_ringHead;
+    if (head != m_ringTail)
+    {
+      m_flushFilters.emplace_back(head, type);
+      m_ringFlushed = head;
+    }
+  }
+
   if (type == CDVDMsg::DEMUXER_PACKET ||  type == CDVDMsg::NONE)
   {
-    m_iDataSize = 0;
+    ResetDataSize();
     m_TimeBack = DVD_NOPTS_VALUE;
     m_TimeFront = DVD_NOPTS_VALUE;
   }
@@ -79,9 +134,10 @@ void CDVDMessageQueue::End()
   std::unique_lock lock(m_section);
 
   Flush(CDVDMsg::NONE);
+  DrainRing();
 
   m_bInitialized = false;
-  m_iDataSize = 0;
+  ResetDataSize();
   m_bAbortRequest = false;
 }
 
@@ -99,6 +155,18 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
                                          int priority,
                                          bool front)
 {
+  if (m_ring && priority == 0 && front && pMsg && m_bInitialized)
+  {
+    int size = 0;
+    if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET))
+    {
+      DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(pMsg.get())->GetPacket();
+      if (packet)
+        size = packet->iSize;
+    }
+    return PutRing(pMsg, size);
+  }
+
   std::unique_lock lock(m_section);
 
   if (!m_bInitialized)
@@ -123,12 +191,20 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
                              return prio <= item.priority;
                            });
     m_prioMessages.emplace(it, pMsg, priority);
+    if (m_ring)
+      m_lockedCount++;
+  }
+  else if (m_ring)
+  {
+    // only PutBack() gets here, the message goes in front of the ring
+    m_messages.emplace_back(pMsg, priority);
+    m_lockedCount++;
   }
   else
   {
     if (m_messages.empty())
     {
-      m_iDataSize = 0;
+      ResetDataSize();
       m_TimeBack = DVD_NOPTS_VALUE;
       m_TimeFront = DVD_NOPTS_VALUE;
     }
@@ -144,8 +220,18 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(pMsg.get())->GetPacket();
     if (packet)
     {
-      m_iDataSize += packet->iSize;
-      if (front)
+      AddDataSize(packet->iSize);
+      if (m_ring)
+      {
+        const double time = GetPacketTime(pMsg);
+        if (time != DVD_NOPTS_VALUE)
+        {
+          m_TimeBack = time;
+          if (m_TimeFront == DVD_NOPTS_VALUE)
+            m_TimeFront = time;
+        }
+      }
+      else if (front)
         UpdateTimeFront();
       else
         UpdateTimeBack();
@@ -162,6 +248,9 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
                                          std::chrono::milliseconds timeout,
                                          int& priority)
 {
+  if (m_ring)
+    return GetRing(pMsg, timeout, priority);
+
   std::unique_lock lock(m_section);
 
   int ret = 0;
@@ -174,7 +263,9 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
+    // while draining, normal messages are delivered to priority consumers as well
+    std::list<DVDMessageListItem>& msgs =
+        (!m_prioMessages.empty() || (priority > 0 && !m_drain)) ? m_prioMessages : m_messages;
 
     if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
     {
@@ -187,7 +278,7 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
             std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
         if (packet)
         {
-          m_iDataSize -= packet->iSize;
+          SubtractDataSize(packet->iSize);
         }
       }
 
@@ -221,6 +312,270 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
   return (MsgQueueReturnCode)ret;
 }
 
+MsgQueueReturnCode CDVDMessageQueue::PutRing(const std::shared_ptr<CDVDMsg>& pMsg, int size)
+{
+  const uint64_t head = m_ringHead.load(std::memory_order_relaxed);
+  const uint64_t tail = m_ringTail.load(std::memory_order_acquire);
+
+  if (head == tail && m_spillCount == 0)
+  {
+    m_TimeBack = DVD_NOPTS_VALUE;
+    m_TimeFront = DVD_NOPTS_VALUE;
+  }
+
+  if (head - tail > m_ringMask || m_spillCount > 0)
+  {
+    // ring is full, keep order by queueing behind it until the consumer caught up
+    std::unique_lock lock(m_section);
+    AddDataSize(size);
+    m_spillMessages.emplace_front(pMsg, 0);
+    m_spillCount++;
+  }
+  else
+  {
+    // account before publishing, the consumer subtracts as soon as it sees the message
+    RingSlot& slot = m_ring[head & m_ringMask];
+    slot.message = pMsg;
+    slot.size = size;
+    slot.generation = AddDataSize(size);
+    slot.type.store(pMsg->GetMessageType(), std::memory_order_relaxed);
+    m_ringHead.store(head + 1);
+  }
+
+  const double time = GetPacketTime(pMsg);
+  if (time != DVD_NOPTS_VALUE)
+  {
+    m_TimeFront = time;
+    if (m_TimeBack == DVD_NOPTS_VALUE)
+      m_TimeBack = time;
+  }
+
+  // inform waiter for new packet, only pay for the event if the consumer sleeps
+  if (m_waiting)
+    m_hEvent.Set();
+
+  return MSGQ_OK;
+}
+
+MsgQueueReturnCode CDVDMessageQueue::GetRing(std::shared_ptr<CDVDMsg>& pMsg,
+                                             std::chrono::milliseconds timeout,
+                                             int& priority)
+{
+  if (!m_bInitialized)
+  {
+    CLog::Log(LOGFATAL, "CDVDMessageQueue({})::Get MSGQ_NOT_INITIALIZED", m_owner);
+    return MSGQ_NOT_INITIALIZED;
+  }
+
+  while (!m_bAbortRequest)
+  {
+    if (priority > 0 || m_lockedCount > 0)
+    {
+      std::unique_lock lock(m_section);
+      if (PopLocked(pMsg, priority))
+        return MSGQ_OK;
+    }
+
+    // ring messages have no priority, but draining delivers them to any consumer
+    if ((priority == 0 || m_drain) && PopRing(pMsg))
+    {
+      priority = 0;
+      return MSGQ_OK;
+    }
+
+    if (timeout == 0ms)
+      return MSGQ_TIMEOUT;
+
+    // announce that we are going to sleep before checking again, PutRing only signals the
+    // event if it sees m_waiting
+    m_waiting = true;
+    {
+      std::unique_lock lock(m_section);
+      m_hEvent.Reset();
+      if (PopLocked(pMsg, priority))
+      {
+        m_waiting = false;
+        return MSGQ_OK;
+      }
+    }
+    if ((priority == 0 || m_drain) && PopRing(pMsg))
+    {
+      m_waiting = false;
+      priority = 0;
+      return MSGQ_OK;
+    }
+
+    // wait for a new message
+    const bool signaled = m_hEvent.Wait(timeout);
+    m_waiting = false;
+    if (!signaled)
+      return MSGQ_TIMEOUT;
+  }
+
+  return MSGQ_ABORT;
+}
+
+uint32_t CDVDMessageQueue::AddDataSize(int size)
+{
+  uint64_t value = m_dataSize;
+  while (!m_dataSize.compare_exchange_weak(
+      value, (value & 0xffffffff00000000) |
+                 static_cast<uint32_t>(static_cast<int32_t>(value & 0xffffffff) + size)))
+  {
+  }
+  return static_cast<uint32_t>(value >> 32);
+}
+
+void CDVDMessageQueue::SubtractDataSize(int size, uint32_t generation)
+{
+  uint64_t value = m_dataSize;
+  do
+  {
+    if (static_cast<uint32_t>(value >> 32) != generation)
+      return;
+  } while (!m_dataSize.compare_exchange_weak(
+      value, (value & 0xffffffff00000000) |
+                 static_cast<uint32_t>(static_cast<int32_t>(value & 0xffffffff) - size)));
+}
+
+void CDVDMessageQueue::SubtractDataSize(int size)
+{
+  SubtractDataSize(size, static_cast<uint32_t>(m_dataSize >> 32));
+}
+
+void CDVDMessageQueue::ResetDataSize()
+{
+  m_dataSize = (m_dataSize & 0xffffffff00000000) + 0x100000000;
+}
+
+bool CDVDMessageQueue::PopLocked(std::shared_ptr<CDVDMsg>& pMsg, int& priority)
+{
+  std::list<DVDMessageListItem>& msgs =
+      (!m_prioMessages.empty() || (priority > 0 && !m_drain)) ? m_prioMessages : m_messages;
+
+  if (msgs.empty() || (msgs.back().priority < priority && !m_drain))
+    return false;
+
+  DVDMessageListItem& item(msgs.back());
+  priority = item.priority;
+
+  if (item.message->IsType(CDVDMsg::DEMUXER_PACKET) && item.priority == 0)
+  {
+    DemuxPacket* packet =
+        std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+    if (packet)
+      SubtractDataSize(packet->iSize);
+  }
+
+  pMsg = std::move(item.message);
+  msgs.pop_back();
+  m_lockedCount--;
+  UpdateTimeBackRing();
+  return true;
+}
+
+bool CDVDMessageQueue::PopRing(std::shared_ptr<CDVDMsg>& pMsg)
+{
+  while (true)
+  {
+    const uint64_t tail = m_ringTail.load(std::memory_order_relaxed);
+    if (tail == m_ringHead.load())
+    {
+      if (m_spillCount == 0)
+        return false;
+
+      std::unique_lock lock(m_section);
+      // the producer does not write to the ring while there is spill, check again under lock
+      if (tail != m_ringHead.load() || m_spillMessages.empty())
+        continue;
+
+      DVDMessageListItem& item(m_spillMessages.back());
+      if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
+      {
+        DemuxPacket* packet =
+            std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
+        if (packet)
+          SubtractDataSize(packet->iSize);
+      }
+      pMsg = std::move(item.message);
+      m_spillMessages.pop_back();
+      m_spillCount--;
+      UpdateTimeBackRing();
+      return true;
+    }
+
+    RingSlot& slot = m_ring[tail & m_ringMask];
+    std::shared_ptr<CDVDMsg> msg = std::move(slot.message);
+    const int size = slot.size;
+    const uint32_t generation = slot.generation;
+    m_ringTail.store(tail + 1, std::memory_order_release);
+
+    if (tail < m_ringFlushed && IsFlushed(tail, msg->GetMessageType()))
+      continue;
+
+    SubtractDataSize(size, generation);
+    pMsg = std::move(msg);
+    UpdateTimeBackRing();
+    return true;
+  }
+}
+
+bool CDVDMessageQueue::IsFlushed(uint64_t pos, CDVDMsg::Message type)
+{
+  std::unique_lock lock(m_section);
+
+  bool flushed = false;
+  for (const auto& [end, flushType] : m_flushFilters)
+  {
+    if (pos < end && (flushType == CDVDMsg::NONE || flushType == type))
+    {
+      flushed = true;
+      break;
+    }
+  }
+
+  // all flushed slots have been seen
+  if (pos + 1 >= m_ringFlushed)
+    m_flushFilters.clear();
+
+  return flushed;
+}
+
+void CDVDMessageQueue::UpdateTimeBackRing()
+{
+  std::shared_ptr<CDVDMsg> next;
+  const uint64_t tail = m_ringTail.load(std::memory_order_relaxed);
+  if (tail != m_ringHead.load())
+    next = m_ring[tail & m_ringMask].message;
+
+  const double time = GetPacketTime(next);
+  if (time != DVD_NOPTS_VALUE)
+  {
+    m_TimeBack = time;
+    if (m_TimeFront == DVD_NOPTS_VALUE)
+      m_TimeFront = time;
+  }
+}
+
+void CDVDMessageQueue::DrainRing()
+{
+  if (!m_ring)
+    return;
+
+  // only called when the consumer is gone, so we may touch the slots
+  uint64_t tail = m_ringTail;
+  const uint64_t head = m_ringHead;
+  for (; tail != head; ++tail)
+    m_ring[tail & m_ringMask].message.reset();
+  m_ringTail = tail;
+
+  std::unique_lock lock(m_section);
+  m_spillMessages.clear();
+  m_spillCount = 0;
+  m_flushFilters.clear();
+  m_ringFlushed = 0;
+}
+
 void CDVDMessageQueue::UpdateTimeFront()
 {
   if (!m_messages.empty())
@@ -238,7 +593,7 @@ void CDVDMessageQueue::UpdateTimeFront()
           m_TimeFront = packet->pts;
 
         if (m_TimeBack == DVD_NOPTS_VALUE)
-          m_TimeBack = m_TimeFront;
+          m_TimeBack = m_TimeFront.load();
       }
     }
   }
@@ -261,7 +616,7 @@ void CDVDMessageQueue::UpdateTimeBack()
           m_TimeBack = packet->pts;
 
         if (m_TimeFront == DVD_NOPTS_VALUE)
-          m_TimeFront = m_TimeBack;
+          m_TimeFront = m_TimeBack.load();
       }
     }
   }
@@ -286,6 +641,32 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
       count++;
   }
 
+  if (m_ring)
+  {
+    for (const auto& item : m_spillMessages)
+    {
+      if (item.message->IsType(type))
+        count++;
+    }
+
+    // slots are read without owning them, the result is a snapshot
+    const uint64_t head = m_ringHead;
+    for (uint64_t pos = m_ringTail; pos < head; ++pos)
+    {
+      if (m_ring[pos & m_ringMask].type.load(std::memory_order_relaxed) != type)
+        continue;
+
+      bool flushed = false;
+      for (const auto& [end, flushType] : m_flushFilters)
+      {
+        if (pos < end && (flushType == CDVDMsg::NONE || flushType == type))
+          flushed = true;
+      }
+      if (!flushed)
+        count++;
+    }
+  }
+
   return count;
 }
 
@@ -309,22 +690,22 @@ void CDVDMessageQueue::WaitUntilEmpty()
 
 int CDVDMessageQueue::GetLevel() const
 {
-  std::unique_lock lock(m_section);
-
-  if (m_iDataSize > m_iMaxDataSize)
+  // no lock needed, the accounting is atomic and this is polled from both ends of the queue
+  const int dataSize = GetDataSize();
+  if (dataSize > m_iMaxDataSize)
     return 100;
-  if (m_iDataSize == 0)
+  if (dataSize == 0)
     return 0;
 
   if (IsDataBased())
   {
-    return std::min(100, 100 * m_iDataSize / m_iMaxDataSize);
+    return std::min(100, 100 * dataSize / m_iMaxDataSize);
   }
 
   int level = std::min(100.0, ceil(100.0 * m_TimeSize * (m_TimeFront - m_TimeBack) / DVD_TIME_BASE ));
 
   // if we added lots of packets with NOPTS, make sure that the queue is not signalled empty
-  if (level == 0 && m_iDataSize != 0)
+  if (level == 0 && dataSize != 0)
   {
     CLog::Log(LOGDEBUG, "CDVDMessageQueue::GetLevel() - can't determine level");
     return 1;
@@ -335,8 +716,6 @@ int CDVDMessageQueue::GetLevel() const
 
 double CDVDMessageQueue::GetTimeSize() const
 {
-  std::unique_lock lock(m_section);
-
   if (IsDataBased())
     return 0.0;
   else
@@ -15,7 +15,10 @@
 #include <algorithm>
 #include <atomic>
 #include <list>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 struct DVDMessageListItem
 {
@@ -73,7 +76,7 @@ public:
     return Get(pMsg, timeout, priority);
   }
 
-  int GetDataSize() const { return m_iDataSize; }
+  int GetDataSize() const { return static_cast<int32_t>(m_dataSize.load() & 0xffffffff); }
   double GetTimeSize() const;
   unsigned GetPacketCount(CDVDMsg::Message type);
   bool ReceivedAbortRequest() { return m_bAbortRequest; }
@@ -83,6 +86,17 @@ public:
   bool IsFull() const { return GetLevel() == 100; }
   int GetLevel() const;
 
+  /*!
+   * \brief Keep normal priority messages in a lock free ring buffer of the given number of slots
+   * instead of the locked list. Must be called before Init(), 0 switches back to the list.
+   *
+   * In this mode normal priority messages must be put by a single thread (the demuxer thread)
+   * and Get()/PutBack() must only be called by the thread owning the queue. Priority messages,
+   * PutBack() and ring overflow still go through the locked lists. Flush() from the producer
+   * side is applied lazily: flushed messages are dropped by the consumer when it reaches them,
+   * while the data size and time level are reset immediately.
+   */
+  void SetRingSize(unsigned int slots);
   void SetMaxDataSize(int iMaxDataSize) { m_iMaxDataSize = iMaxDataSize; }
   void SetMaxTimeSize(double sec) { m_TimeSize = 1.0 / sec; }
   int GetMaxDataSize() const { return m_iMaxDataSize; }
@@ -91,20 +105,44 @@ public:
   bool IsDataBased() const;
 
 private:
+  struct RingSlot
+  {
+    std::shared_ptr<CDVDMsg> message;
+    std::atomic<CDVDMsg::Message> type{CDVDMsg::NONE};
+    int size{0}; // bytes accounted in m_dataSize
+    uint32_t generation{0}; // data size generation the bytes were accounted in
+  };
+
   MsgQueueReturnCode Put(const std::shared_ptr<CDVDMsg>& pMsg, int priority, bool front);
   void UpdateTimeFront();
   void UpdateTimeBack();
 
+  MsgQueueReturnCode PutRing(const std::shared_ptr<CDVDMsg>& pMsg, int size);
+  MsgQueueReturnCode GetRing(std::shared_ptr<CDVDMsg>& pMsg,
+                             std::chrono::milliseconds timeout,
+                             int& priority);
+  uint32_t AddDataSize(int size);
+  void SubtractDataSize(int size, uint32_t generation);
+  void SubtractDataSize(int size);
+  void ResetDataSize();
+  bool PopLocked(std::shared_ptr<CDVDMsg>& pMsg, int& priority);
+  bool PopRing(std::shared_ptr<CDVDMsg>& pMsg);
+  bool IsFlushed(uint64_t pos, CDVDMsg::Message type);
+  void UpdateTimeBackRing();
+  void DrainRing();
+
   CEvent m_hEvent;
   mutable CCriticalSection m_section;
 
   std::atomic<bool> m_bAbortRequest = false;
   bool m_bInitialized;
-  bool m_drain = false;
+  std::atomic<bool> m_drain = false;
 
-  int m_iDataSize;
-  double m_TimeFront;
-  double m_TimeBack;
+  // bytes of queued packets in the low 32 bits, the high 32 bits count resets so that a consumer
+  // racing with Flush() never takes off bytes that have already been dropped
+  std::atomic<uint64_t> m_dataSize{0};
+  std::atomic<double> m_TimeFront;
+  std::atomic<double> m_TimeBack;
   double m_TimeSize;
 
   int m_iMaxDataSize;
@@ -112,5 +150,17 @@ private:
 
   std::list<DVDMessageListItem> m_messages;
   std::list<DVDMessageListItem> m_prioMessages;
+
+  // ring buffer mode, see SetRingSize()
+  std::unique_ptr<RingSlot[]> m_ring;
+  uint64_t m_ringMask = 0;
+  alignas(64) std::atomic<uint64_t> m_ringHead{0}; // next slot to write, owned by the producer
+  alignas(64) std::atomic<uint64_t> m_ringTail{0}; // next slot to read, owned by the consumer
+  std::atomic<uint64_t> m_ringFlushed{0}; // slots before this position may have been flushed
+  std::vector<std::pair<uint64_t, CDVDMsg::Message>> m_flushFilters; // protected by m_section
+  std::list<DVDMessageListItem> m_spillMessages; // ring overflow, newest at the front
+  std::atomic<int> m_spillCount{0};
+  std::atomic<int> m_lockedCount{0}; // messages in m_prioMessages and m_messages
+  std::atomic<bool> m_waiting{false};
 };
 
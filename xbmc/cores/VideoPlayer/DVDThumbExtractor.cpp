@@ -0,0 +1,306 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDThumbExtractor.h"
+
+#include "DVDCodecs/DVDFactoryCodec.h"
+#include "DVDCodecs/Video/DVDVideoCodec.h"
+#include "DVDDemuxers/DVDDemux.h"
+#include "DVDDemuxers/DVDDemuxUtils.h"
+#include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDInputStreams/DVDFactoryInputStream.h"
+#include "DVDInputStreams/DVDInputStream.h"
+#include "DVDStreamInfo.h"
+#include "FileItem.h"
+#include "Process/ProcessInfo.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "guilib/Texture.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+extern "C" {
+#include <libavformat/avformat.h>
+#include <libswscale/swscale.h>
+}
+
+namespace
+{
+// a drained decoder returns the pictures of the packets it got, no matter how many calls
+constexpr int MaxDrainCalls = 16;
+
+int DegreeToOrientation(int degrees)
+{
+  switch(degrees)
+  {
+    case 90:
+      return 5;
+    case 180:
+      return 2;
+    case 270:
+      return 7;
+    default:
+      return 0;
+  }
+}
+} // unnamed namespace
+
+CDVDThumbExtractor::CDVDThumbExtractor() = default;
+
+CDVDThumbExtractor::~CDVDThumbExtractor()
+{
+  Close();
+  sws_freeContext(m_swsContext);
+}
+
+bool CDVDThumbExtractor::Open(const CFileItem& fileItem)
+{
+  Close();
+
+  m_redactedPath = CURL::GetRedacted(fileItem.GetPath());
+
+  CFileItem item(fileItem);
+  item.SetMimeTypeForInternetFile();
+  m_inputStream = CDVDFactoryInputStream::CreateInputStream(nullptr, item);
+  if (!m_inputStream)
+  {
+    CLog::Log(LOGERROR, "InputStream: Error creating stream for {}", m_redactedPath);
+    return false;
+  }
+
+  if (!m_inputStream->Open())
+  {
+    CLog::Log(LOGERROR, "InputStream: Error opening, {}", m_redactedPath);
+    Close();
+    return false;
+  }
+
+  m_demuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(m_inputStream, true));
+  if (!m_demuxer)
+  {
+    CLog::LogF(LOGERROR, "Error creating demuxer");
+    Close();
+    return false;
+  }
+
+  int64_t demuxerId = -1;
+  for (CDemuxStream* stream : m_demuxer->GetStreams())
+  {
+    if (stream)
+    {
+      // ignore if it's a picture attachment (e.g. jpeg artwork)
+      if (stream->type == STREAM_VIDEO && !(stream->flags & AV_DISPOSITION_ATTACHED_PIC))
+      {
+        m_videoStream = stream->uniqueId;
+        demuxerId = stream->demuxerId;
+      }
+      else
+        m_demuxer->EnableStream(stream->demuxerId, stream->uniqueId, false);
+    }
+  }
+
+  if (m_videoStream == -1)
+  {
+    Close();
+    return false;
+  }
+
+  m_processInfo.reset(CProcessInfo::CreateInstance());
+  std::vector<AVPixelFormat> pixFmts;
+  pixFmts.push_back(AV_PIX_FMT_YUV420P);
+  m_processInfo->SetPixFormats(pixFmts);
+
+  m_hint = std::make_unique<CDVDStreamInfo>(*m_demuxer->GetStream(demuxerId, m_videoStream), true);
+  m_hint->codecOptions = CODEC_FORCE_SOFTWARE;
+
+  m_videoCodec = CDVDFactoryCodec::CreateVideoCodec(*m_hint, *m_processInfo);
+  if (!m_videoCodec)
+  {
+    Close();
+    return false;
+  }
+
+  return true;
+}
+
+void CDVDThumbExtractor::Close()
+{
+  m_videoCodec.reset();
+  m_processInfo.reset();
+  m_hint.reset();
+  m_demuxer.reset();
+  m_inputStream.reset();
+  m_videoStream = -1;
+}
+
+std::unique_ptr<CTexture> CDVDThumbExtractor::Extract(int chapterNumber /* = 0 */)
+{
+  if (!m_videoCodec)
+    return {};
+
+  auto start = std::chrono::steady_clock::now();
+
+  int nTotalLen = m_demuxer->GetStreamLength();
+
+  bool seekToChapter = chapterNumber > 0 && m_demuxer->GetChapterCount() > 0;
+  int64_t nSeekTo =
+      seekToChapter ? m_demuxer->GetChapterPos(chapterNumber) * 1000 : nTotalLen / 3;
+
+  CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", nSeekTo, nTotalLen,
+             m_redactedPath);
+
+  int packetsTried = 0;
+  std::unique_ptr<CTexture> result{};
+  VideoPicture picture = {};
+
+  // the seek lands on a keyframe, which mostly is all there is to decode. if the decoder can't
+  // start with it, decode from there on like the player would.
+  bool decoded = Seek(nSeekTo) && DecodeKeyFrame(picture, packetsTried);
+  if (!decoded && Seek(nSeekTo))
+    decoded = DecodePicture(picture, packetsTried);
+
+  if (decoded)
+    result = ToTexture(picture);
+  else
+    CLog::LogF(LOGDEBUG, "decode failed in {} after {} packets.", m_redactedPath, packetsTried);
+
+  auto end = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+  CLog::LogF(LOGDEBUG, "measured {} ms to extract thumb from file <{}> in {} packets. ",
+             duration.count(), m_redactedPath, packetsTried);
+
+  return result;
+}
+
+bool CDVDThumbExtractor::Seek(int64_t seekTo)
+{
+  m_videoCodec->Reset();
+  return m_demuxer->SeekTime(static_cast<double>(seekTo), true);
+}
+
+bool CDVDThumbExtractor::DecodeKeyFrame(VideoPicture& picture, int& packetsTried)
+{
+  DemuxPacket* pPacket = nullptr;
+  int abort_index = m_demuxer->GetNrOfStreams() * 160;
+  while (abort_index--)
+  {
+    pPacket = m_demuxer->Read();
+    packetsTried++;
+
+    if (!pPacket || pPacket->iStreamId == m_videoStream)
+      break;
+
+    CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+    pPacket = nullptr;
+  }
+
+  if (!pPacket)
+    return false;
+
+  // decode only the first packet and squeeze its picture out of the decoder right away, instead
+  // of feeding packets until the decoder's reorder and thread delay is filled
+  m_videoCodec->SetCodecControl(DVD_CODEC_CTRL_DROP_ANY | DVD_CODEC_CTRL_DRAIN);
+  const bool added = m_videoCodec->AddData(*pPacket);
+  CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+
+  bool decoded = false;
+  for (int i = 0; added && i < MaxDrainCalls; i++)
+  {
+    CDVDVideoCodec::VCReturn iDecoderState = m_videoCodec->GetPicture(&picture);
+    if (iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED))
+    {
+      decoded = true;
+      break;
+    }
+    if (iDecoderState == CDVDVideoCodec::VC_EOF || iDecoderState == CDVDVideoCodec::VC_ERROR)
+      break;
+  }
+
+  m_videoCodec->SetCodecControl(DVD_CODEC_CTRL_DROP_ANY);
+  return decoded;
+}
+
+bool CDVDThumbExtractor::DecodePicture(VideoPicture& picture, int& packetsTried)
+{
+  CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
+
+  // num streams * 160 frames, should get a valid frame, if not abort.
+  int abort_index = m_demuxer->GetNrOfStreams() * 160;
+  do
+  {
+    DemuxPacket* pPacket = m_demuxer->Read();
+    packetsTried++;
+
+    if (!pPacket)
+      break;
+
+    if (pPacket->iStreamId != m_videoStream)
+    {
+      CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+      continue;
+    }
+
+    m_videoCodec->AddData(*pPacket);
+    CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+
+    iDecoderState = CDVDVideoCodec::VC_NONE;
+    while (iDecoderState == CDVDVideoCodec::VC_NONE)
+    {
+      iDecoderState = m_videoCodec->GetPicture(&picture);
+    }
+
+    if (iDecoderState == CDVDVideoCodec::VC_PICTURE)
+    {
+      if (!(picture.iFlags & DVP_FLAG_DROPPED))
+        break;
+    }
+
+  } while (abort_index--);
+
+  return iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED);
+}
+
+std::unique_ptr<CTexture> CDVDThumbExtractor::ToTexture(const VideoPicture& picture)
+{
+  unsigned int nWidth =
+      std::min(picture.iDisplayWidth,
+               CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes);
+  double aspect = (double)picture.iDisplayWidth / (double)picture.iDisplayHeight;
+  if (m_hint->forced_aspect && m_hint->aspect != 0)
+    aspect = m_hint->aspect;
+  unsigned int nHeight = (unsigned int)((double)nWidth / aspect);
+
+  std::unique_ptr<CTexture> result = CTexture::CreateTexture(nWidth, nHeight);
+  result->SetAlpha(false);
+
+  // files of a batch mostly share their resolution, so the scaler rarely has to be set up again
+  m_swsContext = sws_getCachedContext(m_swsContext, picture.iWidth, picture.iHeight,
+                                      AV_PIX_FMT_YUV420P, nWidth, nHeight, AV_PIX_FMT_BGRA,
+                                      SWS_FAST_BILINEAR, nullptr, nullptr, nullptr);
+
+  if (m_swsContext)
+  {
+    uint8_t* planes[YuvImage::MAX_PLANES];
+    int stride[YuvImage::MAX_PLANES];
+    picture.videoBuffer->GetPlanes(planes);
+    picture.videoBuffer->GetStrides(stride);
+    uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
+    int srcStride[] = {stride[0], stride[1], stride[2], 0};
+    uint8_t* dst[] = {result->GetPixels(), 0, 0, 0};
+    int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
+    result->SetOrientation(DegreeToOrientation(m_hint->orientation));
+    sws_scale(m_swsContext, src, srcStride, 0, picture.iHeight, dst, dstStride);
+  }
+
+  return result;
+}
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+class CDVDDemux;
+class CDVDInputStream;
+class CDVDStreamInfo;
+class CDVDVideoCodec;
+class CFileItem;
+class CProcessInfo;
+class CTexture;
+struct SwsContext;
+struct VideoPicture;
+
+/*!
+ * @brief Extracts thumbnails from a video file, keeping the file open between extractions.
+ *
+ * Several thumbnails of the same file, e.g. chapter previews, share the demuxer and decoder of
+ * the file. The scaler is kept across files, so an extractor is meant to be reused for a batch of
+ * files by one thread.
+ */
+class CDVDThumbExtractor
+{
+public:
+  CDVDThumbExtractor();
+  ~CDVDThumbExtractor();
+
+  CDVDThumbExtractor(const CDVDThumbExtractor&) = delete;
+  CDVDThumbExtractor& operator=(const CDVDThumbExtractor&) = delete;
+
+  /*!
+   * @brief Open a file, closing the one opened before.
+   * @return false if the file can't be demuxed or has no video stream that can be decoded.
+   */
+  bool Open(const CFileItem& fileItem);
+  void Close();
+
+  /*!
+   * @brief Extract a thumbnail from the opened file.
+   * @param chapterNumber the chapter to take the thumbnail from, 0 for a frame approx 1/3 into
+   * the video.
+   * @return the thumbnail, nullptr if no picture could be decoded.
+   */
+  std::unique_ptr<CTexture> Extract(int chapterNumber = 0);
+
+private:
+  bool Seek(int64_t seekTo);
+  bool DecodeKeyFrame(VideoPicture& picture, int& packetsTried);
+  bool DecodePicture(VideoPicture& picture, int& packetsTried);
+  std::unique_ptr<CTexture> ToTexture(const VideoPicture& picture);
+
+  std::string m_redactedPath;
+  std::shared_ptr<CDVDInputStream> m_inputStream;
+  std::unique_ptr<CDVDDemux> m_demuxer;
+  std::unique_ptr<CDVDStreamInfo> m_hint;
+  std::unique_ptr<CProcessInfo> m_processInfo;
+  std::unique_ptr<CDVDVideoCodec> m_videoCodec;
+  int m_videoStream{-1};
+  SwsContext* m_swsContext{nullptr};
+};
@@ -15,6 +15,7 @@
 #include "DVDDemuxers/DVDDemuxUtils.h"
 #include "DVDDemuxers/DVDDemuxVobsub.h"
 #include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDDemuxers/DemuxPacketPool.h"
 #include "DVDInputStreams/DVDFactoryInputStream.h"
 #include "DVDInputStreams/DVDInputStream.h"
 #include "network/NetworkFileItemClassify.h"
@@ -2695,6 +2696,9 @@ void CVideoPlayer::OnExit()
   // clean up all selection streams
   m_SelectionStreams.Clear(STREAM_NONE, STREAM_SOURCE_NONE);
 
+  // give back the recycled packet memory, the next file may use different packet sizes
+  CDemuxPacketPool::GetInstance().Trim();
+
   m_messenger.End();
 
   CFFmpegLog::ClearLogLevel();
@@ -3452,6 +3456,23 @@ void CVideoPlayer::GetGeneralInfo(std::string& strGeneralInfo)
                                     m_State.cache_offset * 100.0);
     }
 
+    if (m_State.cache_rate > 0)
+      strBuf += StringUtils::Format(", fill: {}/s", StringUtils::SizeToString(m_State.cache_rate));
+
+    const uint32_t seeks = m_State.cache_seekhits + m_State.cache_seekmisses;
+    if (seeks > 0)
+      strBuf += StringUtils::Format(", seek hit: {:.0f}% of {}",
+                                    100.0 * m_State.cache_seekhits / seeks, seeks);
+
+    const CDemuxPacketPool::Stats poolStats = CDemuxPacketPool::GetInstance().GetStats();
+    const uint64_t poolRequests = poolStats.hits + poolStats.misses;
+    if (poolRequests > 0)
+    {
+      strBuf += StringUtils::Format(", pkt pool: {:.1f}% hit / {}",
+                                    100.0 * poolStats.hits / poolRequests,
+                                    StringUtils::SizeToString(poolStats.cachedBytes));
+    }
+
     strGeneralInfo = StringUtils::Format("Player: a/v:{: 6.3f}, {}", dDiff, strBuf);
   }
 }
@@ -5109,9 +5130,17 @@ void CVideoPlayer::UpdatePlayState(double timeout)
     state.cache_bytes = status.forward;
     if(state.timeMax)
       state.cache_bytes += m_pInputStream->GetLength() * (int64_t)(queueTime / state.timeMax);
+    state.cache_rate = status.currate;
+    state.cache_seekhits = status.seekhits;
+    state.cache_seekmisses = status.seekmisses;
   }
   else
+  {
     state.cache_bytes = 0;
+    state.cache_rate = 0;
+    state.cache_seekhits = 0;
+    state.cache_seekmisses = 0;
+  }
 
   state.timestamp = m_clock.GetAbsoluteClock();
 
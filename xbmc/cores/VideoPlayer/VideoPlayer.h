@@ -54,6 +54,9 @@ struct SPlayerState
     cantempo = false;
     caching = false;
     cache_bytes = 0;
+    cache_rate = 0;
+    cache_seekhits = 0;
+    cache_seekmisses = 0;
     cache_level = 0.0;
     cache_offset = 0.0;
     lastSeek = 0;
@@ -84,6 +87,9 @@ struct SPlayerState
   bool caching;
 
   int64_t cache_bytes; // number of bytes current's cached
+  uint32_t cache_rate; // current fill rate of the input cache in bytes/second
+  uint32_t cache_seekhits; // seeks served from the input cache
+  uint32_t cache_seekmisses; // seeks that had to go back to the source
   double cache_level; // current cache level
   double cache_offset; // percentage of file ahead of current position
   double cache_time; // estimated playback time of current cached bytes
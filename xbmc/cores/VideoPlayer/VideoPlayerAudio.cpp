@@ -67,6 +67,8 @@ CVideoPlayerAudio::CVideoPlayerAudio(CDVDClock* pClock,
   // allows max bitrate of 18 Mbit/s (TrueHD max peak) during m_messageQueueTimeSize seconds
   m_messageQueue.SetMaxDataSize(18 * messageQueueTimeSize / 8 * 1024 * 1024);
   m_messageQueue.SetMaxTimeSize(messageQueueTimeSize);
+  // fed by the demuxer thread only, many small packets for lossless formats
+  m_messageQueue.SetRingSize(8192);
 
   m_disconAdjustTimeMs = processInfo.GetMaxPassthroughOffSyncDuration();
 }
@@ -73,6 +73,8 @@ CVideoPlayerVideo::CVideoPlayerVideo(CDVDClock* pClock,
 
   m_messageQueue.SetMaxDataSize(sizeMB * 1024 * 1024);
   m_messageQueue.SetMaxTimeSize(messageQueueTimeSize);
+  // fed by the demuxer thread only
+  m_messageQueue.SetRingSize(2048);
 
   m_iDroppedFrames = 0;
   m_fFrameRate = 25;
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDDemuxers/DemuxPacketPool.h"
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+class TestDemuxPacketPool : public ::testing::Test
+{
+protected:
+  TestDemuxPacketPool() { CDemuxPacketPool::GetInstance().Trim(); }
+  ~TestDemuxPacketPool() override { CDemuxPacketPool::GetInstance().Trim(); }
+};
+
+TEST_F(TestDemuxPacketPool, PayloadIsPadded)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(100);
+  ASSERT_NE(packet, nullptr);
+  ASSERT_NE(packet->pData, nullptr);
+  for (int i = 0; i < AV_INPUT_BUFFER_PADDING_SIZE; ++i)
+    EXPECT_EQ(packet->pData[100 + i], 0);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+}
+
+TEST_F(TestDemuxPacketPool, RecycledPacketIsReset)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(1000);
+  ASSERT_NE(packet, nullptr);
+  uint8_t* data = packet->pData;
+  packet->iSize = 1000;
+  packet->iStreamId = 3;
+  packet->pts = 42.0;
+  memset(data, 0xff, 1000 + AV_INPUT_BUFFER_PADDING_SIZE);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+  const CDemuxPacketPool::Stats before = CDemuxPacketPool::GetInstance().GetStats();
+
+  // smaller request of the same size class reuses the buffer
+  packet = CDVDDemuxUtils::AllocateDemuxPacket(900);
+  ASSERT_NE(packet, nullptr);
+  EXPECT_EQ(packet->pData, data);
+  EXPECT_EQ(packet->iSize, 0);
+  EXPECT_EQ(packet->iStreamId, -1);
+  EXPECT_EQ(packet->pts, DVD_NOPTS_VALUE);
+  EXPECT_EQ(packet->cryptoInfo, nullptr);
+  for (int i = 0; i < AV_INPUT_BUFFER_PADDING_SIZE; ++i)
+    EXPECT_EQ(packet->pData[900 + i], 0);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+  const CDemuxPacketPool::Stats after = CDemuxPacketPool::GetInstance().GetStats();
+  EXPECT_EQ(after.hits, before.hits + 1);
+  EXPECT_EQ(after.misses, before.misses);
+}
+
+TEST_F(TestDemuxPacketPool, OversizedPayloadIsNotCached)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(16 * 1024 * 1024);
+  ASSERT_NE(packet, nullptr);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+  const CDemuxPacketPool::Stats stats = CDemuxPacketPool::GetInstance().GetStats();
+  EXPECT_EQ(stats.cachedBytes, 0u);
+  EXPECT_EQ(stats.cachedPackets, 1u);
+}
+
+TEST_F(TestDemuxPacketPool, Trim)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(4096);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+  EXPECT_GT(CDemuxPacketPool::GetInstance().GetStats().cachedBytes, 0u);
+
+  CDemuxPacketPool::GetInstance().Trim();
+  const CDemuxPacketPool::Stats stats = CDemuxPacketPool::GetInstance().GetStats();
+  EXPECT_EQ(stats.cachedBytes, 0u);
+  EXPECT_EQ(stats.cachedPackets, 0u);
+}
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsg> MakePacket(int size, double dts)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+  packet->iSize = size;
+  packet->dts = dts;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+
+double GetDts(const std::shared_ptr<CDVDMsg>& msg)
+{
+  return std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket()->dts;
+}
+} // namespace
+
+class TestDVDMessageQueue : public ::testing::TestWithParam<unsigned int>
+{
+protected:
+  TestDVDMessageQueue() : m_queue("test")
+  {
+    m_queue.SetRingSize(GetParam());
+    m_queue.SetMaxDataSize(1024 * 1024);
+    m_queue.Init();
+  }
+  ~TestDVDMessageQueue() override { m_queue.End(); }
+
+  CDVDMessageQueue m_queue;
+};
+
+TEST_P(TestDVDMessageQueue, Order)
+{
+  for (int i = 0; i < 10; ++i)
+    EXPECT_EQ(m_queue.Put(MakePacket(10, i)), MSGQ_OK);
+  EXPECT_EQ(m_queue.GetDataSize(), 100);
+  EXPECT_EQ(m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET), 10u);
+
+  std::shared_ptr<CDVDMsg> msg;
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_EQ(m_queue.Get(msg, 0ms), MSGQ_OK);
+    EXPECT_EQ(GetDts(msg), i);
+  }
+  EXPECT_EQ(m_queue.GetDataSize(), 0);
+  EXPECT_EQ(m_queue.Get(msg, 0ms), MSGQ_TIMEOUT);
+}
+
+TEST_P(TestDVDMessageQueue, PriorityAndPutBack)
+{
+  m_queue.Put(MakePacket(10, 0));
+  m_queue.Put(MakePacket(10, 1));
+
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(m_queue.Get(msg, 0ms), MSGQ_OK);
+  EXPECT_EQ(GetDts(msg), 0);
+  m_queue.PutBack(msg);
+  EXPECT_EQ(m_queue.GetDataSize(), 20);
+
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC), 1);
+
+  int priority = 0;
+  ASSERT_EQ(m_queue.Get(msg, 0ms, priority), MSGQ_OK);
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESYNC));
+  EXPECT_EQ(priority, 1);
+
+  // only priority messages requested
+  priority = 1;
+  EXPECT_EQ(m_queue.Get(msg, 0ms, priority), MSGQ_TIMEOUT);
+
+  ASSERT_EQ(m_queue.Get(msg, 0ms), MSGQ_OK);
+  EXPECT_EQ(GetDts(msg), 0);
+  ASSERT_EQ(m_queue.Get(msg, 0ms), MSGQ_OK);
+  EXPECT_EQ(GetDts(msg), 1);
+  EXPECT_EQ(m_queue.GetDataSize(), 0);
+}
+
+TEST_P(TestDVDMessageQueue, Flush)
+{
+  for (int i = 0; i < 5; ++i)
+    m_queue.Put(MakePacket(10, i));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESET));
+
+  m_queue.Flush();
+  EXPECT_EQ(m_queue.GetDataSize(), 0);
+  EXPECT_EQ(m_queue.GetLevel(), 0);
+  EXPECT_EQ(m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET), 0u);
+  EXPECT_EQ(m_queue.GetPacketCount(CDVDMsg::GENERAL_RESET), 1u);
+
+  m_queue.Put(MakePacket(7, 100));
+  EXPECT_EQ(m_queue.GetDataSize(), 7);
+
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(m_queue.Get(msg, 0ms), MSGQ_OK);
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESET));
+  ASSERT_EQ(m_queue.Get(msg, 0ms), MSGQ_OK);
+  EXPECT_EQ(GetDts(msg), 100);
+  EXPECT_EQ(m_queue.GetDataSize(), 0);
+}
+
+TEST_P(TestDVDMessageQueue, Threaded)
+{
+  constexpr int PACKETS = 20000;
+  std::thread producer([this]() {
+    for (int i = 0; i < PACKETS; ++i)
+      m_queue.Put(MakePacket(10, i));
+  });
+
+  std::shared_ptr<CDVDMsg> msg;
+  for (int i = 0; i < PACKETS; ++i)
+  {
+    ASSERT_EQ(m_queue.Get(msg, 5s), MSGQ_OK);
+    EXPECT_EQ(GetDts(msg), i);
+  }
+  producer.join();
+  EXPECT_EQ(m_queue.GetDataSize(), 0);
+}
+
+// a consumer that only takes priority messages, like a paused player, still has to receive
+// everything while the queue is drained
+TEST_P(TestDVDMessageQueue, DrainWhileGettingPriorityMessages)
+{
+  for (int i = 0; i < 3; ++i)
+    m_queue.Put(MakePacket(10, i));
+
+  std::atomic<bool> stop{false};
+  std::atomic<int> packets{0};
+  std::thread consumer([this, &stop, &packets]() {
+    while (!stop)
+    {
+      std::shared_ptr<CDVDMsg> msg;
+      int priority = 1;
+      if (m_queue.Get(msg, 10ms, priority) != MSGQ_OK)
+        continue;
+
+      if (msg->IsType(CDVDMsg::DEMUXER_PACKET))
+        packets++;
+      else if (msg->IsType(CDVDMsg::GENERAL_SYNCHRONIZE))
+        std::static_pointer_cast<CDVDMsgGeneralSynchronize>(msg)->Wait(100ms, SYNCSOURCE_AUDIO);
+    }
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  m_queue.WaitUntilEmpty();
+  const auto duration = std::chrono::steady_clock::now() - start;
+
+  stop = true;
+  consumer.join();
+
+  // the synchronize message times out after 40 s if it never reaches the consumer
+  EXPECT_LT(duration, 5s);
+  EXPECT_EQ(packets, 3);
+  EXPECT_EQ(m_queue.GetDataSize(), 0);
+}
+
+// list based queue, a ring that overflows into the list and a ring large enough for everything
+INSTANTIATE_TEST_SUITE_P(DVDMessageQueue, TestDVDMessageQueue, ::testing::Values(0u, 4u, 4096u));
+
@@ -10,6 +10,7 @@
 
 #include "DatabaseManager.h"
 #include "DbUrl.h"
+#include "FullTextIndex.h"
 #include "ServiceBroker.h"
 #include "filesystem/SpecialProtocol.h"
 #if defined(HAS_MYSQL) || defined(HAS_MARIADB)
@@ -31,6 +32,7 @@
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <utility>
 
 using namespace dbiplus;
 
@@ -317,6 +319,26 @@ std::string CDatabase::GetSingleValue(const std::string& query) const
   return GetSingleValue(query, *m_pDS);
 }
 
+std::string CDatabase::GetSingleValue(const std::string& query, const BindList& params) const
+{
+  std::string ret;
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return ret;
+
+    if (m_pDS->query(query, params) && m_pDS->num_rows() > 0)
+      ret = m_pDS->fv(0).get_asString();
+
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed on query '{}'", query);
+  }
+  return ret;
+}
+
 int CDatabase::GetSingleValueInt(const std::string& query, Dataset& ds) const
 {
   int ret = 0;
@@ -354,6 +376,12 @@ int CDatabase::GetSingleValueInt(const std::string& query) const
   return GetSingleValueInt(query, *m_pDS);
 }
 
+int CDatabase::GetSingleValueInt(const std::string& query, const BindList& params) const
+{
+  const std::string strResult = GetSingleValue(query, params);
+  return static_cast<int>(std::strtol(strResult.c_str(), nullptr, 10));
+}
+
 bool CDatabase::DeleteValues(const std::string& strTable, const Filter& filter /* = Filter() */)
 {
   std::string strQuery;
@@ -411,6 +439,34 @@ bool CDatabase::ExecuteQuery(const std::string& strQuery)
   return bReturn;
 }
 
+bool CDatabase::ExecuteQuery(const std::string& strQuery, const BindList& params)
+{
+  bool bReturn = false;
+
+  try
+  {
+    if (nullptr == m_pDB)
+      return bReturn;
+    if (nullptr == m_pDS)
+      return bReturn;
+
+    if (m_multipleExecute)
+    {
+      m_multipleQueries.push_back(m_pDS->format_sql(strQuery, params));
+      return true;
+    }
+
+    m_pDS->exec(strQuery, params);
+    bReturn = true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed to execute query '{}'", strQuery);
+  }
+
+  return bReturn;
+}
+
 bool CDatabase::ResultQuery(const std::string& strQuery) const
 {
   bool bReturn = false;
@@ -586,6 +642,7 @@ void CDatabase::CopyDB(const std::string& latestDb)
 void CDatabase::DropAnalytics()
 {
   m_pDB->drop_analytics();
+  m_fullTextIndexes.clear();
 }
 
 CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
@@ -595,7 +652,9 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
   // create the appropriate database structure
   if (dbSettings.type == "sqlite3")
   {
-    m_pDB = std::make_unique<SqliteDatabase>();
+    auto db = std::make_unique<SqliteDatabase>();
+    db->setWalMode(dbSettings.walmode);
+    m_pDB = std::move(db);
   }
 #if defined(HAS_MYSQL) || defined(HAS_MARIADB)
   else if (dbSettings.type == "mysql")
@@ -630,6 +689,7 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
                    dbSettings.compression);
 
   // create the datasets
+  m_fullTextIndexes.clear();
   m_pDS.reset(m_pDB->CreateDataset());
   m_pDS2.reset(m_pDB->CreateDataset());
 
@@ -677,6 +737,16 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
     return ConnectionState::STATE_ERROR;
   }
 
+  // readers only help if they don't have to wait for the writer
+  if (dbSettings.type == "sqlite3" && dbSettings.walmode)
+  {
+    m_readerHost = dbSettings.host;
+    m_readerName = dbName;
+    m_maxReaders = dbSettings.readconnections;
+  }
+  else
+    m_maxReaders = 0;
+
   m_openCount = 1; // our database is open
   return ConnectionState::STATE_CONNECTED;
 }
@@ -707,6 +777,7 @@ void CDatabase::Close()
 
   m_openCount = 0;
   m_multipleExecute = false;
+  m_maxReaders = 0;
 
   if (nullptr == m_pDB)
     return;
@@ -716,6 +787,39 @@ void CDatabase::Close()
   m_pDB.reset();
   m_pDS.reset();
   m_pDS2.reset();
+  m_fullTextIndexes.clear();
+}
+
+CDatabase::CReadScope::CReadScope(CDatabase& db) : m_db(db)
+{
+  // a transaction must see its own uncommitted changes
+  if (m_db.m_maxReaders == 0 || m_db.m_inReadScope || !m_db.m_pDB || m_db.m_pDB->in_transaction())
+    return;
+
+  m_reader = CDatabaseReaderPool::GetInstance().Acquire(m_db.m_readerHost, m_db.m_readerName,
+                                                        m_db.m_maxReaders);
+  if (!m_reader)
+    return;
+
+  m_mainDS = std::exchange(m_db.m_pDS, std::unique_ptr<Dataset>(m_reader->CreateDataset()));
+  m_mainDS2 = std::exchange(m_db.m_pDS2, std::unique_ptr<Dataset>(m_reader->CreateDataset()));
+  m_db.m_inReadScope = true;
+}
+
+CDatabase::CReadScope::~CReadScope()
+{
+  if (!m_mainDS)
+    return;
+
+  m_db.m_inReadScope = false;
+
+  // closed while in scope, the main datasets belong to the old connection
+  if (!m_db.m_pDB)
+    return;
+
+  // the reader datasets have to go before the lease returns their connection
+  m_db.m_pDS = std::move(m_mainDS);
+  m_db.m_pDS2 = std::move(m_mainDS2);
 }
 
 bool CDatabase::Compress(bool bForce /* =true */)
@@ -850,6 +954,48 @@ bool CDatabase::BuildSQL(std::string_view strQuery, const Filter& filter, std::s
   return true;
 }
 
+void CDatabase::CreateFullTextIndex(const CFullTextIndex& index)
+{
+  if (!m_sqlite || !index.IsSupported(*m_pDS))
+  {
+    CLog::Log(LOGINFO, "Full text search is not available, not creating index {}",
+              index.GetName());
+    return;
+  }
+
+  CLog::Log(LOGINFO, "Creating full text search index {}", index.GetName());
+  m_fullTextIndexes.erase(index.GetName());
+  index.Create(*m_pDS);
+}
+
+bool CDatabase::HasFullTextIndex(const CFullTextIndex& index) const
+{
+  if (!m_sqlite || !m_pDS)
+    return false;
+
+  const auto it = m_fullTextIndexes.find(index.GetName());
+  if (it != m_fullTextIndexes.end())
+    return it->second;
+
+  const bool exists = index.Exists(*m_pDS);
+  m_fullTextIndexes.emplace(index.GetName(), exists);
+  return exists;
+}
+
+void CDatabase::AppendFullTextSearch(std::string& strSQL,
+                                     const CFullTextIndex& index,
+                                     std::string_view keyExpression,
+                                     std::string_view text,
+                                     std::initializer_list<std::string_view> columns)
+{
+  if (!HasFullTextIndex(index))
+    return;
+
+  const std::string condition = index.Search(keyExpression, text, columns);
+  if (!condition.empty())
+    strSQL += " AND " + condition;
+}
+
 bool CDatabase::BuildSQL(const std::string& strBaseDir,
                          const std::string& strQuery,
                          Filter& filter,
@@ -8,6 +8,10 @@
 
 #pragma once
 
+#include "DatabaseReaderPool.h"
+
+#include <initializer_list>
+#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -17,10 +21,13 @@ namespace dbiplus
 {
 class Database;
 class Dataset;
+class field_value;
+using BindList = std::vector<field_value>;
 } // namespace dbiplus
 
 class DatabaseSettings;
 class CDbUrl;
+class CFullTextIndex;
 class CProfileManager;
 struct SortDescription;
 
@@ -128,6 +135,13 @@ public:
                              const std::string& strOrderBy = std::string()) const;
   std::string GetSingleValue(const std::string& query) const;
 
+  /*! \brief Get a single value from a query with '?' placeholders.
+   \param query the query in question, compiled once and reused by backends that support it.
+   \param params the values to bind to the placeholders.
+   \return the value from the query, empty on failure.
+   */
+  std::string GetSingleValue(const std::string& query, const dbiplus::BindList& params) const;
+
   /*! \brief Get a single value from a query on a dataset.
    \param query the query in question.
    \param ds the dataset to use for the query.
@@ -149,6 +163,7 @@ public:
                         const std::string& strWhereClause = std::string(),
                         const std::string& strOrderBy = std::string()) const;
   int GetSingleValueInt(const std::string& query) const;
+  int GetSingleValueInt(const std::string& query, const dbiplus::BindList& params) const;
 
   /*! \brief Get a single integer value from a query on a dataset.
    \param query the query in question.
@@ -175,6 +190,16 @@ public:
    */
   bool ExecuteQuery(const std::string& strQuery);
 
+  /*!
+   * @brief Execute a query with '?' placeholders that does not return any result.
+   *        Queued queries have their parameters formatted into the query text.
+   * @param strQuery The query to execute.
+   * @param params The values to bind to the placeholders.
+   * @return True if the query was executed successfully, false otherwise.
+   * @sa ExecuteQuery(const std::string&)
+   */
+  bool ExecuteQuery(const std::string& strQuery, const dbiplus::BindList& params);
+
   /*!
    * @brief Execute a query that returns a result.
    * @remarks Call m_pDS->close(); to clean up the dataset when done.
@@ -266,6 +291,27 @@ public:
 protected:
   friend class CDatabaseManager;
 
+  /*!
+   * @brief Route m_pDS and m_pDS2 to a pooled read-only connection while in scope.
+   *        Lets select-only methods run next to the writer on another connection when WAL
+   *        mode is enabled. Does nothing without WAL, for MySQL, while a transaction is open
+   *        or when all readers are busy, the main connection is used then.
+   */
+  class CReadScope
+  {
+  public:
+    explicit CReadScope(CDatabase& db);
+    ~CReadScope();
+    CReadScope(const CReadScope&) = delete;
+    CReadScope& operator=(const CReadScope&) = delete;
+
+  private:
+    CDatabase& m_db;
+    CDatabaseReaderPool::Lease m_reader;
+    std::unique_ptr<dbiplus::Dataset> m_mainDS;
+    std::unique_ptr<dbiplus::Dataset> m_mainDS2;
+  };
+
   void Split(const std::string& strFileNameAndPath,
              std::string& strPath,
              std::string& strFileName) const;
@@ -306,6 +352,29 @@ protected:
 
   bool BuildSQL(std::string_view strQuery, const Filter& filter, std::string& strSQL) const;
 
+  /*! \brief Create a full text search index if the database supports it.
+   To be called from CreateAnalytics(), searches fall back to their LIKE conditions otherwise.
+   */
+  void CreateFullTextIndex(const CFullTextIndex& index);
+
+  /*! \brief Check whether a full text search index exists in the database.
+   The result is kept until the connection is closed or the index is created.
+   */
+  bool HasFullTextIndex(const CFullTextIndex& index) const;
+
+  /*! \brief Append a condition restricting keyExpression to rows containing text.
+   The index only finds the candidate rows, the LIKE conditions already in the query decide
+   which of them match, so the result is the same with and without an index. Nothing is
+   appended if there is no index or it can't find text.
+   \param strSQL The query, its WHERE clause is extended with " AND <condition>".
+   \sa CFullTextIndex::Search
+   */
+  void AppendFullTextSearch(std::string& strSQL,
+                            const CFullTextIndex& index,
+                            std::string_view keyExpression,
+                            std::string_view text,
+                            std::initializer_list<std::string_view> columns = {});
+
   bool m_sqlite{true}; ///< \brief whether we use sqlite (defaults to true)
 
   std::unique_ptr<dbiplus::Database> m_pDB;
@@ -324,6 +393,12 @@ private:
   bool m_bMultiDelete{
       false}; /*!< True if there are any queries in the delete queue, false otherwise */
   unsigned int m_openCount{0};
+  mutable std::map<std::string, bool, std::less<>> m_fullTextIndexes; //!< existence by index name
+
+  std::string m_readerHost; ///< folder of the database file, for pooled readers
+  std::string m_readerName; ///< name of the database file, for pooled readers
+  unsigned int m_maxReaders{0}; ///< pooled readers allowed, 0 if not in WAL mode
+  bool m_inReadScope{false};
 
   bool m_multipleExecute{false};
   std::vector<std::string> m_multipleQueries;
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DatabaseReaderPool.h"
+
+#include "sqlitedataset.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+CDatabaseReaderPool::Lease::Lease(std::string path,
+                                  unsigned int generation,
+                                  std::unique_ptr<dbiplus::Database> db)
+  : m_path(std::move(path)),
+    m_generation(generation),
+    m_db(std::move(db))
+{
+}
+
+CDatabaseReaderPool::Lease::~Lease()
+{
+  Release();
+}
+
+CDatabaseReaderPool::Lease& CDatabaseReaderPool::Lease::operator=(Lease&& other) noexcept
+{
+  if (this != &other)
+  {
+    Release();
+    m_path = std::move(other.m_path);
+    m_generation = other.m_generation;
+    m_db = std::move(other.m_db);
+  }
+  return *this;
+}
+
+void CDatabaseReaderPool::Lease::Release()
+{
+  if (m_db)
+    CDatabaseReaderPool::GetInstance().Release(m_path, m_generation, std::move(m_db));
+}
+
+CDatabaseReaderPool& CDatabaseReaderPool::GetInstance()
+{
+  static CDatabaseReaderPool pool;
+  return pool;
+}
+
+CDatabaseReaderPool::~CDatabaseReaderPool() = default;
+
+CDatabaseReaderPool::Lease CDatabaseReaderPool::Acquire(const std::string& host,
+                                                        const std::string& name,
+                                                        unsigned int maxReaders)
+{
+  const std::string path = URIUtils::AddFileToFolder(host, name);
+  unsigned int generation;
+  {
+    std::unique_lock lock(m_critSection);
+    Readers& readers = m_readers[path];
+    if (!readers.idle.empty())
+    {
+      std::unique_ptr<dbiplus::Database> db = std::move(readers.idle.back());
+      readers.idle.pop_back();
+      return Lease(path, m_generation, std::move(db));
+    }
+    if (readers.open >= maxReaders)
+      return {};
+
+    readers.open++;
+    generation = m_generation;
+  }
+
+  // connect outside of the lock, opening the file and reading the schema takes a while
+  auto db = std::make_unique<dbiplus::SqliteDatabase>();
+  db->setHostName(host.c_str());
+  db->setDatabase(name.c_str());
+  db->setWalMode(true);
+  db->setQueryOnly(true);
+  try
+  {
+    if (db->connect(false) == dbiplus::DB_CONNECTION_OK)
+    {
+      db->postconnect();
+      return Lease(path, generation, std::move(db));
+    }
+  }
+  catch (const dbiplus::DbErrors& error)
+  {
+    CLog::LogF(LOGERROR, "Failed to open reader for {}: {}", path, error.getMsg());
+  }
+  catch (const std::runtime_error& error)
+  {
+    CLog::LogF(LOGERROR, "Failed to open reader for {}: {}", path, error.what());
+  }
+
+  std::unique_lock lock(m_critSection);
+  if (generation == m_generation)
+    m_readers[path].open--;
+  return {};
+}
+
+void CDatabaseReaderPool::Release(const std::string& path,
+                                  unsigned int generation,
+                                  std::unique_ptr<dbiplus::Database> db)
+{
+  {
+    std::unique_lock lock(m_critSection);
+    if (generation == m_generation)
+    {
+      m_readers[path].idle.push_back(std::move(db));
+      return;
+    }
+  }
+  // pool was cleared while the connection was in use
+  db->disconnect();
+}
+
+void CDatabaseReaderPool::Clear()
+{
+  std::map<std::string, Readers, std::less<>> readers;
+  {
+    std::unique_lock lock(m_critSection);
+    readers.swap(m_readers);
+    m_generation++;
+  }
+
+  for (auto& [path, pooled] : readers)
+  {
+    for (const auto& db : pooled.idle)
+      db->disconnect();
+  }
+}
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dbiplus
+{
+class Database;
+} // namespace dbiplus
+
+/*!
+ * \brief Process wide pool of read-only SQLite connections per database file.
+ *
+ * Connections are opened on demand up to the requested limit and kept open once returned, so
+ * short lived CDatabase instances (JSON-RPC requests, GUI list population) skip the cost of
+ * connecting and keep their compiled statements. Only useful for databases in WAL mode, where
+ * readers do not wait for the writer.
+ */
+class CDatabaseReaderPool
+{
+public:
+  /*!
+   * \brief Exclusive use of a pooled connection, returned to the pool on destruction.
+   */
+  class Lease
+  {
+  public:
+    Lease() = default;
+    ~Lease();
+    Lease(Lease&& other) noexcept = default;
+    Lease& operator=(Lease&& other) noexcept;
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+
+    explicit operator bool() const { return m_db != nullptr; }
+    dbiplus::Database* operator->() const { return m_db.get(); }
+
+  private:
+    friend class CDatabaseReaderPool;
+    Lease(std::string path, unsigned int generation, std::unique_ptr<dbiplus::Database> db);
+    void Release();
+
+    std::string m_path;
+    unsigned int m_generation{0};
+    std::unique_ptr<dbiplus::Database> m_db;
+  };
+
+  static CDatabaseReaderPool& GetInstance();
+
+  /*!
+   * \brief Get a read-only connection to the database file name in folder host.
+   * \param maxReaders limit of connections open for this database at the same time
+   * \return the connection, or an empty lease if all are in use or connecting failed
+   */
+  Lease Acquire(const std::string& host, const std::string& name, unsigned int maxReaders);
+
+  /*!
+   * \brief Close all idle connections. Connections in use are closed when returned.
+   */
+  void Clear();
+
+private:
+  CDatabaseReaderPool() = default;
+  ~CDatabaseReaderPool();
+  CDatabaseReaderPool(const CDatabaseReaderPool&) = delete;
+  CDatabaseReaderPool& operator=(const CDatabaseReaderPool&) = delete;
+
+  void Release(const std::string& path,
+               unsigned int generation,
+               std::unique_ptr<dbiplus::Database> db);
+
+  struct Readers
+  {
+    std::vector<std::unique_ptr<dbiplus::Database>> idle;
+    unsigned int open{0}; //!< idle and leased connections
+  };
+
+  CCriticalSection m_critSection;
+  std::map<std::string, Readers, std::less<>> m_readers;
+  unsigned int m_generation{0};
+};
@@ -0,0 +1,208 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FullTextIndex.h"
+
+#include "dbwrappers/dataset.h"
+#include "utils/StringUtils.h"
+
+#include <utility>
+
+namespace
+{
+std::string_view GetTokenizer(CFullTextIndex::Tokenizer tokenizer)
+{
+  switch (tokenizer)
+  {
+    case CFullTextIndex::Tokenizer::TRIGRAM:
+      return "tokenize='trigram'";
+    case CFullTextIndex::Tokenizer::WORDS:
+    default:
+      // prefix indexes for the short prefixes typed while searching
+      return "tokenize='unicode61', prefix='2 3'";
+  }
+}
+
+/*!
+ * \brief Decode the UTF-8 sequence at pos and advance pos past it.
+ */
+char32_t NextCodepoint(std::string_view text, size_t& pos)
+{
+  const auto lead = static_cast<unsigned char>(text[pos++]);
+  int continuation = 0;
+  char32_t codepoint = lead;
+  if (lead >= 0xF0)
+  {
+    continuation = 3;
+    codepoint = lead & 0x07;
+  }
+  else if (lead >= 0xE0)
+  {
+    continuation = 2;
+    codepoint = lead & 0x0F;
+  }
+  else if (lead >= 0xC0)
+  {
+    continuation = 1;
+    codepoint = lead & 0x1F;
+  }
+
+  for (; continuation > 0 && pos < text.size(); --continuation)
+    codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[pos++]) & 0x3F);
+
+  return codepoint;
+}
+
+/*!
+ * \brief Whether the word tokenizer keeps the character as part of a token.
+ *
+ * Approximates the letter and digit classes of unicode61 with the ranges of alphabetic scripts,
+ * so symbols and punctuation never count.
+ */
+bool IsTokenCharacter(char32_t c)
+{
+  if (c < 0x80)
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+
+  return (c >= 0xC0 && c < 0x2000 && c != 0xD7 && c != 0xF7) || (c >= 0x3040 && c < 0xD800) ||
+         (c >= 0xF900 && c < 0xFB00) || (c >= 0x20000 && c < 0x30000);
+}
+} // unnamed namespace
+
+CFullTextIndex::CFullTextIndex(std::string_view table,
+                               std::string_view key,
+                               std::vector<std::string> columns,
+                               Tokenizer tokenizer)
+  : m_table(table),
+    m_key(key),
+    m_columns(std::move(columns)),
+    m_tokenizer(tokenizer),
+    m_name(m_table + "_fts")
+{
+}
+
+bool CFullTextIndex::IsSupported(dbiplus::Dataset& ds) const
+{
+  try
+  {
+    ds.exec(StringUtils::Format("CREATE VIRTUAL TABLE temp.fts_probe USING fts5(text, {})",
+                                GetTokenizer(m_tokenizer)));
+    ds.exec("DROP TABLE temp.fts_probe");
+    return true;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+bool CFullTextIndex::Exists(dbiplus::Dataset& ds) const
+{
+  try
+  {
+    if (!ds.query(StringUtils::Format(
+            "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = '{}'", m_name)))
+      return false;
+
+    const bool exists = !ds.eof();
+    ds.close();
+    return exists;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+void CFullTextIndex::Create(dbiplus::Dataset& ds) const
+{
+  const std::string columns = StringUtils::Join(m_columns, ", ");
+  std::string newValues;
+  std::string oldValues;
+  for (const auto& column : m_columns)
+  {
+    newValues += ", new." + column;
+    oldValues += ", old." + column;
+  }
+
+  // recreated rather than kept, the indexed columns may have changed with the schema
+  ds.exec(StringUtils::Format("DROP TABLE IF EXISTS {}", m_name));
+  ds.exec(StringUtils::Format(
+      "CREATE VIRTUAL TABLE {} USING fts5({}, content='{}', content_rowid='{}', {})", m_name,
+      columns, m_table, m_key, GetTokenizer(m_tokenizer)));
+  ds.exec(StringUtils::Format("INSERT INTO {0}({0}) VALUES('rebuild')", m_name));
+
+  const std::string insert = StringUtils::Format("INSERT INTO {}(rowid, {}) VALUES (new.{}{});",
+                                                 m_name, columns, m_key, newValues);
+  const std::string remove =
+      StringUtils::Format("INSERT INTO {0}({0}, rowid, {1}) VALUES ('delete', old.{2}{3});",
+                          m_name, columns, m_key, oldValues);
+
+  ds.exec(StringUtils::Format("CREATE TRIGGER {}_insert AFTER INSERT ON {} BEGIN {} END", m_name,
+                              m_table, insert));
+  ds.exec(StringUtils::Format("CREATE TRIGGER {}_delete AFTER DELETE ON {} BEGIN {} END", m_name,
+                              m_table, remove));
+  ds.exec(
+      StringUtils::Format("CREATE TRIGGER {}_update AFTER UPDATE OF {}, {} ON {} BEGIN {} {} END",
+                          m_name, m_key, columns, m_table, remove, insert));
+}
+
+std::string CFullTextIndex::Match(std::string_view keyExpression, std::string_view query) const
+{
+  std::string quoted{query};
+  StringUtils::Replace(quoted, "'", "''");
+  return StringUtils::Format("{} IN (SELECT rowid FROM {} WHERE {} MATCH '{}')", keyExpression,
+                             m_name, m_name, quoted);
+}
+
+std::string CFullTextIndex::Search(std::string_view keyExpression,
+                                   std::string_view text,
+                                   std::initializer_list<std::string_view> columns) const
+{
+  if (!CanSearch(text, m_tokenizer))
+    return {};
+
+  std::string query = Phrase(text);
+  if (m_tokenizer == Tokenizer::WORDS)
+    query += "*";
+  if (columns.size() > 0)
+    query = ColumnFilter(columns, query);
+
+  return Match(keyExpression, query);
+}
+
+std::string CFullTextIndex::Phrase(std::string_view text)
+{
+  std::string phrase{text};
+  StringUtils::Replace(phrase, "\"", "\"\"");
+  return "\"" + phrase + "\"";
+}
+
+std::string CFullTextIndex::ColumnFilter(std::initializer_list<std::string_view> columns,
+                                         std::string_view query)
+{
+  return StringUtils::Format("{{{}}} : ({})", StringUtils::Join(columns, " "), query);
+}
+
+bool CFullTextIndex::CanSearch(std::string_view text, Tokenizer tokenizer)
+{
+  // wildcards mean something to the LIKE conditions but not to the index
+  if (text.find_first_of("%_") != std::string_view::npos)
+    return false;
+
+  size_t characters = 0;
+  for (size_t pos = 0; pos < text.size();)
+  {
+    const char32_t c = NextCodepoint(text, pos);
+    if (tokenizer == Tokenizer::WORDS && IsTokenCharacter(c))
+      return true;
+    if (tokenizer == Tokenizer::TRIGRAM && ++characters >= 3)
+      return true;
+  }
+  return false;
+}
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dbiplus
+{
+class Dataset;
+} // namespace dbiplus
+
+/*!
+ * \brief SQLite FTS5 index over text columns of a table.
+ *
+ * The index is an external content table named \<table\>_fts whose rowids are the primary keys of
+ * the indexed table. Triggers keep it in sync with every write to the indexed columns, so callers
+ * only need to create it from CreateAnalytics(). Rows deleted by REPLACE only reach the triggers
+ * when the connection has recursive triggers enabled.
+ *
+ * Searches use the index to find candidate rows and keep their LIKE conditions for the exact
+ * match, so results are the same with and without an index.
+ */
+class CFullTextIndex
+{
+public:
+  enum class Tokenizer
+  {
+    WORDS, //!< matches words and word prefixes
+    TRIGRAM, //!< matches any substring of at least three characters
+  };
+
+  CFullTextIndex(std::string_view table,
+                 std::string_view key,
+                 std::vector<std::string> columns,
+                 Tokenizer tokenizer);
+
+  const std::string& GetName() const { return m_name; }
+
+  /*!
+   * \brief Check whether the SQLite library of the connection provides the tokenizer.
+   */
+  bool IsSupported(dbiplus::Dataset& ds) const;
+
+  /*!
+   * \brief Check whether the index has been created in the database.
+   */
+  bool Exists(dbiplus::Dataset& ds) const;
+
+  /*!
+   * \brief Create the index if needed, fill it from the table and install the triggers.
+   * \throw dbiplus::DbErrors on failure.
+   */
+  void Create(dbiplus::Dataset& ds) const;
+
+  /*!
+   * \brief Build an SQL condition restricting keyExpression to rows matching an FTS5 query.
+   * \param keyExpression The key column as used in the query, e.g. "songview.idSong".
+   * \param query The FTS5 query, column filters included.
+   * \return The condition, quoted and ready to be appended to a query (not to be passed through
+   * PrepareSQL again).
+   */
+  std::string Match(std::string_view keyExpression, std::string_view query) const;
+
+  /*!
+   * \brief Build an SQL condition for rows containing text in one of the given columns.
+   *
+   * Trigram indexes match text anywhere, word indexes match it at the start of a word.
+   * \param keyExpression The key column as used in the query.
+   * \param text The literal text to search for.
+   * \param columns The columns to search, all indexed columns if empty.
+   * \return The condition, or an empty string if the index can't find text.
+   */
+  std::string Search(std::string_view keyExpression,
+                     std::string_view text,
+                     std::initializer_list<std::string_view> columns = {}) const;
+
+  /*!
+   * \brief Quote text as an FTS5 phrase.
+   */
+  static std::string Phrase(std::string_view text);
+
+  /*!
+   * \brief Restrict an FTS5 query to the given columns.
+   */
+  static std::string ColumnFilter(std::initializer_list<std::string_view> columns,
+                                  std::string_view query);
+
+  /*!
+   * \brief Check whether an index with the given tokenizer is able to find text.
+   *
+   * Trigrams need three characters, words need a letter or digit; the index returns nothing for
+   * anything shorter. Text with LIKE wildcards is left to the LIKE conditions.
+   */
+  static bool CanSearch(std::string_view text, Tokenizer tokenizer);
+
+private:
+  std::string m_table;
+  std::string m_key;
+  std::vector<std::string> m_columns;
+  Tokenizer m_tokenizer;
+  std::string m_name;
+};
@@ -127,6 +127,66 @@ void Dataset::set_select_sql(std::string_view sel_sql)
   select_sql = sel_sql;
 }
 
+bool Dataset::query(const std::string& sql, const BindList& params)
+{
+  return query(format_sql(sql, params));
+}
+
+int Dataset::exec(const std::string& sql, const BindList& params)
+{
+  return exec(format_sql(sql, params));
+}
+
+std::string Dataset::format_sql(const std::string& sql, const BindList& params) const
+{
+  if (!db)
+    throw DbErrors("No Database Connection");
+
+  std::string result;
+  result.reserve(sql.size() + params.size() * 16);
+
+  size_t param = 0;
+  bool quoted = false;
+  for (const char c : sql)
+  {
+    if (c == '\'')
+      quoted = !quoted;
+
+    if (c != '?' || quoted)
+    {
+      result += c;
+      continue;
+    }
+
+    if (param >= params.size())
+      throw DbErrors("Missing value for parameter %zu of query: %s", param + 1, sql.c_str());
+
+    const field_value& value = params[param++];
+    if (value.get_isNull())
+    {
+      result += "NULL";
+      continue;
+    }
+
+    switch (value.get_fType())
+    {
+      case fType::ft_String:
+      case fType::ft_WideString:
+      case fType::ft_Char:
+        result += db->prepare("'%s'", value.get_asString().c_str());
+        break;
+      case fType::ft_Boolean:
+        result += value.get_asBool() ? "1" : "0";
+        break;
+      default:
+        result += value.get_asString();
+        break;
+    }
+  }
+
+  return result;
+}
+
 void Dataset::parse_sql(std::string& sqlcmd) const
 {
   std::string fpattern;
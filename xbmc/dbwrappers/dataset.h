@@ -20,6 +20,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace dbiplus
 {
@@ -204,6 +205,17 @@ enum class sqlType
 
 using StringList = std::list<std::string>;
 using ParamList = std::map<std::string, field_value, std::less<>>;
+using BindList = std::vector<field_value>;
+
+/* builds the parameter list of a query from its values, i.e. make_bind_list(idFile, strPath) */
+template<typename... Args>
+BindList make_bind_list(Args&&... args)
+{
+  BindList params;
+  params.reserve(sizeof...(args));
+  (params.emplace_back(std::forward<Args>(args)), ...);
+  return params;
+}
 
 class Dataset
 {
@@ -312,6 +324,25 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+
+  /*! \brief Run a select query with values bound to its '?' placeholders.
+   Backends with a statement cache compile sql once and reuse it for later calls with the same
+   text, so values should be passed in params rather than formatted into sql.
+   \param sql - select statement with '?' placeholders
+   \param params - values for the placeholders, in order of appearance
+   \return true on success, throws DbErrors otherwise.
+   */
+  virtual bool query(const std::string& sql, const BindList& params);
+
+  /*! \brief Execute a statement without results with values bound to its '?' placeholders.
+   \sa query(const std::string&, const BindList&)
+   */
+  virtual int exec(const std::string& sql, const BindList& params);
+
+  /*! \brief Replace the '?' placeholders of sql by params formatted as escaped SQL literals.
+   Used by backends without native parameter binding.
+   */
+  std::string format_sql(const std::string& sql, const BindList& params) const;
   /* Close SQL Query*/
   virtual void close();
   /* Refresh dataset (reopen it and set the same cursor position) */
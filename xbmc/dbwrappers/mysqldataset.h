@@ -129,9 +129,12 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  /* parameters are formatted into the query text */
+  using Dataset::exec;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  using Dataset::query;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
@@ -40,6 +40,10 @@ field_value::field_value(const char* s) : field_type(ft_String), str_value(s)
 {
 }
 
+field_value::field_value(const std::string& s) : field_type(ft_String), str_value(s)
+{
+}
+
 field_value::field_value(const bool b) : field_type(ft_Boolean), bool_value(b)
 {
 }
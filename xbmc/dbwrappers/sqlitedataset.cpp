@@ -201,6 +201,13 @@ int callback(void* res_ptr, int ncol, char** result, char** cols)
   return 0;
 }
 
+int journal_mode_callback(void* res_ptr, int ncol, char** result, char** /*cols*/)
+{
+  if (ncol > 0 && result[0])
+    *static_cast<std::string*>(res_ptr) = result[0];
+  return 0;
+}
+
 int busy_callback(void*, int /*busyCount*/)
 {
   KODI::TIME::Sleep(100ms);
@@ -399,6 +406,7 @@ void SqliteDatabase::disconnect()
 {
   if (!active)
     return;
+  clear_statements();
   sqlite3_close(conn);
   active = false;
 }
@@ -415,6 +423,44 @@ int SqliteDatabase::postconnect()
     throw DbErrors("%s", getErrorMsg());
   }
 
+  // the journal mode is stored in the database file, so switching back has to be explicit
+  static const char* modecmd{"PRAGMA journal_mode"};
+  std::string mode;
+  if (setErr(sqlite3_exec(getHandle(), modecmd, &journal_mode_callback, &mode, nullptr),
+             modecmd) != SQLITE_OK)
+  {
+    throw DbErrors("%s", getErrorMsg());
+  }
+
+  if (_wal_mode && !StringUtils::EqualsNoCase(mode, "wal"))
+  {
+    static const char* walcmd{"PRAGMA journal_mode=WAL"};
+    if (setErr(sqlite3_exec(getHandle(), walcmd, &journal_mode_callback, &mode, nullptr),
+               walcmd) != SQLITE_OK)
+    {
+      throw DbErrors("%s", getErrorMsg());
+    }
+    if (!StringUtils::EqualsNoCase(mode, "wal"))
+      CLog::Log(LOGWARNING, "SqliteDatabase: WAL mode not supported for {}, using {}", db, mode);
+  }
+  else if (!_wal_mode && StringUtils::EqualsNoCase(mode, "wal"))
+  {
+    // needs exclusive access, so it only succeeds once all other connections are closed
+    static const char* deletecmd{"PRAGMA journal_mode=DELETE"};
+    if (sqlite3_exec(getHandle(), deletecmd, nullptr, nullptr, nullptr) != SQLITE_OK)
+      CLog::Log(LOGDEBUG, "SqliteDatabase: {} stays in WAL mode while in use", db);
+  }
+
+  if (_query_only)
+  {
+    static const char* querycmd{"PRAGMA query_only=ON"};
+    if (setErr(sqlite3_exec(getHandle(), querycmd, nullptr, nullptr, nullptr), querycmd) !=
+        SQLITE_OK)
+    {
+      throw DbErrors("%s", getErrorMsg());
+    }
+  }
+
   return DB_COMMAND_OK;
 }
 
@@ -704,6 +750,62 @@ std::string SqliteDatabase::vprepare(const char* format, va_list args)
   return strResult;
 }
 
+sqlite3_stmt* SqliteDatabase::get_statement(const std::string& sql)
+{
+  const auto it = m_statementIndex.find(sql);
+  if (it != m_statementIndex.end())
+  {
+    sqlite3_stmt* stmt = it->second->second;
+    m_statements.erase(it->second);
+    m_statementIndex.erase(it);
+    return stmt;
+  }
+
+  sqlite3_stmt* stmt = nullptr;
+  if (setErr(sqlite3_prepare_v3(conn, sql.c_str(), -1, SQLITE_PREPARE_PERSISTENT, &stmt, nullptr),
+             sql.c_str()) != SQLITE_OK)
+  {
+    sqlite3_finalize(stmt);
+    throw DbErrors("%s", getErrorMsg());
+  }
+
+  return stmt;
+}
+
+void SqliteDatabase::release_statement(const std::string& sql, sqlite3_stmt* stmt)
+{
+  if (!stmt)
+    return;
+
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  // the same query may have been checked out twice by nested datasets
+  if (m_statementIndex.contains(sql))
+  {
+    sqlite3_finalize(stmt);
+    return;
+  }
+
+  m_statements.emplace_front(sql, stmt);
+  m_statementIndex.emplace(sql, m_statements.begin());
+
+  if (m_statements.size() > MAX_CACHED_STATEMENTS)
+  {
+    sqlite3_finalize(m_statements.back().second);
+    m_statementIndex.erase(m_statements.back().first);
+    m_statements.pop_back();
+  }
+}
+
+void SqliteDatabase::clear_statements()
+{
+  for (const auto& [sql, stmt] : m_statements)
+    sqlite3_finalize(stmt);
+  m_statements.clear();
+  m_statementIndex.clear();
+}
+
 //************* SqliteDataset implementation ***************
 
 SqliteDataset::~SqliteDataset() = default;
@@ -940,6 +1042,145 @@ bool SqliteDataset::query(const std::string& query)
       SQLITE_OK)
     throw DbErrors("%s", db->getErrorMsg());
 
+  fetch_rows(stmt);
+
+  if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
+  {
+    active = true;
+    ds_state = dsSelect;
+    this->first();
+    return true;
+  }
+  else
+  {
+    throw DbErrors("%s", db->getErrorMsg());
+  }
+}
+
+bool SqliteDataset::query(const std::string& sql, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  if (sql.find("SELECT") == std::string::npos && sql.find("select") == std::string::npos)
+    throw DbErrors("MUST be select SQL!");
+
+  close();
+
+  auto* sqliteDb = static_cast<SqliteDatabase*>(db);
+  sqlite3_stmt* stmt = sqliteDb->get_statement(sql);
+
+  int res = SQLITE_OK;
+  try
+  {
+    bind_params(stmt, params);
+    fetch_rows(stmt);
+    // reset reports the error of a failed step
+    res = db->setErr(sqlite3_reset(stmt), sql.c_str());
+  }
+  catch (...)
+  {
+    sqliteDb->release_statement(sql, stmt);
+    throw;
+  }
+  sqliteDb->release_statement(sql, stmt);
+
+  if (res != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
+int SqliteDataset::exec(const std::string& sql, const BindList& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  auto* sqliteDb = static_cast<SqliteDatabase*>(db);
+  sqlite3_stmt* stmt = sqliteDb->get_statement(sql);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  int res = SQLITE_OK;
+  try
+  {
+    bind_params(stmt, params);
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+      ;
+    res = db->setErr(sqlite3_reset(stmt), sql.c_str());
+  }
+  catch (...)
+  {
+    sqliteDb->release_statement(sql, stmt);
+    throw;
+  }
+  sqliteDb->release_statement(sql, stmt);
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for query: {}", duration.count(), sql);
+
+  if (res != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  return res;
+}
+
+void SqliteDataset::bind_params(sqlite3_stmt* stmt, const BindList& params)
+{
+  const int numParams = sqlite3_bind_parameter_count(stmt);
+  if (numParams != static_cast<int>(params.size()))
+    throw DbErrors("Query expects %d parameters, got %zu", numParams, params.size());
+
+  for (int i = 0; i < numParams; i++)
+  {
+    const field_value& v = params[i];
+    int res;
+    if (v.get_isNull())
+    {
+      res = sqlite3_bind_null(stmt, i + 1);
+    }
+    else
+    {
+      switch (v.get_fType())
+      {
+        case fType::ft_Boolean:
+          res = sqlite3_bind_int(stmt, i + 1, v.get_asBool() ? 1 : 0);
+          break;
+        case fType::ft_Short:
+        case fType::ft_UShort:
+        case fType::ft_Int:
+        case fType::ft_UInt:
+        case fType::ft_Int64:
+          res = sqlite3_bind_int64(stmt, i + 1, v.get_asInt64());
+          break;
+        case fType::ft_Float:
+        case fType::ft_Double:
+        case fType::ft_LongDouble:
+          res = sqlite3_bind_double(stmt, i + 1, v.get_asDouble());
+          break;
+        default:
+        {
+          const std::string& str = v.get_asString();
+          res = sqlite3_bind_text(stmt, i + 1, str.c_str(), static_cast<int>(str.size()),
+                                  SQLITE_TRANSIENT);
+          break;
+        }
+      }
+    }
+    if (db->setErr(res, sqlite3_sql(stmt)) != SQLITE_OK)
+      throw DbErrors("%s", db->getErrorMsg());
+  }
+}
+
+void SqliteDataset::fetch_rows(sqlite3_stmt* stmt)
+{
   // column headers
   const unsigned int numColumns = sqlite3_column_count(stmt);
   result.record_header.resize(numColumns);
@@ -979,17 +1220,6 @@ bool SqliteDataset::query(const std::string& query)
     }
     result.records.push_back(res);
   }
-  if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
-  {
-    active = true;
-    ds_state = dsSelect;
-    this->first();
-    return true;
-  }
-  else
-  {
-    throw DbErrors("%s", db->getErrorMsg());
-  }
 }
 
 void SqliteDataset::open(const std::string& sql)
@@ -14,9 +14,13 @@
 
 #include "dataset.h"
 
+#include <list>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace dbiplus
 {
@@ -31,6 +35,8 @@ protected:
   /* connect descriptor */
   sqlite3* conn{nullptr};
   bool _in_transaction{false};
+  bool _wal_mode{false};
+  bool _query_only{false};
   int last_err;
 
 public:
@@ -52,6 +58,11 @@ public:
   void setHostName(const char* newHost) override;
   /* sets a database name */
   void setDatabase(const char* newDb) override;
+  /* use write-ahead logging so readers do not wait for writers, applied by postconnect().
+     Not suitable for databases on network shares. */
+  void setWalMode(bool wal) { _wal_mode = wal; }
+  /* reject any statement that modifies the database, applied by postconnect() */
+  void setQueryOnly(bool queryOnly) { _query_only = queryOnly; }
 
   /* func. connects to database-server */
   int connect(bool create) override;
@@ -84,6 +95,26 @@ public:
   std::string vprepare(const char* format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+
+  /*! \brief Take a compiled statement for sql out of the statement cache.
+   The statement is prepared if it is not cached. It must be handed back with release_statement()
+   once stepping is done, so that a statement is never shared by two datasets at the same time.
+   \return the statement, throws DbErrors if sql does not compile.
+   */
+  sqlite3_stmt* get_statement(const std::string& sql);
+  /*! \brief Reset stmt and return it to the statement cache as the most recently used entry.
+   The least recently used statement is finalized once the cache is full.
+   */
+  void release_statement(const std::string& sql, sqlite3_stmt* stmt);
+
+private:
+  void clear_statements();
+
+  static constexpr size_t MAX_CACHED_STATEMENTS = 128;
+
+  using StatementList = std::list<std::pair<std::string, sqlite3_stmt*>>;
+  StatementList m_statements; // most recently used first
+  std::unordered_map<std::string, StatementList::iterator> m_statementIndex;
 };
 
 /***************** Class SqliteDataset definition *******************
@@ -114,6 +145,11 @@ protected:
   /* Changing field values during dataset navigation */
   virtual void free_row(); // free the memory allocated for the current row
 
+  /* Binds params to the '?' placeholders of stmt */
+  void bind_params(sqlite3_stmt* stmt, const BindList& params);
+  /* Fills the result set with the rows returned by stmt */
+  void fetch_rows(sqlite3_stmt* stmt);
+
 public:
   /* constructor */
   using Dataset::Dataset;
@@ -131,9 +167,11 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  int exec(const std::string& sql, const BindList& params) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  bool query(const std::string& sql, const BindList& params) override;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
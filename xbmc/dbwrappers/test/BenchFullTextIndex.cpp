@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/FullTextIndex.h"
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace dbiplus;
+
+namespace
+{
+constexpr std::array WORDS = {"news",    "weather", "football", "crime",  "family", "history",
+                              "science", "nature",  "cooking",  "travel", "music",  "comedy",
+                              "drama",   "police",  "doctor",   "island", "garden", "mountain"};
+
+const CFullTextIndex& GetIndex()
+{
+  static const CFullTextIndex index{"epgtags", "idBroadcast", {"sTitle", "sPlot"},
+                                    CFullTextIndex::Tokenizer::TRIGRAM};
+  return index;
+}
+
+std::string MakeText(std::mt19937& random, int words)
+{
+  std::string text;
+  for (int i = 0; i < words; ++i)
+  {
+    text += WORDS[random() % WORDS.size()];
+    text += std::to_string(random() % 1000);
+    text += ' ';
+  }
+  return text;
+}
+
+// a guide of a few weeks over a few hundred channels, as the EPG search sees it
+class CGuide
+{
+public:
+  explicit CGuide(int rows)
+  {
+    m_db.setHostName(CSpecialProtocol::TranslatePath("special://temp/").c_str());
+    m_db.setDatabase("BenchFullTextIndex.db");
+    m_db.connect(true);
+    m_ds.reset(m_db.CreateDataset());
+    m_ds->exec("DROP TABLE IF EXISTS epgtags_fts");
+    m_ds->exec("DROP TABLE IF EXISTS epgtags");
+    m_ds->exec("CREATE TABLE epgtags (idBroadcast INTEGER PRIMARY KEY, sTitle TEXT, sPlot TEXT)");
+
+    std::mt19937 random(42);
+    m_db.start_transaction();
+    for (int i = 0; i < rows; ++i)
+      m_ds->exec("INSERT INTO epgtags (sTitle, sPlot) VALUES (?, ?)",
+                 make_bind_list(MakeText(random, 3), MakeText(random, 40)));
+    m_db.commit_transaction();
+
+    if (GetIndex().IsSupported(*m_ds))
+      GetIndex().Create(*m_ds);
+  }
+
+  ~CGuide()
+  {
+    m_ds.reset();
+    m_db.disconnect();
+    std::remove(CSpecialProtocol::TranslatePath("special://temp/BenchFullTextIndex.db").c_str());
+  }
+
+  int Count(const std::string& where)
+  {
+    m_ds->query("SELECT COUNT(*) FROM epgtags WHERE " + where);
+    const int count = m_ds->fv(0).get_asInt();
+    m_ds->close();
+    return count;
+  }
+
+  bool HasIndex() { return GetIndex().Exists(*m_ds); }
+
+private:
+  SqliteDatabase m_db;
+  std::unique_ptr<Dataset> m_ds;
+};
+
+void BM_Search(benchmark::State& state, const std::string& text, bool useIndex)
+{
+  CGuide guide(state.range(0));
+  if (useIndex && !guide.HasIndex())
+  {
+    state.SkipWithError("SQLite without FTS5 trigram tokenizer");
+    return;
+  }
+
+  std::string where = "(sTitle LIKE '%" + text + "%' OR sPlot LIKE '%" + text + "%')";
+  if (useIndex)
+    where += " AND " + GetIndex().Search("idBroadcast", text);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(guide.Count(where));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_Search, LikeRare, std::string("island123"), false)->Arg(100000);
+BENCHMARK_CAPTURE(BM_Search, IndexRare, std::string("island123"), true)->Arg(100000);
+BENCHMARK_CAPTURE(BM_Search, LikeCommon, std::string("football"), false)->Arg(100000);
+BENCHMARK_CAPTURE(BM_Search, IndexCommon, std::string("football"), true)->Arg(100000);
+} // namespace
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace dbiplus;
+
+namespace
+{
+// the path and file lookups a video scan makes for every file it adds
+class CLibrary
+{
+public:
+  explicit CLibrary(bool bind) : m_bind(bind)
+  {
+    m_db.setHostName(CSpecialProtocol::TranslatePath("special://temp/").c_str());
+    m_db.setDatabase("BenchSqliteDataset.db");
+    m_db.connect(true);
+    m_ds.reset(m_db.CreateDataset());
+    m_ds->exec("DROP TABLE IF EXISTS files");
+    m_ds->exec("DROP TABLE IF EXISTS path");
+    m_ds->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT)");
+    m_ds->exec("CREATE UNIQUE INDEX ix_path ON path (strPath)");
+    m_ds->exec("CREATE TABLE files (idFile INTEGER PRIMARY KEY, idPath INTEGER, "
+               "strFilename TEXT)");
+    m_ds->exec("CREATE INDEX ix_files ON files (idPath, strFilename)");
+  }
+
+  ~CLibrary()
+  {
+    m_ds.reset();
+    m_db.disconnect();
+    std::remove(CSpecialProtocol::TranslatePath("special://temp/BenchSqliteDataset.db").c_str());
+  }
+
+  int AddFile(const std::string& path, const std::string& file)
+  {
+    int idPath = GetId("SELECT idPath FROM path WHERE strPath=?", make_bind_list(path));
+    if (idPath < 0)
+    {
+      Exec("INSERT INTO path (idPath, strPath) VALUES (NULL, ?)", make_bind_list(path));
+      idPath = static_cast<int>(m_ds->lastinsertid());
+    }
+
+    const int idFile = GetId("SELECT idFile FROM files WHERE idPath=? AND strFilename=?",
+                             make_bind_list(idPath, file));
+    if (idFile >= 0)
+      return idFile;
+
+    Exec("INSERT INTO files (idFile, idPath, strFilename) VALUES (NULL, ?, ?)",
+         make_bind_list(idPath, file));
+    return static_cast<int>(m_ds->lastinsertid());
+  }
+
+  void Begin() { m_db.start_transaction(); }
+  void Commit() { m_db.commit_transaction(); }
+
+private:
+  // formatting the values into the statement is what the scanners did before binding them
+  int GetId(const std::string& sql, const BindList& params)
+  {
+    if (m_bind)
+      m_ds->query(sql, params);
+    else
+      m_ds->query(m_ds->format_sql(sql, params));
+
+    const int id = m_ds->eof() ? -1 : m_ds->fv(0).get_asInt();
+    m_ds->close();
+    return id;
+  }
+
+  void Exec(const std::string& sql, const BindList& params)
+  {
+    if (m_bind)
+      m_ds->exec(sql, params);
+    else
+      m_ds->exec(m_ds->format_sql(sql, params));
+  }
+
+  const bool m_bind;
+  SqliteDatabase m_db;
+  std::unique_ptr<Dataset> m_ds;
+};
+
+void BM_AddFiles(benchmark::State& state, bool bind)
+{
+  const int files = static_cast<int>(state.range(0));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto library = std::make_unique<CLibrary>(bind);
+    state.ResumeTiming();
+
+    // all in one transaction like a scan, ten files per folder
+    library->Begin();
+    for (int i = 0; i < files; ++i)
+      benchmark::DoNotOptimize(library->AddFile(
+          "/storage/movies/Movie " + std::to_string(i / 10) + "/",
+          "Movie " + std::to_string(i) + ".mkv"));
+    library->Commit();
+
+    state.PauseTiming();
+    library.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * files);
+}
+BENCHMARK_CAPTURE(BM_AddFiles, Formatted, false)->Arg(5000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_AddFiles, Bound, true)->Arg(5000)->Unit(benchmark::kMillisecond);
+} // namespace
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/DatabaseReaderPool.h"
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+class TestDatabaseReaderPool : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    host = CSpecialProtocol::TranslatePath("special://temp/");
+    writer.setHostName(host.c_str());
+    writer.setDatabase(NAME);
+    writer.setWalMode(true);
+    ASSERT_EQ(static_cast<int>(DB_CONNECTION_OK), writer.connect(true));
+    writer.postconnect();
+    ds.reset(writer.CreateDataset());
+    ds->exec("DROP TABLE IF EXISTS item");
+    ds->exec("CREATE TABLE item (idItem INTEGER PRIMARY KEY, strName TEXT)");
+    ds->exec("INSERT INTO item (strName) VALUES ('committed')");
+  }
+
+  void TearDown() override
+  {
+    CDatabaseReaderPool::GetInstance().Clear();
+    ds.reset();
+    writer.disconnect();
+    const std::string path = host + NAME;
+    for (const char* suffix : {"", "-wal", "-shm"})
+      std::remove((path + suffix).c_str());
+  }
+
+  static constexpr const char* NAME = "TestDatabaseReaderPool.db";
+
+  std::string host;
+  SqliteDatabase writer;
+  std::unique_ptr<Dataset> ds;
+};
+
+TEST_F(TestDatabaseReaderPool, ReadDuringWrite)
+{
+  auto reader = CDatabaseReaderPool::GetInstance().Acquire(host, NAME, 1);
+  ASSERT_TRUE(reader);
+  std::unique_ptr<Dataset> readDS(reader->CreateDataset());
+
+  writer.start_transaction();
+  ds->exec("INSERT INTO item (strName) VALUES ('uncommitted')");
+
+  // the reader neither waits for the open write transaction nor sees its changes
+  ASSERT_TRUE(readDS->query("SELECT COUNT(*) FROM item"));
+  EXPECT_EQ(1, readDS->fv(0).get_asInt());
+
+  writer.commit_transaction();
+  ASSERT_TRUE(readDS->query("SELECT COUNT(*) FROM item"));
+  EXPECT_EQ(2, readDS->fv(0).get_asInt());
+
+  EXPECT_THROW(readDS->exec("DELETE FROM item"), DbErrors);
+}
+
+TEST_F(TestDatabaseReaderPool, Limit)
+{
+  CDatabaseReaderPool& pool = CDatabaseReaderPool::GetInstance();
+  auto first = pool.Acquire(host, NAME, 2);
+  auto second = pool.Acquire(host, NAME, 2);
+  EXPECT_TRUE(first);
+  EXPECT_TRUE(second);
+  EXPECT_FALSE(pool.Acquire(host, NAME, 2));
+
+  // a returned connection is handed out again
+  first = {};
+  auto third = pool.Acquire(host, NAME, 2);
+  EXPECT_TRUE(third);
+  EXPECT_FALSE(pool.Acquire(host, NAME, 2));
+}
+
+TEST_F(TestDatabaseReaderPool, MissingDatabase)
+{
+  EXPECT_FALSE(CDatabaseReaderPool::GetInstance().Acquire(host, "missing.db", 2));
+}
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/FullTextIndex.h"
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+class TestFullTextIndex : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    db.setHostName(CSpecialProtocol::TranslatePath("special://temp/").c_str());
+    db.setDatabase("TestFullTextIndex.db");
+    ASSERT_EQ(static_cast<int>(DB_CONNECTION_OK), db.connect(true));
+    ds.reset(db.CreateDataset());
+    ds->exec("DROP TABLE IF EXISTS show_fts");
+    ds->exec("DROP TABLE IF EXISTS show");
+    ds->exec("CREATE TABLE show (idShow INTEGER PRIMARY KEY, idChannel INTEGER, iStart INTEGER, "
+             "sTitle TEXT, sPlot TEXT)");
+    ds->exec("CREATE UNIQUE INDEX ix_show ON show (idChannel, iStart)");
+    ds->exec("PRAGMA recursive_triggers = ON");
+  }
+
+  void TearDown() override
+  {
+    ds.reset();
+    db.disconnect();
+    std::remove(CSpecialProtocol::TranslatePath("special://temp/TestFullTextIndex.db").c_str());
+  }
+
+  void Insert(int channel, int start, const std::string& title, const std::string& plot)
+  {
+    ds->exec("REPLACE INTO show (idChannel, iStart, sTitle, sPlot) VALUES (?, ?, ?, ?)",
+             make_bind_list(channel, start, title, plot));
+  }
+
+  std::vector<int> Find(const std::string& condition)
+  {
+    std::vector<int> ids;
+    if (condition.empty() || !ds->query("SELECT idShow FROM show WHERE " + condition +
+                                        " ORDER BY idShow"))
+      return ids;
+
+    while (!ds->eof())
+    {
+      ids.emplace_back(ds->fv(0).get_asInt());
+      ds->next();
+    }
+    ds->close();
+    return ids;
+  }
+
+  SqliteDatabase db;
+  std::unique_ptr<Dataset> ds;
+};
+
+TEST_F(TestFullTextIndex, CanSearch)
+{
+  using enum CFullTextIndex::Tokenizer;
+  EXPECT_TRUE(CFullTextIndex::CanSearch("abc", TRIGRAM));
+  EXPECT_TRUE(CFullTextIndex::CanSearch("Ärg", TRIGRAM));
+  EXPECT_FALSE(CFullTextIndex::CanSearch("ab", TRIGRAM));
+  EXPECT_FALSE(CFullTextIndex::CanSearch("Är", TRIGRAM));
+  EXPECT_FALSE(CFullTextIndex::CanSearch("a_bc", TRIGRAM));
+  EXPECT_FALSE(CFullTextIndex::CanSearch("100%", TRIGRAM));
+
+  EXPECT_TRUE(CFullTextIndex::CanSearch("a", WORDS));
+  EXPECT_TRUE(CFullTextIndex::CanSearch("東京", WORDS));
+  EXPECT_TRUE(CFullTextIndex::CanSearch("- b", WORDS));
+  EXPECT_FALSE(CFullTextIndex::CanSearch("★ -", WORDS));
+  EXPECT_FALSE(CFullTextIndex::CanSearch("", WORDS));
+}
+
+TEST_F(TestFullTextIndex, Query)
+{
+  EXPECT_EQ("\"say \"\"hi\"\"\"", CFullTextIndex::Phrase("say \"hi\""));
+  EXPECT_EQ("{sTitle sPlot} : (\"a\" OR \"b\")",
+            CFullTextIndex::ColumnFilter({"sTitle", "sPlot"}, "\"a\" OR \"b\""));
+
+  const CFullTextIndex index{"show", "idShow", {"sTitle"}, CFullTextIndex::Tokenizer::TRIGRAM};
+  EXPECT_EQ("show.idShow IN (SELECT rowid FROM show_fts WHERE show_fts MATCH '\"it''s\"')",
+            index.Match("show.idShow", "\"it's\""));
+  EXPECT_EQ("", index.Search("show.idShow", "it"));
+}
+
+TEST_F(TestFullTextIndex, FollowsWrites)
+{
+  const CFullTextIndex index{"show", "idShow", {"sTitle", "sPlot"},
+                             CFullTextIndex::Tokenizer::TRIGRAM};
+  if (!index.IsSupported(*ds))
+    GTEST_SKIP() << "SQLite without FTS5 trigram tokenizer";
+
+  Insert(1, 100, "Tagesschau", "Nachrichten");
+  Insert(1, 200, "Tatort", "Krimi");
+
+  EXPECT_FALSE(index.Exists(*ds));
+  index.Create(*ds);
+  EXPECT_TRUE(index.Exists(*ds));
+
+  // existing rows are indexed on creation
+  EXPECT_EQ(std::vector<int>({1}), Find(index.Search("idShow", "gessch")));
+  EXPECT_EQ(std::vector<int>({2}), Find(index.Search("idShow", "KRIMI")));
+  EXPECT_EQ(std::vector<int>({2}), Find(index.Search("idShow", "KRIMI", {"sPlot"})));
+  EXPECT_EQ(std::vector<int>(), Find(index.Search("idShow", "KRIMI", {"sTitle"})));
+
+  // replaced rows get a new key, the old one has to leave the index
+  Insert(1, 100, "Tagesthemen", "Nachrichten");
+  EXPECT_EQ(std::vector<int>(), Find(index.Search("idShow", "schau")));
+  EXPECT_EQ(std::vector<int>({3}), Find(index.Search("idShow", "themen")));
+
+  ds->exec("UPDATE show SET sTitle = 'Polizeiruf' WHERE idShow = 2");
+  EXPECT_EQ(std::vector<int>(), Find(index.Search("idShow", "Tatort")));
+  EXPECT_EQ(std::vector<int>({2}), Find(index.Search("idShow", "zeiruf")));
+
+  ds->exec("DELETE FROM show WHERE idShow = 3");
+  EXPECT_EQ(std::vector<int>(), Find(index.Search("idShow", "Nachrichten")));
+
+  ds->exec("INSERT INTO show_fts(show_fts, rank) VALUES('integrity-check', 1)");
+}
+
+TEST_F(TestFullTextIndex, WordPrefixes)
+{
+  const CFullTextIndex index{"show", "idShow", {"sTitle"}, CFullTextIndex::Tokenizer::WORDS};
+  if (!index.IsSupported(*ds))
+    GTEST_SKIP() << "SQLite without FTS5";
+
+  index.Create(*ds);
+  Insert(1, 100, "The Dark Side of the Moon", "");
+  Insert(1, 200, "AC/DC Live", "");
+  Insert(1, 300, "Sidewinder", "");
+
+  EXPECT_EQ(std::vector<int>({1}), Find(index.Search("idShow", "dark si")));
+  EXPECT_EQ(std::vector<int>({1, 3}), Find(index.Search("idShow", "side")));
+  EXPECT_EQ(std::vector<int>({2}), Find(index.Search("idShow", "ac/")));
+  EXPECT_EQ(std::vector<int>(), Find(index.Search("idShow", "ark")));
+}
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+class TestSqliteDataset : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    db.setHostName(CSpecialProtocol::TranslatePath("special://temp/").c_str());
+    db.setDatabase("TestSqliteDataset.db");
+    ASSERT_EQ(static_cast<int>(DB_CONNECTION_OK), db.connect(true));
+    ds.reset(db.CreateDataset());
+    ds->exec("DROP TABLE IF EXISTS path");
+    ds->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT, dValue REAL)");
+  }
+
+  void TearDown() override
+  {
+    ds.reset();
+    db.disconnect();
+    std::remove(CSpecialProtocol::TranslatePath("special://temp/TestSqliteDataset.db").c_str());
+  }
+
+  SqliteDatabase db;
+  std::unique_ptr<Dataset> ds;
+};
+
+TEST_F(TestSqliteDataset, BoundValues)
+{
+  field_value null;
+  null.set_isNull();
+  ds->exec("INSERT INTO path (strPath, dValue) VALUES (?, ?)", make_bind_list("it's", 0.5));
+  ds->exec("INSERT INTO path (strPath, dValue) VALUES (?, ?)", BindList{field_value("b"), null});
+
+  ASSERT_TRUE(
+      ds->query("SELECT idPath, dValue FROM path WHERE strPath = ?", make_bind_list("it's")));
+  ASSERT_EQ(1, ds->num_rows());
+  EXPECT_EQ(1, ds->fv(0).get_asInt());
+  EXPECT_DOUBLE_EQ(0.5, ds->fv(1).get_asDouble());
+
+  ASSERT_TRUE(ds->query("SELECT idPath, dValue FROM path WHERE strPath = ?", make_bind_list("b")));
+  ASSERT_EQ(1, ds->num_rows());
+  EXPECT_TRUE(ds->fv(1).get_isNull());
+}
+
+TEST_F(TestSqliteDataset, StatementReuse)
+{
+  for (int i = 0; i < 500; i++)
+    ds->exec("INSERT INTO path (strPath) VALUES (?)", make_bind_list(std::to_string(i)));
+
+  // a second dataset checks out the same statement while the first one holds results
+  std::unique_ptr<Dataset> ds2(db.CreateDataset());
+  ASSERT_TRUE(ds->query("SELECT idPath FROM path WHERE strPath = ?", make_bind_list("10")));
+  ASSERT_TRUE(ds2->query("SELECT idPath FROM path WHERE strPath = ?", make_bind_list("20")));
+  EXPECT_EQ(11, ds->fv(0).get_asInt());
+  EXPECT_EQ(21, ds2->fv(0).get_asInt());
+
+  // more distinct statements than the cache holds
+  for (int i = 0; i < 300; i++)
+  {
+    ASSERT_TRUE(ds->query("SELECT " + std::to_string(i) + " FROM path WHERE idPath = ?",
+                          make_bind_list(1)));
+    EXPECT_EQ(i, ds->fv(0).get_asInt());
+  }
+}
+
+TEST_F(TestSqliteDataset, Errors)
+{
+  EXPECT_THROW(ds->query("SELECT x FROM missing WHERE a = ?", make_bind_list(1)), DbErrors);
+  EXPECT_THROW(ds->exec("INSERT INTO path (strPath) VALUES (?)", make_bind_list("a", "b")),
+               DbErrors);
+
+  // a failed statement is still reusable afterwards
+  ds->exec("INSERT INTO path (strPath) VALUES (?)", make_bind_list("a"));
+  ASSERT_TRUE(ds->query("SELECT COUNT(*) FROM path WHERE strPath = ?", make_bind_list("a")));
+  EXPECT_EQ(1, ds->fv(0).get_asInt());
+}
+
+TEST_F(TestSqliteDataset, FormatSql)
+{
+  EXPECT_EQ("SELECT 1 WHERE a = 'o''k' AND b = '?' AND c = 3",
+            ds->format_sql("SELECT 1 WHERE a = ? AND b = '?' AND c = ?", make_bind_list("o'k", 3)));
+  EXPECT_THROW(ds->format_sql("SELECT ?", {}), DbErrors);
+}
@@ -55,6 +55,11 @@ public:
 
   virtual CCacheStrategy *CreateNew() = 0;
 
+  /*!
+   \brief Whether data before the last Reset() stays available, making double buffering moot
+   */
+  virtual bool IsMultiRange() const { return false; }
+
   CEvent m_space;
 protected:
   bool  m_bEndOfInput = false;
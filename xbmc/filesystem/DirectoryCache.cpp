@@ -12,67 +12,146 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "URL.h"
+#include "music/tags/MusicInfoTag.h"
+#include "pictures/PictureInfoTag.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
+#include "video/VideoInfoTag.h"
 
 #include <algorithm>
-#include <climits>
+#include <functional>
+#include <limits>
 #include <mutex>
-
-// Maximum number of directories to keep in our cache
-#define MAX_CACHED_DIRS 50
+#include <shared_mutex>
 
 using namespace XFILE;
+using namespace std::chrono_literals;
 
-CDirectoryCache::CDir::CDir(CacheType cacheType) : m_Items(std::make_unique<CFileItemList>())
+namespace
 {
-  m_cacheType = cacheType;
-  m_lastAccess = 0;
-  m_Items->SetIgnoreURLOptions(true);
-  m_Items->SetFastLookup(true);
-}
+// Default memory budget for all cached directories
+constexpr size_t DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;
 
-CDirectoryCache::CDir::~CDir() = default;
+// Listings of remote sources go stale without us being told, local ones are cleared explicitly
+constexpr std::chrono::milliseconds NETWORK_TTL = 5min;
+constexpr std::chrono::milliseconds UPNP_TTL = 1min;
+
+// Rough per entry overhead of the containers and the fast lookup map of a CFileItemList
+constexpr size_t ITEM_OVERHEAD = 128;
+
+constexpr auto NEVER_EXPIRES = std::chrono::steady_clock::time_point::max();
+} // unnamed namespace
 
-void CDirectoryCache::CDir::SetLastAccess(unsigned int &accessCounter)
+CDirectoryCache::CDir::CDir(std::unique_ptr<CFileItemList> items,
+                            CacheType cacheType,
+                            std::chrono::steady_clock::time_point expires)
+  : m_Items(std::move(items)),
+    m_cacheType(cacheType),
+    m_expires(expires)
 {
-  m_lastAccess = accessCounter++;
 }
 
-CDirectoryCache::CDirectoryCache(void)
+CDirectoryCache::CDir::~CDir() = default;
+
+CDirectoryCache::CDirectoryCache(void) : m_budget(DEFAULT_MEMORY_BUDGET)
 {
-  m_accessCounter = 0;
-#ifdef _DEBUG
-  m_cacheHits = 0;
-  m_cacheMisses = 0;
-#endif
+  for (const char* protocol : {"smb", "nfs", "ftp", "ftps", "sftp", "dav", "davs", "http", "https"})
+    m_ttl.emplace(protocol, NETWORK_TTL);
+  m_ttl.emplace("upnp", UPNP_TTL);
 }
 
 CDirectoryCache::~CDirectoryCache(void) = default;
 
-bool CDirectoryCache::GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll)
+std::string CDirectoryCache::GetStoredPath(const std::string& strPath)
 {
-  std::unique_lock lock(m_cs);
-
   // Get rid of any URL options, else the compare may be wrong
   std::string storedPath = CURL(strPath).GetWithoutOptions();
   URIUtils::RemoveSlashAtEnd(storedPath);
+  return storedPath;
+}
+
+size_t CDirectoryCache::EstimateSize(const CFileItemList& items)
+{
+  // an estimate is good enough to keep the cache bounded, walking every string of every tag
+  // would cost more than it is worth
+  size_t size = sizeof(CFileItemList);
+  for (const auto& item : items)
+  {
+    size += sizeof(CFileItem) + ITEM_OVERHEAD;
+    size += item->GetPath().capacity() * 2 + item->GetDynPath().capacity();
+    size += item->GetLabel().capacity() + item->GetLabel2().capacity();
+    size += item->GetProperties().size() * ITEM_OVERHEAD;
+    if (item->HasVideoInfoTag())
+      size += sizeof(CVideoInfoTag);
+    if (item->HasMusicInfoTag())
+      size += sizeof(MUSIC_INFO::CMusicInfoTag);
+    if (item->HasPictureInfoTag())
+      size += sizeof(CPictureInfoTag);
+  }
+  return size;
+}
+
+CDirectoryCache::CShard& CDirectoryCache::GetShard(const std::string& storedPath)
+{
+  return m_shards[std::hash<std::string>{}(storedPath) % NUM_SHARDS];
+}
+
+std::chrono::steady_clock::time_point CDirectoryCache::GetExpiry(const std::string& protocol) const
+{
+  std::shared_lock lock(m_ttlSection);
+  const auto it = m_ttl.find(StringUtils::ToLower(protocol));
+  if (it == m_ttl.end() || it->second <= 0ms)
+    return NEVER_EXPIRES;
+  return std::chrono::steady_clock::now() + it->second;
+}
+
+void CDirectoryCache::Erase(CShard& shard, std::map<std::string, CDir>::iterator it)
+{
+  m_bytes -= it->second.m_size;
+  shard.m_dirs.erase(it);
+}
+
+bool CDirectoryCache::GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll)
+{
+  const std::string storedPath = GetStoredPath(strPath);
+  CShard& shard = GetShard(storedPath);
 
-  auto i = m_cache.find(storedPath);
-  if (i != m_cache.end())
   {
+    std::shared_lock lock(shard.m_section);
+
+    auto i = shard.m_dirs.find(storedPath);
+    if (i == shard.m_dirs.end())
+    {
+      m_misses++;
+      return false;
+    }
+
     CDir& dir = i->second;
-    if (dir.m_cacheType == CacheType::ALWAYS || (dir.m_cacheType == CacheType::ONCE && retrieveAll))
+    if (!dir.IsExpired(std::chrono::steady_clock::now()))
     {
-      items.Copy(*dir.m_Items);
-      dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
-      m_cacheHits+=items.Size();
-#endif
-      return true;
+      if (dir.m_cacheType == CacheType::ALWAYS ||
+          (dir.m_cacheType == CacheType::ONCE && retrieveAll))
+      {
+        items.Copy(*dir.m_Items);
+        dir.SetLastAccess(m_accessCounter++);
+        m_hits++;
+        return true;
+      }
+      m_misses++;
+      return false;
     }
   }
+
+  // expired, drop it so the caller's fresh listing replaces it
+  std::unique_lock lock(shard.m_section);
+  auto i = shard.m_dirs.find(storedPath);
+  if (i != shard.m_dirs.end() && i->second.IsExpired(std::chrono::steady_clock::now()))
+  {
+    Erase(shard, i);
+    m_expirations++;
+  }
+  m_misses++;
   return false;
 }
 
@@ -94,80 +173,95 @@ void CDirectoryCache::SetDirectory(const std::string& strPath,
   // IDEALLY, any further processing on the item would actually create a new item
   // instead of altering it, but we can't really enforce that in an easy way, so
   // this is the best solution for now.
-  std::unique_lock lock(m_cs);
-
-  // Get rid of any URL options, else the compare may be wrong
-  std::string storedPath = CURL(strPath).GetWithoutOptions();
+  const CURL url(strPath);
+  std::string storedPath = url.GetWithoutOptions();
   URIUtils::RemoveSlashAtEnd(storedPath);
 
-  ClearDirectory(storedPath);
+  // build the copy outside of the lock, it is the expensive part
+  auto expires = GetExpiry(url.GetProtocol());
+  auto copy = std::make_unique<CFileItemList>();
+  copy->SetIgnoreURLOptions(true);
+  copy->SetFastLookup(true);
+  copy->Copy(items);
+  const size_t size = EstimateSize(*copy);
+
+  CShard& shard = GetShard(storedPath);
+  {
+    std::unique_lock lock(shard.m_section);
 
-  CheckIfFull();
+    auto i = shard.m_dirs.find(storedPath);
+    if (i != shard.m_dirs.end())
+      Erase(shard, i);
+
+    auto [dir, inserted] =
+        shard.m_dirs.try_emplace(storedPath, std::move(copy), cacheType, expires);
+    dir->second.m_size = size;
+    dir->second.SetLastAccess(m_accessCounter++);
+    m_bytes += size;
+  }
 
-  CDir dir(cacheType);
-  dir.m_Items->Copy(items);
-  dir.SetLastAccess(m_accessCounter);
-  m_cache.emplace(storedPath, std::move(dir));
+  EvictIfFull(storedPath);
 }
 
 void CDirectoryCache::ClearFile(const std::string& strFile)
 {
-  // Get rid of any URL options, else the compare may be wrong
-  std::string strFile2 = CURL(strFile).GetWithoutOptions();
-  URIUtils::RemoveSlashAtEnd(strFile2);
-
-  ClearDirectory(URIUtils::GetDirectory(strFile2));
+  ClearDirectory(URIUtils::GetDirectory(GetStoredPath(strFile)));
 }
 
 void CDirectoryCache::ClearDirectory(const std::string& strPath)
 {
-  std::unique_lock lock(m_cs);
-
-  // Get rid of any URL options, else the compare may be wrong
-  std::string storedPath = CURL(strPath).GetWithoutOptions();
-  URIUtils::RemoveSlashAtEnd(storedPath);
+  const std::string storedPath = GetStoredPath(strPath);
+  CShard& shard = GetShard(storedPath);
 
-  m_cache.erase(storedPath);
+  std::unique_lock lock(shard.m_section);
+  auto i = shard.m_dirs.find(storedPath);
+  if (i != shard.m_dirs.end())
+    Erase(shard, i);
 }
 
 void CDirectoryCache::ClearSubPaths(const std::string& strPath)
 {
-  std::unique_lock lock(m_cs);
-
   // Get rid of any URL options, else the compare may be wrong
   std::string storedPath = CURL(strPath).GetWithoutOptions();
 
-  auto i = m_cache.begin();
-  while (i != m_cache.end())
+  for (CShard& shard : m_shards)
   {
-    if (URIUtils::PathHasParent(i->first, storedPath))
-      m_cache.erase(i++);
-    else
-      i++;
+    std::unique_lock lock(shard.m_section);
+    auto i = shard.m_dirs.begin();
+    while (i != shard.m_dirs.end())
+    {
+      if (URIUtils::PathHasParent(i->first, storedPath))
+        Erase(shard, i++);
+      else
+        i++;
+    }
   }
 }
 
 void CDirectoryCache::AddFile(const std::string& strFile)
 {
-  std::unique_lock lock(m_cs);
-
   // Get rid of any URL options, else the compare may be wrong
   std::string strPath = URIUtils::GetDirectory(CURL(strFile).GetWithoutOptions());
   URIUtils::RemoveSlashAtEnd(strPath);
+  CShard& shard = GetShard(strPath);
 
-  auto i = m_cache.find(strPath);
-  if (i != m_cache.end())
+  std::unique_lock lock(shard.m_section);
+  auto i = shard.m_dirs.find(strPath);
+  if (i != shard.m_dirs.end())
   {
     CDir& dir = i->second;
     CFileItemPtr item(new CFileItem(strFile, false));
     dir.m_Items->Add(item);
-    dir.SetLastAccess(m_accessCounter);
+    dir.SetLastAccess(m_accessCounter++);
+
+    const size_t size = sizeof(CFileItem) + ITEM_OVERHEAD + strFile.capacity() * 2;
+    dir.m_size += size;
+    m_bytes += size;
   }
 }
 
 bool CDirectoryCache::FileExists(const std::string& strFile, bool& bInCache)
 {
-  std::unique_lock lock(m_cs);
   bInCache = false;
 
   // Get rid of any URL options, else the compare may be wrong
@@ -175,29 +269,43 @@ bool CDirectoryCache::FileExists(const std::string& strFile, bool& bInCache)
   URIUtils::RemoveSlashAtEnd(strPath);
   std::string storedPath = URIUtils::GetDirectory(strPath);
   URIUtils::RemoveSlashAtEnd(storedPath);
+  CShard& shard = GetShard(storedPath);
 
-  auto i = m_cache.find(storedPath);
-  if (i != m_cache.end())
+  std::shared_lock lock(shard.m_section);
+  auto i = shard.m_dirs.find(storedPath);
+  if (i != shard.m_dirs.end() && !i->second.IsExpired(std::chrono::steady_clock::now()))
   {
     bInCache = true;
     CDir& dir = i->second;
-    dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
-    m_cacheHits++;
-#endif
+    dir.SetLastAccess(m_accessCounter++);
+    m_hits++;
     return (URIUtils::PathEquals(strPath, storedPath) || dir.m_Items->Contains(strFile));
   }
-#ifdef _DEBUG
-  m_cacheMisses++;
-#endif
+  m_misses++;
   return false;
 }
 
 void CDirectoryCache::Clear()
 {
   // this routine clears everything
-  std::unique_lock lock(m_cs);
-  m_cache.clear();
+  for (CShard& shard : m_shards)
+  {
+    std::unique_lock lock(shard.m_section);
+    while (!shard.m_dirs.empty())
+      Erase(shard, shard.m_dirs.begin());
+  }
+}
+
+void CDirectoryCache::SetMemoryBudget(size_t bytes)
+{
+  m_budget = bytes;
+  EvictIfFull("");
+}
+
+void CDirectoryCache::SetTimeToLive(const std::string& protocol, std::chrono::milliseconds ttl)
+{
+  std::unique_lock lock(m_ttlSection);
+  m_ttl[StringUtils::ToLower(protocol)] = ttl;
 }
 
 void CDirectoryCache::InitCache(const std::set<std::string>& dirs)
@@ -212,56 +320,81 @@ void CDirectoryCache::InitCache(const std::set<std::string>& dirs)
 
 void CDirectoryCache::ClearCache(std::set<std::string>& dirs)
 {
-  auto i = m_cache.begin();
-  while (i != m_cache.end())
+  for (const std::string& dir : dirs)
   {
-    if (dirs.contains(i->first))
-      m_cache.erase(i++);
-    else
-      i++;
+    CShard& shard = GetShard(dir);
+    std::unique_lock lock(shard.m_section);
+    auto i = shard.m_dirs.find(dir);
+    if (i != shard.m_dirs.end())
+      Erase(shard, i);
   }
 }
 
-void CDirectoryCache::CheckIfFull()
+void CDirectoryCache::EvictIfFull(const std::string& keepPath)
 {
-  std::unique_lock lock(m_cs);
-
-  // find the last accessed folder, and remove if the number of cached folders is too many
-  auto lastAccessed = m_cache.end();
-  unsigned int numCached = 0;
-  for (auto i = m_cache.begin(); i != m_cache.end(); i++)
+  // evict the least recently used directories over all shards until we are within budget.
+  // Shards are only locked one at a time, so the candidate is verified again before it goes.
+  // Dirs that are always cached and the one that was just added are never evicted.
+  while (m_bytes > m_budget)
   {
-    // ensure dirs that are always cached aren't cleared
-    if (i->second.m_cacheType != CacheType::ALWAYS)
+    CShard* oldestShard = nullptr;
+    std::string oldestPath;
+    uint64_t oldestAccess = std::numeric_limits<uint64_t>::max();
+
+    for (CShard& shard : m_shards)
     {
-      if (lastAccessed == m_cache.end() ||
-          i->second.GetLastAccess() < lastAccessed->second.GetLastAccess())
-        lastAccessed = i;
-      numCached++;
+      std::shared_lock lock(shard.m_section);
+      for (const auto& [path, dir] : shard.m_dirs)
+      {
+        if (dir.m_cacheType != CacheType::ALWAYS && dir.GetLastAccess() < oldestAccess &&
+            path != keepPath)
+        {
+          oldestAccess = dir.GetLastAccess();
+          oldestPath = path;
+          oldestShard = &shard;
+        }
+      }
+    }
+
+    if (!oldestShard)
+      break;
+
+    std::unique_lock lock(oldestShard->m_section);
+    auto i = oldestShard->m_dirs.find(oldestPath);
+    if (i != oldestShard->m_dirs.end() && i->second.GetLastAccess() == oldestAccess)
+    {
+      Erase(*oldestShard, i);
+      m_evictions++;
     }
   }
-  if (lastAccessed != m_cache.end() && numCached >= MAX_CACHED_DIRS)
-    m_cache.erase(lastAccessed);
 }
 
-#ifdef _DEBUG
-void CDirectoryCache::PrintStats() const
+CDirectoryCache::Stats CDirectoryCache::GetStats() const
 {
-  std::unique_lock lock(m_cs);
-  CLog::Log(LOGDEBUG, "{} - total of {} cache hits, and {} cache misses", __FUNCTION__, m_cacheHits,
-            m_cacheMisses);
-  // run through and find the oldest and the number of items cached
-  unsigned int oldest = UINT_MAX;
-  unsigned int numItems = 0;
-  unsigned int numDirs = 0;
-  for (auto i = m_cache.begin(); i != m_cache.end(); i++)
+  Stats stats;
+  stats.hits = m_hits;
+  stats.misses = m_misses;
+  stats.evictions = m_evictions;
+  stats.expirations = m_expirations;
+  stats.bytes = m_bytes;
+  stats.budget = m_budget;
+
+  for (const CShard& shard : m_shards)
   {
-    const CDir& dir = i->second;
-    oldest = std::min(oldest, dir.GetLastAccess());
-    numItems += dir.m_Items->Size();
-    numDirs++;
+    std::shared_lock lock(shard.m_section);
+    stats.directories += shard.m_dirs.size();
+    for (const auto& [path, dir] : shard.m_dirs)
+      stats.items += dir.m_Items->Size();
   }
-  CLog::Log(LOGDEBUG, "{} - {} folders cached, with {} items total.  Oldest is {}, current is {}",
-            __FUNCTION__, numDirs, numItems, oldest, m_accessCounter);
+  return stats;
+}
+
+void CDirectoryCache::PrintStats() const
+{
+  const Stats stats = GetStats();
+  CLog::Log(LOGDEBUG,
+            "CDirectoryCache::{} - {} hits, {} misses, {} evictions, {} expirations. {} folders "
+            "cached with {} items, using {} of {} bytes",
+            __FUNCTION__, stats.hits, stats.misses, stats.evictions, stats.expirations,
+            stats.directories, stats.items, stats.bytes, stats.budget);
 }
-#endif
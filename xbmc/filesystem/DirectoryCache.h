@@ -9,38 +9,73 @@
 #pragma once
 
 #include "IDirectory.h"
-#include "threads/CriticalSection.h"
+#include "threads/SharedSection.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
 
 class CFileItem;
 
 namespace XFILE
 {
+  /*!
+   * \brief Cache of directory listings, shared by all users of CDirectory and CFile.
+   *
+   * Listings are spread over a fixed number of shards by path so lookups for unrelated paths
+   * don't contend for the same lock. Entries expire after a time to live that depends on the
+   * protocol, and the least recently used ones are evicted once the estimated size of all cached
+   * listings exceeds the memory budget.
+   */
   class CDirectoryCache
   {
     class CDir
     {
     public:
-      explicit CDir(CacheType cacheType);
-      CDir(CDir&& dir) = default;
-      CDir& operator=(CDir&& dir) = default;
+      CDir(std::unique_ptr<CFileItemList> items,
+           CacheType cacheType,
+           std::chrono::steady_clock::time_point expires);
       virtual ~CDir();
 
-      void SetLastAccess(unsigned int &accessCounter);
-      unsigned int GetLastAccess() const { return m_lastAccess; }
+      void SetLastAccess(uint64_t access) { m_lastAccess = access; }
+      uint64_t GetLastAccess() const { return m_lastAccess; }
+      bool IsExpired(std::chrono::steady_clock::time_point now) const { return now >= m_expires; }
 
       std::unique_ptr<CFileItemList> m_Items;
       CacheType m_cacheType;
+      size_t m_size = 0; //!< estimated memory used by m_Items in bytes
 
     private:
       CDir(const CDir&) = delete;
       CDir& operator=(const CDir&) = delete;
-      unsigned int m_lastAccess;
+      std::chrono::steady_clock::time_point m_expires;
+      std::atomic<uint64_t> m_lastAccess{0};
     };
+
+    struct CShard
+    {
+      mutable CSharedSection m_section;
+      std::map<std::string, CDir> m_dirs;
+    };
+
   public:
+    struct Stats
+    {
+      uint64_t hits{0}; //!< lookups answered from the cache
+      uint64_t misses{0}; //!< lookups for directories that were not cached
+      uint64_t evictions{0}; //!< directories dropped to stay within the memory budget
+      uint64_t expirations{0}; //!< directories dropped because their time to live passed
+      size_t directories{0}; //!< directories currently cached
+      size_t items{0}; //!< items in all cached directories
+      size_t bytes{0}; //!< estimated memory used by all cached directories
+      size_t budget{0}; //!< memory budget in bytes
+    };
+
     CDirectoryCache(void);
     virtual ~CDirectoryCache(void);
     bool GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll = false);
@@ -51,24 +86,48 @@ namespace XFILE
     void Clear();
     void AddFile(const std::string& strFile);
     bool FileExists(const std::string& strPath, bool& bInCache);
-#ifdef _DEBUG
+
+    /*!
+     * \brief Set the memory budget in bytes for all cached directories.
+     */
+    void SetMemoryBudget(size_t bytes);
+
+    /*!
+     * \brief Set how long listings of the given protocol stay valid, zero disables expiry.
+     */
+    void SetTimeToLive(const std::string& protocol, std::chrono::milliseconds ttl);
+
+    Stats GetStats() const;
     void PrintStats() const;
-#endif
+
   protected:
     void InitCache(const std::set<std::string>& dirs);
     void ClearCache(std::set<std::string>& dirs);
-    void CheckIfFull();
 
-    std::map<std::string, CDir> m_cache;
+  private:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    static std::string GetStoredPath(const std::string& strPath);
+    static size_t EstimateSize(const CFileItemList& items);
+
+    CShard& GetShard(const std::string& storedPath);
+    std::chrono::steady_clock::time_point GetExpiry(const std::string& protocol) const;
+    void Erase(CShard& shard, std::map<std::string, CDir>::iterator it);
+    void EvictIfFull(const std::string& keepPath);
+
+    std::array<CShard, NUM_SHARDS> m_shards;
 
-    mutable CCriticalSection m_cs;
+    mutable CSharedSection m_ttlSection;
+    std::map<std::string, std::chrono::milliseconds, std::less<>> m_ttl;
 
-    unsigned int m_accessCounter;
+    std::atomic<uint64_t> m_accessCounter{0};
+    std::atomic<size_t> m_bytes{0};
+    std::atomic<size_t> m_budget;
 
-#ifdef _DEBUG
-    unsigned int m_cacheHits;
-    unsigned int m_cacheMisses;
-#endif
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_evictions{0};
+    std::atomic<uint64_t> m_expirations{0};
   };
 }
 extern XFILE::CDirectoryCache g_directoryCache;
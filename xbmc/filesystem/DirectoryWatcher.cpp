@@ -0,0 +1,26 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DirectoryWatcher.h"
+
+#if defined(TARGET_LINUX) && !defined(TARGET_ANDROID) && defined(HAVE_INOTIFY)
+#include "platform/linux/InotifyDirectoryWatcher.h"
+#endif
+
+using namespace XFILE;
+
+std::unique_ptr<IDirectoryWatcher> IDirectoryWatcher::CreateInstance(
+    IDirectoryWatcherCallback& callback)
+{
+#if defined(TARGET_LINUX) && !defined(TARGET_ANDROID) && defined(HAVE_INOTIFY)
+  auto watcher = std::make_unique<CInotifyDirectoryWatcher>(callback);
+  if (watcher->IsValid())
+    return watcher;
+#endif
+  return {};
+}
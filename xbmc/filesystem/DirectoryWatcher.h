@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace XFILE
+{
+/*!
+ \brief Receives change notifications from an IDirectoryWatcher.
+
+ Callbacks are made from the watcher's own thread.
+ */
+class IDirectoryWatcherCallback
+{
+public:
+  virtual ~IDirectoryWatcherCallback() = default;
+
+  /*!
+   \brief An entry of a watched directory was added, removed, renamed or finished writing.
+   \param directory the native path of the directory whose contents changed, with a trailing slash
+   */
+  virtual void OnDirectoryChanged(const std::string& directory) = 0;
+
+  /*!
+   \brief Events were lost, so every watched tree has to be treated as changed.
+   */
+  virtual void OnWatchOverflow() = 0;
+};
+
+/*!
+ \brief Watches local directory trees for changes.
+ */
+class IDirectoryWatcher
+{
+public:
+  virtual ~IDirectoryWatcher() = default;
+
+  /*!
+   \brief Create the watcher for this platform.
+   \return the watcher, or nullptr if the platform can't watch directories
+   */
+  static std::unique_ptr<IDirectoryWatcher> CreateInstance(IDirectoryWatcherCallback& callback);
+
+  /*!
+   \brief Watch a directory and everything below it, including directories created later.
+   \param path native path of the directory, with a trailing slash
+   \return false if the tree could only be watched partially or not at all
+   */
+  virtual bool AddTree(const std::string& path) = 0;
+
+  /*!
+   \brief Stop watching a directory and everything below it.
+   \param path native path of the directory, with a trailing slash
+   */
+  virtual void RemoveTree(const std::string& path) = 0;
+};
+} // namespace XFILE
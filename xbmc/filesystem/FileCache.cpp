@@ -28,6 +28,7 @@
 #include <memory>
 
 #ifdef TARGET_POSIX
+#include "MappedFileCache.h"
 #include "platform/posix/ConvUtils.h"
 #endif
 
@@ -140,7 +141,17 @@ bool CFileCache::Open(const CURL& url)
     if (cacheMemSize == 0)
     {
       // Use cache on disk
-      m_pCache = std::make_unique<CSimpleFileCache>();
+#ifdef TARGET_POSIX
+      // a mapped spill file keeps everything read so far, seeking back won't hit the source again
+      if (sizeof(void*) >= 8 && m_seekPossible > 0 && m_fileSize > 0)
+      {
+        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using mapped disk cache", __FUNCTION__,
+                  m_sourcePath);
+        m_pCache = std::make_unique<CMappedFileCache>(m_fileSize);
+      }
+      else
+#endif
+        m_pCache = std::make_unique<CSimpleFileCache>();
       m_forwardCacheSize = 0;
       m_maxForward = m_fileSize;
     }
@@ -188,7 +199,7 @@ bool CFileCache::Open(const CURL& url)
       m_maxForward = m_forwardCacheSize;
     }
 
-    if (m_flags & READ_MULTI_STREAM)
+    if ((m_flags & READ_MULTI_STREAM) && !m_pCache->IsMultiRange())
     {
       // If READ_MULTI_STREAM flag is set: Double buffering is required
       m_pCache = std::make_unique<CDoubleCache>(m_pCache.release());
@@ -274,6 +285,10 @@ void CFileCache::Process()
       if (!sourceSeekFailed)
       {
         const bool bCompleteReset = m_pCache->Reset(m_seekPos);
+        if (bCompleteReset)
+          m_seekMisses++;
+        else
+          m_seekHits++;
         m_readPos = m_seekPos;
         m_writePos = m_pCache->CachedDataEndPos();
         assert(m_writePos == cacheMaxPos);
@@ -538,6 +553,7 @@ int64_t CFileCache::Seek(int64_t iFilePosition, int iWhence)
 
   if ((m_nSeekResult = m_pCache->Seek(iTarget)) != iTarget)
   {
+    // counted once the cache thread knows whether it had the data
     if (m_seekPossible == 0)
       return m_nSeekResult;
 
@@ -570,7 +586,10 @@ int64_t CFileCache::Seek(int64_t iFilePosition, int iWhence)
     m_seekEvent.Reset();
   }
   else
+  {
+    m_seekHits++;
     m_readPos = iTarget;
+  }
 
   return iTarget;
 }
@@ -622,6 +641,8 @@ int CFileCache::IoControl(IOControl request, void* param)
     status->maxrate = m_writeRate;
     status->currate = m_writeRateActual;
     status->lowrate = m_writeRateLowSpeed;
+    status->seekhits = m_seekHits;
+    status->seekmisses = m_seekMisses;
     m_writeRateLowSpeed = 0; // Reset low speed condition
     return 0;
   }
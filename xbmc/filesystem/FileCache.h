@@ -72,6 +72,8 @@ namespace XFILE
     uint32_t m_writeRate = 0;
     uint32_t m_writeRateActual = 0;
     uint32_t m_writeRateLowSpeed = 0;
+    std::atomic<uint32_t> m_seekHits{0};
+    std::atomic<uint32_t> m_seekMisses{0};
     int64_t m_forwardCacheSize = 0;
     int64_t m_maxForward = 0;
     bool m_bFilling = false;
@@ -55,6 +55,8 @@ struct SCacheStatus
   uint32_t maxrate; /**< maximum allowed read(fill) rate (bytes/second) */
   uint32_t currate; /**< average read rate (bytes/second) since last position change */
   uint32_t lowrate; /**< low speed read rate (bytes/second) (if any, else 0) */
+  uint32_t seekhits{0}; /**< seeks served from cached data since open */
+  uint32_t seekmisses{0}; /**< seeks that had to read the source again since open */
 };
 
 enum class CacheBufferMode
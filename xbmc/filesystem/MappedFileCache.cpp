@@ -0,0 +1,341 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MappedFileCache.h"
+
+#include "SpecialProtocol.h"
+#include "Util.h"
+#include "threads/SystemClock.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <mutex>
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+// smallest spill file, the source length may not be known yet
+constexpr int64_t MIN_MAP_SIZE = 1024 * 1024;
+} // unnamed namespace
+
+CMappedFileCache::CMappedFileCache(int64_t size) : m_size(std::max(size, MIN_MAP_SIZE))
+{
+}
+
+CMappedFileCache::~CMappedFileCache()
+{
+  Close();
+}
+
+int CMappedFileCache::Open()
+{
+  Close();
+
+  std::unique_lock lock(m_sync);
+
+  m_filename = CSpecialProtocol::TranslatePath(
+      CUtil::GetNextFilename("special://temp/filecache{:03}.cache", 999));
+  if (m_filename.empty())
+  {
+    CLog::Log(LOGERROR, "CMappedFileCache::{} - Unable to generate a new filename", __FUNCTION__);
+    return CACHE_RC_ERROR;
+  }
+
+  m_fd = open(m_filename.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+  if (m_fd < 0)
+  {
+    CLog::Log(LOGERROR, "CMappedFileCache::{} - Failed to create file \"{}\" ({})", __FUNCTION__,
+              m_filename, strerror(errno));
+    return CACHE_RC_ERROR;
+  }
+
+  // the open descriptor keeps the data alive, nothing is left behind if we crash
+  unlink(m_filename.c_str());
+
+  if (ftruncate(m_fd, m_size) != 0)
+  {
+    CLog::Log(LOGERROR, "CMappedFileCache::{} - Failed to size file \"{}\" to {} bytes ({})",
+              __FUNCTION__, m_filename, m_size, strerror(errno));
+    lock.unlock();
+    Close();
+    return CACHE_RC_ERROR;
+  }
+
+  // writes go through pwrite, which reports a full disk, whereas touching an unbacked page of a
+  // writable mapping raises SIGBUS
+  void* map = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED)
+  {
+    CLog::Log(LOGERROR, "CMappedFileCache::{} - Failed to map file \"{}\" ({})", __FUNCTION__,
+              m_filename, strerror(errno));
+    lock.unlock();
+    Close();
+    return CACHE_RC_ERROR;
+  }
+  m_map = static_cast<uint8_t*>(map);
+
+  m_ranges.clear();
+  m_ranges[0] = 0;
+  m_writeStart = 0;
+  m_writePos = 0;
+  m_readPos = 0;
+
+  return CACHE_RC_OK;
+}
+
+void CMappedFileCache::Close()
+{
+  std::unique_lock lock(m_sync);
+
+  if (m_map)
+    munmap(m_map, m_size);
+  m_map = nullptr;
+
+  if (m_fd >= 0)
+    close(m_fd);
+  m_fd = -1;
+
+  m_ranges.clear();
+  m_filename.clear();
+}
+
+bool CMappedFileCache::Grow(int64_t size)
+{
+  // grow in steps, the source is most likely a file that is still being recorded
+  size = std::max(size, m_size + m_size / 4);
+  if (ftruncate(m_fd, size) != 0)
+    return false;
+
+  void* map = mmap(nullptr, size, PROT_READ, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED)
+    return false;
+
+  munmap(m_map, m_size);
+  m_map = static_cast<uint8_t*>(map);
+  m_size = size;
+  return true;
+}
+
+CMappedFileCache::Ranges::const_iterator CMappedFileCache::FindRange(int64_t iFilePosition) const
+{
+  auto it = m_ranges.upper_bound(iFilePosition);
+  if (it == m_ranges.begin())
+    return m_ranges.end();
+
+  --it;
+  if (iFilePosition > it->second)
+    return m_ranges.end();
+  return it;
+}
+
+size_t CMappedFileCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  return iRequestSize; // the spill file grows with the source
+}
+
+int CMappedFileCache::WriteToCache(const char* pBuffer, size_t iSize)
+{
+  std::unique_lock lock(m_sync);
+
+  if (!m_map)
+    return CACHE_RC_ERROR;
+
+  const int64_t end = m_writePos + static_cast<int64_t>(iSize);
+  if (end > m_size && !Grow(end))
+  {
+    CLog::Log(LOGERROR, "CMappedFileCache::{} - <{}> Failed to grow cache to {} bytes",
+              __FUNCTION__, m_filename, end);
+    return CACHE_RC_ERROR;
+  }
+
+  for (size_t written = 0; written < iSize;)
+  {
+    const ssize_t rc = pwrite(m_fd, pBuffer + written, iSize - written, m_writePos + written);
+    if (rc < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      CLog::Log(LOGERROR, "CMappedFileCache::{} - <{}> Failed to write {} bytes at {} ({})",
+                __FUNCTION__, m_filename, iSize, m_writePos, strerror(errno));
+      return CACHE_RC_ERROR;
+    }
+    written += static_cast<size_t>(rc);
+  }
+  m_writePos = end;
+
+  // extend the current range and swallow every range we have caught up with
+  int64_t& rangeEnd = m_ranges[m_writeStart];
+  rangeEnd = std::max(rangeEnd, m_writePos);
+  auto next = m_ranges.upper_bound(m_writeStart);
+  while (next != m_ranges.end() && next->first <= rangeEnd)
+  {
+    rangeEnd = std::max(rangeEnd, next->second);
+    next = m_ranges.erase(next);
+  }
+
+  m_written.Set();
+
+  return static_cast<int>(iSize);
+}
+
+int CMappedFileCache::ReadFromCache(char* pBuffer, size_t iMaxSize)
+{
+  std::unique_lock lock(m_sync);
+
+  const auto range = FindRange(m_readPos);
+  const int64_t avail = range != m_ranges.end() ? range->second - m_readPos : 0;
+  if (avail <= 0 || !m_map)
+    return m_bEndOfInput ? 0 : CACHE_RC_WOULD_BLOCK;
+
+  const size_t toRead = std::min(iMaxSize, static_cast<size_t>(avail));
+  memcpy(pBuffer, m_map + m_readPos, toRead);
+  m_readPos += toRead;
+
+  m_space.Set();
+
+  return static_cast<int>(toRead);
+}
+
+int64_t CMappedFileCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout)
+{
+  std::unique_lock lock(m_sync);
+
+  auto available = [this]() {
+    const auto range = FindRange(m_readPos);
+    return range != m_ranges.end() ? range->second - m_readPos : 0;
+  };
+
+  int64_t avail = available();
+  if (timeout == 0ms || IsEndOfInput())
+    return avail;
+
+  XbmcThreads::EndTime<> endTime{timeout};
+  while (!IsEndOfInput() && avail < iMinAvail)
+  {
+    if (endTime.IsTimePast())
+      return CACHE_RC_TIMEOUT;
+
+    lock.unlock();
+    m_written.Wait(50ms);
+    lock.lock();
+    avail = available();
+  }
+
+  return avail;
+}
+
+int64_t CMappedFileCache::Seek(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+
+  // only the range the source is feeding can be read past its current end, any other cached
+  // range needs the source to continue behind it, which is arranged through Reset()
+  auto inWriteRange = [this](int64_t position) {
+    const auto range = FindRange(position);
+    return range != m_ranges.end() && range->first == m_writeStart;
+  };
+
+  // if seek is a bit over what we have, wait a few seconds rather than seeking the source
+  if (iFilePosition > m_writePos && iFilePosition < m_writePos + 100000 &&
+      !inWriteRange(iFilePosition))
+  {
+    XbmcThreads::EndTime<> endTime{5s};
+    while (!IsEndOfInput() && !endTime.IsTimePast() && !inWriteRange(iFilePosition))
+    {
+      lock.unlock();
+      m_written.Wait(50ms);
+      lock.lock();
+    }
+  }
+
+  if (!inWriteRange(iFilePosition))
+    return CACHE_RC_ERROR;
+
+  m_readPos = iFilePosition;
+  m_space.Set();
+  return iFilePosition;
+}
+
+bool CMappedFileCache::Reset(int64_t iSourcePosition)
+{
+  std::unique_lock lock(m_sync);
+
+  // don't leave an empty range behind
+  const auto current = m_ranges.find(m_writeStart);
+  if (current != m_ranges.end() && current->first == current->second &&
+      current->first != iSourcePosition)
+    m_ranges.erase(current);
+
+  m_readPos = iSourcePosition;
+
+  const auto range = FindRange(iSourcePosition);
+  if (range != m_ranges.end())
+  {
+    // continue filling behind the cached data
+    m_writeStart = range->first;
+    m_writePos = range->second;
+    return false;
+  }
+
+  m_ranges[iSourcePosition] = iSourcePosition;
+  m_writeStart = iSourcePosition;
+  m_writePos = iSourcePosition;
+  return true;
+}
+
+void CMappedFileCache::EndOfInput()
+{
+  CCacheStrategy::EndOfInput();
+  m_written.Set();
+}
+
+int64_t CMappedFileCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  const auto range = FindRange(iFilePosition);
+  return range != m_ranges.end() ? range->second : iFilePosition;
+}
+
+int64_t CMappedFileCache::CachedDataStartPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_writeStart;
+}
+
+int64_t CMappedFileCache::CachedDataEndPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_writePos;
+}
+
+bool CMappedFileCache::IsCachedPosition(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  return FindRange(iFilePosition) != m_ranges.end();
+}
+
+CCacheStrategy* CMappedFileCache::CreateNew()
+{
+  return new CMappedFileCache(m_size);
+}
+
+size_t CMappedFileCache::GetRangeCount() const
+{
+  std::unique_lock lock(m_sync);
+  return m_ranges.size();
+}
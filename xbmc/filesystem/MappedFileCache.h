@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <map>
+#include <string>
+
+namespace XFILE
+{
+
+/*!
+ * \brief Disk cache strategy that mirrors the source into a memory mapped sparse spill file.
+ *
+ * Data is stored at its source offset, so every range that has been read once stays cached
+ * until the file is closed. Seeking back into any of them is served from the spill file instead
+ * of seeking (and re-reading) the source, which is what makes this preferable to
+ * CSimpleFileCache for network sources. Only disk blocks that were actually written are
+ * allocated. Data is written with pwrite and only read through the mapping, so a full disk fails
+ * the write instead of the process. The spill file is unlinked right after creation so it
+ * disappears with the process.
+ */
+class CMappedFileCache : public CCacheStrategy
+{
+public:
+  /*!
+   * \param size expected size of the source, the spill file grows if the source does
+   */
+  explicit CMappedFileCache(int64_t size);
+  ~CMappedFileCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* pBuffer, size_t iSize) override;
+  int ReadFromCache(char* pBuffer, size_t iMaxSize) override;
+  int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t iFilePosition) override;
+  bool Reset(int64_t iSourcePosition) override;
+  void EndOfInput() override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+  bool IsMultiRange() const override { return true; }
+
+  /*!
+   * \brief Number of disjoint ranges currently held, for diagnostics and tests.
+   */
+  size_t GetRangeCount() const;
+
+private:
+  using Ranges = std::map<int64_t, int64_t>; // start -> end (exclusive) in source positions
+
+  Ranges::const_iterator FindRange(int64_t iFilePosition) const;
+  bool Grow(int64_t size);
+
+  int m_fd = -1;
+  uint8_t* m_map = nullptr;
+  int64_t m_size;
+  std::string m_filename;
+
+  Ranges m_ranges;
+  int64_t m_writeStart = 0; //!< start of the range the source is currently written to
+  int64_t m_writePos = 0; //!< source position of the next write
+  int64_t m_readPos = 0;
+
+  mutable CCriticalSection m_sync;
+  CEvent m_written;
+};
+
+} // namespace XFILE
@@ -0,0 +1,137 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/DirectoryCache.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+void SetListing(CDirectoryCache& cache, const std::string& path, int count, CacheType cacheType)
+{
+  CFileItemList items;
+  for (int i = 0; i < count; ++i)
+    items.Add(std::make_shared<CFileItem>(path + "/file" + std::to_string(i) + ".mkv", false));
+  cache.SetDirectory(path, items, cacheType);
+}
+} // namespace
+
+TEST(TestDirectoryCache, HitsAndMisses)
+{
+  CDirectoryCache cache;
+  SetListing(cache, "/media/movies", 3, CacheType::ALWAYS);
+
+  CFileItemList items;
+  EXPECT_TRUE(cache.GetDirectory("/media/movies/", items));
+  EXPECT_EQ(3, items.Size());
+  EXPECT_FALSE(cache.GetDirectory("/media/music", items));
+
+  bool inCache = false;
+  EXPECT_TRUE(cache.FileExists("/media/movies/file1.mkv", inCache));
+  EXPECT_TRUE(inCache);
+  EXPECT_FALSE(cache.FileExists("/media/movies/missing.mkv", inCache));
+  EXPECT_TRUE(inCache);
+
+  const CDirectoryCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(3u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_EQ(1u, stats.directories);
+  EXPECT_EQ(3u, stats.items);
+  EXPECT_GT(stats.bytes, 0u);
+}
+
+TEST(TestDirectoryCache, OnceNeedsRetrieveAll)
+{
+  CDirectoryCache cache;
+  SetListing(cache, "/media/once", 1, CacheType::ONCE);
+
+  CFileItemList items;
+  EXPECT_FALSE(cache.GetDirectory("/media/once", items));
+  EXPECT_TRUE(cache.GetDirectory("/media/once", items, true));
+}
+
+TEST(TestDirectoryCache, ClearSubPaths)
+{
+  CDirectoryCache cache;
+  for (int i = 0; i < 32; ++i)
+  {
+    const std::string path = "/media/tv/show" + std::to_string(i);
+    SetListing(cache, path, 1, CacheType::ALWAYS);
+  }
+  SetListing(cache, "/media/movies", 1, CacheType::ALWAYS);
+
+  cache.ClearSubPaths("/media/tv/");
+
+  EXPECT_EQ(1u, cache.GetStats().directories);
+  CFileItemList items;
+  EXPECT_TRUE(cache.GetDirectory("/media/movies", items));
+}
+
+TEST(TestDirectoryCache, EvictsLeastRecentlyUsed)
+{
+  CDirectoryCache cache;
+  SetListing(cache, "/media/a", 100, CacheType::ONCE);
+  const size_t listingSize = cache.GetStats().bytes;
+  cache.SetMemoryBudget(listingSize * 2 + listingSize / 2);
+
+  SetListing(cache, "/media/b", 100, CacheType::ONCE);
+  CFileItemList items;
+  EXPECT_TRUE(cache.GetDirectory("/media/a", items, true));
+
+  // b is now the least recently used one
+  SetListing(cache, "/media/c", 100, CacheType::ONCE);
+
+  EXPECT_TRUE(cache.GetDirectory("/media/a", items, true));
+  EXPECT_FALSE(cache.GetDirectory("/media/b", items, true));
+  EXPECT_TRUE(cache.GetDirectory("/media/c", items, true));
+
+  const CDirectoryCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(1u, stats.evictions);
+  EXPECT_LE(stats.bytes, stats.budget);
+}
+
+TEST(TestDirectoryCache, KeepsAlwaysCachedAndNewest)
+{
+  CDirectoryCache cache;
+  cache.SetMemoryBudget(1);
+
+  SetListing(cache, "/media/zip", 10, CacheType::ALWAYS);
+  SetListing(cache, "/media/big", 10, CacheType::ONCE);
+
+  CFileItemList items;
+  EXPECT_TRUE(cache.GetDirectory("/media/zip", items));
+  EXPECT_TRUE(cache.GetDirectory("/media/big", items, true));
+}
+
+TEST(TestDirectoryCache, ExpiresByProtocol)
+{
+  CDirectoryCache cache;
+  cache.SetTimeToLive("smb", 1ms);
+
+  SetListing(cache, "smb://server/share", 1, CacheType::ALWAYS);
+  SetListing(cache, "/media/local", 1, CacheType::ALWAYS);
+  std::this_thread::sleep_for(10ms);
+
+  CFileItemList items;
+  EXPECT_FALSE(cache.GetDirectory("smb://server/share", items));
+  EXPECT_TRUE(cache.GetDirectory("/media/local", items));
+
+  const CDirectoryCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(1u, stats.expirations);
+  EXPECT_EQ(1u, stats.directories);
+}
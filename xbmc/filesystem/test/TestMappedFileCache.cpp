@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/MappedFileCache.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+std::vector<char> MakeData(int64_t start, size_t size)
+{
+  std::vector<char> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<char>((start + i) % 251);
+  return data;
+}
+
+void Fill(CMappedFileCache& cache, int64_t start, size_t size)
+{
+  const std::vector<char> data = MakeData(start, size);
+  ASSERT_EQ(static_cast<int>(size), cache.WriteToCache(data.data(), data.size()));
+}
+
+void ExpectData(CMappedFileCache& cache, int64_t start, size_t size)
+{
+  std::vector<char> data(size);
+  ASSERT_EQ(static_cast<int>(size), cache.ReadFromCache(data.data(), data.size()));
+  EXPECT_EQ(MakeData(start, size), data);
+}
+} // namespace
+
+class TestMappedFileCache : public ::testing::Test
+{
+protected:
+  TestMappedFileCache() : m_cache(64 * 1024) {}
+
+  void SetUp() override { ASSERT_EQ(CACHE_RC_OK, m_cache.Open()); }
+
+  CMappedFileCache m_cache;
+};
+
+TEST_F(TestMappedFileCache, ReadBack)
+{
+  Fill(m_cache, 0, 4096);
+  EXPECT_EQ(4096, m_cache.WaitForData(0, std::chrono::milliseconds(0)));
+  ExpectData(m_cache, 0, 4096);
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, m_cache.ReadFromCache(nullptr, 1));
+
+  m_cache.EndOfInput();
+  EXPECT_EQ(0, m_cache.ReadFromCache(nullptr, 1));
+}
+
+TEST_F(TestMappedFileCache, KeepsDisjointRanges)
+{
+  Fill(m_cache, 0, 1000);
+
+  // jump ahead, the first range must survive
+  EXPECT_TRUE(m_cache.Reset(20000));
+  Fill(m_cache, 20000, 1000);
+  EXPECT_EQ(2u, m_cache.GetRangeCount());
+  EXPECT_TRUE(m_cache.IsCachedPosition(500));
+  EXPECT_FALSE(m_cache.IsCachedPosition(5000));
+
+  // the source has to continue behind the first range when seeking back into it
+  EXPECT_EQ(CACHE_RC_ERROR, m_cache.Seek(500));
+  EXPECT_EQ(1000, m_cache.CachedDataEndPosIfSeekTo(500));
+  EXPECT_FALSE(m_cache.Reset(500));
+  EXPECT_EQ(0, m_cache.CachedDataStartPos());
+  EXPECT_EQ(1000, m_cache.CachedDataEndPos());
+  ExpectData(m_cache, 500, 500);
+}
+
+TEST_F(TestMappedFileCache, MergesRanges)
+{
+  Fill(m_cache, 0, 1000);
+  EXPECT_TRUE(m_cache.Reset(2000));
+  Fill(m_cache, 2000, 1000);
+
+  // close the gap, both ranges become one
+  EXPECT_FALSE(m_cache.Reset(1000));
+  Fill(m_cache, 1000, 1000);
+  EXPECT_EQ(1u, m_cache.GetRangeCount());
+  EXPECT_EQ(3000, m_cache.CachedDataEndPosIfSeekTo(0));
+
+  EXPECT_EQ(0, m_cache.Seek(0));
+  ExpectData(m_cache, 0, 3000);
+}
+
+TEST_F(TestMappedFileCache, GrowsWithSource)
+{
+  EXPECT_TRUE(m_cache.Reset(60 * 1024));
+  Fill(m_cache, 60 * 1024, 16 * 1024);
+  ExpectData(m_cache, 60 * 1024, 16 * 1024);
+}
@@ -11,6 +11,7 @@
 #include "FileItem.h"
 #include "GUIMessage.h"
 #include "ImageSettings.h"
+#include "TextureManager.h"
 #include "utils/log.h"
 
 #include <cassert>
@@ -210,6 +211,15 @@ void CGUIImage::ProcessState()
   m_nameNext = fileName;
   m_isTransitioning = true;
   m_hasNewStagingTexture = false;
+
+  // nothing shown yet, show the fallback as placeholder while the image loads in the background
+  if (m_textureCurrent->GetFileName().empty() &&
+      (m_textureNext->IsLazyLoaded() || !CGUITextureManager::CanLoad(fileName)))
+  {
+    const std::string placeholder = GetFallback(fileName);
+    if (!placeholder.empty() && placeholder != fileName)
+      m_textureCurrent->SetFileName(placeholder);
+  }
 }
 
 void CGUIImage::ProcessAllocation()
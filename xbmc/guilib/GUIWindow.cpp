@@ -32,6 +32,7 @@
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
 
+#include <chrono>
 #include <mutex>
 
 using namespace KODI;
@@ -72,9 +73,7 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
   if (m_windowLoaded || !g_SkinInfo)
     return true;      // no point loading if it's already there
 
-#ifdef _DEBUG
   const auto start = std::chrono::steady_clock::now();
-#endif
 
   const char* strLoadType;
   switch (m_loadType)
@@ -112,11 +111,9 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
     m_windowLoaded = true;
     OnWindowLoaded();
 
-#ifdef _DEBUG
     const auto end = std::chrono::steady_clock::now();
     const std::chrono::duration<double, std::milli> duration = end - start;
     CLog::Log(LOGDEBUG, "Skin file {} loaded in {:.2f} ms", strPath, duration.count());
-#endif
   }
 
   return ret;
@@ -124,13 +121,33 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
 
 bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLowerPath)
 {
+  const auto start = std::chrono::steady_clock::now();
+
+  // the window as it was resolved before saves parsing the XML and resolving the includes
+  std::unique_ptr<TiXmlElement> cachedRoot =
+      g_SkinInfo->LoadCachedWindow(strPath, m_xmlIncludeConditions);
+  if (cachedRoot)
+  {
+    const std::chrono::duration<double, std::milli> duration =
+        std::chrono::steady_clock::now() - start;
+    CLog::Log(LOGDEBUG, "Using cached xml root node for {}, read in {:.2f} ms", strPath,
+              duration.count());
+    return Load(cachedRoot.get());
+  }
+
   // load window xml if we don't have it stored yet
   if (!m_windowXMLRootElement)
   {
     CXBMCTinyXML xmlDoc;
     std::string strPathLower = strPath;
     StringUtils::ToLower(strPathLower);
-    if (!xmlDoc.LoadFile(strPath) && !xmlDoc.LoadFile(strPathLower) && !xmlDoc.LoadFile(strLowerPath))
+    if (xmlDoc.LoadFile(strPath))
+      m_windowXMLFile = strPath;
+    else if (xmlDoc.LoadFile(strPathLower))
+      m_windowXMLFile = strPathLower;
+    else if (xmlDoc.LoadFile(strLowerPath))
+      m_windowXMLFile = strLowerPath;
+    else
     {
       CLog::Log(LOGERROR, "Unable to load window XML: {}. Line {}\n{}", strPath, xmlDoc.ErrorRow(),
                 xmlDoc.ErrorDesc());
@@ -152,7 +169,17 @@ bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLower
   else
     CLog::Log(LOGDEBUG, "Using already stored xml root node for {}", strPath);
 
-  return Load(Prepare(m_windowXMLRootElement).get());
+  std::unique_ptr<TiXmlElement> preparedRoot = Prepare(m_windowXMLRootElement);
+  if (preparedRoot)
+  {
+    const std::chrono::duration<double, std::milli> duration =
+        std::chrono::steady_clock::now() - start;
+    CLog::Log(LOGDEBUG, "Resolved xml root node for {} in {:.2f} ms", strPath, duration.count());
+
+    g_SkinInfo->CacheWindow(strPath, m_windowXMLFile, *preparedRoot, m_xmlIncludeConditions);
+  }
+
+  return Load(preparedRoot.get());
 }
 
 std::unique_ptr<TiXmlElement> CGUIWindow::Prepare(const std::unique_ptr<TiXmlElement>& rootElement)
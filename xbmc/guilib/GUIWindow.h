@@ -197,6 +197,9 @@ protected:
    \brief Load the window XML from the given path
    \param strPath the path to the window XML
    \param strLowerPath a lowered path to the window XML
+
+   The window is loaded from the skin's window cache if it was resolved before, Prepare() is
+   only called when the XML is actually parsed.
    */
   virtual bool LoadXML(const std::string& strPath, const std::string &strLowerPath);
 
@@ -276,6 +279,7 @@ protected:
     Stored to avoid parsing the XML every time the window is loaded.
    */
   std::unique_ptr<TiXmlElement> m_windowXMLRootElement;
+  std::string m_windowXMLFile; ///< \brief the file m_windowXMLRootElement was read from
 
   bool m_manualRunActions;
 
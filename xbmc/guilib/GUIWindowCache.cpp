@@ -0,0 +1,290 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIWindowCache.h"
+
+#include "GUIInfoManager.h"
+#include "ServiceBroker.h"
+#include "filesystem/File.h"
+#include "guilib/GUIComponent.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/XBMCTinyXML.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+using namespace XFILE;
+
+namespace
+{
+// bump whenever the layout of the archive changes
+constexpr int CACHE_VERSION = 2;
+// written last, a truncated archive reads zeros instead
+constexpr int CACHE_END = 0x57494e44;
+
+constexpr char NODE_ELEMENT = 'e';
+constexpr char NODE_TEXT = 't';
+
+bool IsStored(const TiXmlNode* node)
+{
+  return node->Type() == TiXmlNode::TINYXML_ELEMENT || node->Type() == TiXmlNode::TINYXML_TEXT;
+}
+
+void StoreElement(CArchive& ar, const TiXmlElement& element)
+{
+  ar << element.ValueStr();
+
+  int attributes = 0;
+  for (const TiXmlAttribute* attribute = element.FirstAttribute(); attribute;
+       attribute = attribute->Next())
+    attributes++;
+
+  ar << attributes;
+  for (const TiXmlAttribute* attribute = element.FirstAttribute(); attribute;
+       attribute = attribute->Next())
+    ar << attribute->NameTStr() << attribute->ValueStr();
+
+  // comments aren't of any use to the control factory
+  int children = 0;
+  for (const TiXmlNode* child = element.FirstChild(); child; child = child->NextSibling())
+  {
+    if (IsStored(child))
+      children++;
+  }
+
+  ar << children;
+  for (const TiXmlNode* child = element.FirstChild(); child; child = child->NextSibling())
+  {
+    if (child->Type() == TiXmlNode::TINYXML_ELEMENT)
+    {
+      ar << NODE_ELEMENT;
+      StoreElement(ar, *child->ToElement());
+    }
+    else if (child->Type() == TiXmlNode::TINYXML_TEXT)
+    {
+      ar << NODE_TEXT;
+      ar << child->ToText()->CDATA();
+      ar << child->ValueStr();
+    }
+  }
+}
+
+std::unique_ptr<TiXmlElement> LoadElement(CArchive& ar)
+{
+  std::string value;
+  ar >> value;
+  auto element = std::make_unique<TiXmlElement>(value);
+
+  int attributes;
+  ar >> attributes;
+  for (int i = 0; i < attributes; i++)
+  {
+    std::string name;
+    ar >> name >> value;
+    element->SetAttribute(name, value);
+  }
+
+  int children;
+  ar >> children;
+  for (int i = 0; i < children; i++)
+  {
+    char type;
+    ar >> type;
+    if (type == NODE_ELEMENT)
+      element->LinkEndChild(LoadElement(ar).release());
+    else if (type == NODE_TEXT)
+    {
+      bool cdata;
+      ar >> cdata >> value;
+      auto text = std::make_unique<TiXmlText>(value);
+      text->SetCDATA(cdata);
+      element->LinkEndChild(text.release());
+    }
+    else
+      throw std::out_of_range("Unknown node type");
+  }
+
+  return element;
+}
+} // unnamed namespace
+
+CGUIWindowCache::CGUIWindowCache(const std::string& path) : m_path(path)
+{
+}
+
+void CGUIWindowCache::Reset(const std::string& skin)
+{
+  std::unique_lock lock(m_critSection);
+  m_skin = skin;
+  m_stamps.clear();
+}
+
+std::unique_ptr<TiXmlElement> CGUIWindowCache::Load(
+    const std::string& window,
+    const std::vector<std::string>& includeFiles,
+    std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  std::unique_lock lock(m_critSection);
+
+  const std::string cacheFile = GetCacheFile(window);
+  CFile file;
+  if (!file.Open(cacheFile))
+    return nullptr;
+
+  try
+  {
+    CArchive ar(&file, CArchive::load);
+
+    int version;
+    std::string skin;
+    ar >> version >> skin;
+    if (version != CACHE_VERSION || skin != m_skin)
+      return nullptr;
+
+    // cache files are named by a hash of the window, another window may have the same one
+    std::string storedWindow;
+    ar >> storedWindow;
+    if (storedWindow != window)
+      return nullptr;
+
+    std::string path;
+    std::string stamp;
+    ar >> path >> stamp;
+    if (stamp != GetStamp(path))
+    {
+      CLog::Log(LOGDEBUG, "Cached window {} is outdated, {} changed", window, path);
+      return nullptr;
+    }
+
+    std::set<std::string> storedIncludeFiles;
+    int count;
+    ar >> count;
+    for (int i = 0; i < count; i++)
+    {
+      ar >> path >> stamp;
+      if (stamp != GetStamp(path))
+      {
+        CLog::Log(LOGDEBUG, "Cached window {} is outdated, {} changed", window, path);
+        return nullptr;
+      }
+      storedIncludeFiles.emplace(std::move(path));
+    }
+
+    // other definitions might be used with another set of include files. Files the window loads
+    // itself can't be loaded here, whether those are loaded can depend on conditions of their own.
+    if (storedIncludeFiles != std::set<std::string>(includeFiles.begin(), includeFiles.end()))
+      return nullptr;
+
+    std::map<INFO::InfoPtr, bool> conditions;
+    ar >> count;
+    for (int i = 0; i < count; i++)
+    {
+      std::string expression;
+      bool value;
+      ar >> expression >> value;
+
+      INFO::InfoPtr condition =
+          CServiceBroker::GetGUI()->GetInfoManager().Register(expression);
+      if (!condition || condition->Get(INFO::DEFAULT_CONTEXT) != value)
+        return nullptr;
+
+      conditions.emplace(condition, value);
+    }
+
+    std::unique_ptr<TiXmlElement> root = LoadElement(ar);
+
+    int end;
+    ar >> end;
+    if (end != CACHE_END)
+      throw std::out_of_range("Truncated archive");
+
+    includeConditions = std::move(conditions);
+    return root;
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "Corrupt window cache {} of {}", cacheFile, window);
+  }
+
+  file.Close();
+  CFile::Delete(cacheFile);
+  return nullptr;
+}
+
+void CGUIWindowCache::Save(const std::string& window,
+                           const std::string& file,
+                           const std::vector<std::string>& includeFiles,
+                           const TiXmlElement& root,
+                           const std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  std::unique_lock lock(m_critSection);
+
+  // never store anything that can't be validated on load
+  const std::string stamp = GetStamp(file);
+  if (stamp.empty() || std::any_of(includeFiles.begin(), includeFiles.end(),
+                                   [this](const std::string& includeFile)
+                                   { return GetStamp(includeFile).empty(); }))
+    return;
+
+  const std::string cacheFile = GetCacheFile(window);
+  CFile output;
+  if (!output.OpenForWrite(cacheFile, true))
+  {
+    CLog::Log(LOGWARNING, "Unable to write window cache {} of {}", cacheFile, window);
+    return;
+  }
+
+  CArchive ar(&output, CArchive::store);
+  ar << CACHE_VERSION << m_skin << window;
+  ar << file << stamp;
+
+  ar << static_cast<int>(includeFiles.size());
+  for (const auto& includeFile : includeFiles)
+    ar << includeFile << GetStamp(includeFile);
+
+  ar << static_cast<int>(includeConditions.size());
+  for (const auto& [condition, value] : includeConditions)
+    ar << condition->GetExpression() << value;
+
+  StoreElement(ar, root);
+  ar << CACHE_END;
+  ar.Close();
+  output.Close();
+}
+
+std::string CGUIWindowCache::GetCacheFile(const std::string& window) const
+{
+  return StringUtils::Format("{}{:08x}.win", m_path, Crc32::Compute(window));
+}
+
+std::string CGUIWindowCache::GetStamp(const std::string& file)
+{
+  // the files of a skin are stat'ed once until it's reloaded
+  const auto it = m_stamps.find(file);
+  if (it != m_stamps.end())
+    return it->second;
+
+  std::string stamp;
+  struct __stat64 st;
+  if (CFile::Stat(file, &st) == 0)
+  {
+    int64_t time = st.st_mtime;
+    if (!time)
+      time = st.st_ctime;
+    if (time || st.st_size)
+      stamp = StringUtils::Format("d{}s{}", time, st.st_size);
+  }
+
+  m_stamps.emplace(file, stamp);
+  return stamp;
+}
@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "interfaces/info/InfoBool.h"
+#include "threads/CriticalSection.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TiXmlElement;
+
+/*!
+ \brief Disk cache of window definitions with all includes resolved
+
+ Parsing a window's XML and resolving its includes, constants and expressions is the bulk of the
+ time it takes to load a window. The resolved definition is stored in a binary archive and used
+ as long as neither the window file nor any of the include files changed and the conditions of
+ conditional includes still have the values they had when it was stored.
+ */
+class CGUIWindowCache
+{
+public:
+  explicit CGUIWindowCache(const std::string& path = "special://temp/skin_cache/");
+
+  /*!
+   \brief Forget everything known about the files of the skin, e.g. as it is (re)loaded
+
+   \param skin identifies the skin, entries stored for any other skin are ignored
+   */
+  void Reset(const std::string& skin);
+
+  /*!
+   \brief Get the resolved definition of a window from the cache
+
+   \param window the path the window is loaded from
+   \param includeFiles the include files currently loaded, exactly these need to have been loaded
+   after resolving the window when the entry was stored
+   \param includeConditions [out] the conditions used to resolve the includes and their values
+   \return the resolved <window> element, nullptr if there is no valid entry
+   */
+  std::unique_ptr<TiXmlElement> Load(const std::string& window,
+                                     const std::vector<std::string>& includeFiles,
+                                     std::map<INFO::InfoPtr, bool>& includeConditions);
+
+  /*!
+   \brief Store the resolved definition of a window in the cache
+
+   \param window the path the window is loaded from
+   \param file the window file that was actually read
+   \param includeFiles the include files loaded after resolving the window
+   \param root the resolved <window> element
+   \param includeConditions the conditions used to resolve the includes and their values
+   */
+  void Save(const std::string& window,
+            const std::string& file,
+            const std::vector<std::string>& includeFiles,
+            const TiXmlElement& root,
+            const std::map<INFO::InfoPtr, bool>& includeConditions);
+
+private:
+  std::string GetCacheFile(const std::string& window) const;
+  std::string GetStamp(const std::string& file);
+
+  const std::string m_path;
+  std::string m_skin;
+  std::map<std::string, std::string> m_stamps;
+  CCriticalSection m_critSection;
+};
@@ -52,6 +52,9 @@ public:
   /*! \brief returns a pointer to the staging texture. */
   uint8_t* GetPixels() const { return m_pixels; }
 
+  /*! \brief returns true once the texture has been uploaded to the GPU. */
+  bool IsLoadedToGPU() const { return m_loadedToGPU; }
+
   /*! \brief return the size of one row in bytes. */
   uint32_t GetPitch() const { return GetPitch(m_textureWidth); }
   /*! \brief return the number of rows (number of blocks in the Y direction). */
@@ -18,6 +18,7 @@
 #include "utils/MemUtils.h"
 #include "utils/log.h"
 
+#include <cstring>
 #include <memory>
 
 namespace
@@ -130,6 +131,9 @@ static const std::map<KD_TEX_SWIZ, Textureswizzle> SwizzleMap
   {KD_TEX_SWIZ_GGGG, {GL_GREEN, GL_GREEN, GL_GREEN, GL_GREEN}},
 };
 // clang-format on
+
+// smaller textures are not worth the extra buffer object
+constexpr size_t PBO_MIN_SIZE = 256 * 1024;
 } // namespace
 
 std::unique_ptr<CTexture> CTexture::CreateTexture(unsigned int width,
@@ -216,6 +220,7 @@ void CGLTexture::LoadToGPU()
 #endif
 
   unsigned int maxSize = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
+  bool rowLength = false;
   if (m_textureHeight > maxSize)
   {
     CLog::Log(LOGERROR,
@@ -230,6 +235,7 @@ void CGLTexture::LoadToGPU()
               m_textureWidth, maxSize);
 
     glPixelStorei(GL_UNPACK_ROW_LENGTH, m_textureWidth);
+    rowLength = true;
 
     m_textureWidth = maxSize;
   }
@@ -252,15 +258,47 @@ void CGLTexture::LoadToGPU()
     return;
   }
 
+  // stage the pixels in a pixel buffer object, glTexImage2D then returns right away and the
+  // driver converts and transfers them asynchronously instead of stalling the render thread
+  const size_t size = GetPitch() * GetRows();
+  const unsigned char* pixels = m_pixels;
+  GLuint pbo = 0;
+  if (m_isOglVersion3orNewer && !rowLength && size >= PBO_MIN_SIZE)
+  {
+    glGenBuffers(1, &pbo);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    void* pboPtr = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+    if (pboPtr)
+    {
+      memcpy(pboPtr, m_pixels, size);
+      glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+      pixels = nullptr; // offset into the bound buffer
+    }
+    else
+    {
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+      glDeleteBuffers(1, &pbo);
+      pbo = 0;
+    }
+  }
+
   if ((m_textureFormat & KD_TEX_FMT_SDR) || (m_textureFormat & KD_TEX_FMT_HDR))
   {
     glTexImage2D(GL_TEXTURE_2D, 0, glFormat.internalFormat, m_textureWidth, m_textureHeight, 0,
-                 glFormat.format, glFormat.type, m_pixels);
+                 glFormat.format, glFormat.type, pixels);
   }
   else
   {
     glCompressedTexImage2D(GL_TEXTURE_2D, 0, glFormat.internalFormat, m_textureWidth,
-                           m_textureHeight, 0, GetPitch() * GetRows(), m_pixels);
+                           m_textureHeight, 0, size, pixels);
+  }
+
+  if (pbo)
+  {
+    // the buffer is only released once the transfer has finished
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &pbo);
   }
 
   if (IsMipmapped() && m_isOglVersion3orNewer)
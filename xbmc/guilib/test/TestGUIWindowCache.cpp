@@ -0,0 +1,162 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "guilib/GUIWindowCache.h"
+#include "test/TestUtils.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/XBMCTinyXML.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+const std::string CACHE_PATH = "special://temp/TestGUIWindowCache/";
+const std::string SKIN = "skin.test-1.0.0";
+
+constexpr const char* WINDOW = "<window id=\"1\"><!-- comment --><controls><control type=\"label\">"
+                               "<label>foo &amp; bar</label><info><![CDATA[Player.Title]]></info>"
+                               "</control></controls></window>";
+
+std::string Print(const TiXmlElement& element)
+{
+  TiXmlPrinter printer;
+  element.Accept(&printer);
+  return printer.Str();
+}
+
+std::unique_ptr<TiXmlElement> Parse(const std::string& xml)
+{
+  CXBMCTinyXML doc;
+  doc.Parse(xml);
+  return std::unique_ptr<TiXmlElement>(static_cast<TiXmlElement*>(doc.RootElement()->Clone()));
+}
+} // namespace
+
+class TestGUIWindowCache : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    XFILE::CDirectory::Create(CACHE_PATH);
+
+    m_windowFile = XBMC_CREATETEMPFILE(".xml");
+    m_includeFile = XBMC_CREATETEMPFILE(".xml");
+    ASSERT_NE(nullptr, m_windowFile);
+    ASSERT_NE(nullptr, m_includeFile);
+    m_windowFile->Write("<window/>", 9);
+    m_windowFile->Close();
+    m_includeFile->Write("<includes/>", 11);
+    m_includeFile->Close();
+
+    m_window = XBMC_TEMPFILEPATH(m_windowFile);
+    m_include = XBMC_TEMPFILEPATH(m_includeFile);
+
+    m_root = Parse(WINDOW);
+
+    m_cache.Reset(SKIN);
+  }
+
+  void TearDown() override
+  {
+    XBMC_DELETETEMPFILE(m_windowFile);
+    XBMC_DELETETEMPFILE(m_includeFile);
+    XFILE::CDirectory::RemoveRecursive(CACHE_PATH);
+  }
+
+  std::unique_ptr<TiXmlElement> Load(const std::vector<std::string>& includeFiles)
+  {
+    std::map<INFO::InfoPtr, bool> includeConditions;
+    return m_cache.Load(m_window, includeFiles, includeConditions);
+  }
+
+  CGUIWindowCache m_cache{CACHE_PATH};
+  XFILE::CFile* m_windowFile = nullptr;
+  XFILE::CFile* m_includeFile = nullptr;
+  std::string m_window;
+  std::string m_include;
+  std::unique_ptr<TiXmlElement> m_root;
+};
+
+TEST_F(TestGUIWindowCache, LoadsStoredWindow)
+{
+  EXPECT_EQ(nullptr, Load({m_include}));
+
+  m_cache.Save(m_window, m_window, {m_include}, *m_root, {});
+  auto root = Load({m_include});
+  ASSERT_NE(nullptr, root);
+
+  // everything but the comment survives
+  std::string expected = WINDOW;
+  StringUtils::Replace(expected, "<!-- comment -->", "");
+  EXPECT_EQ(Print(*Parse(expected)), Print(*root));
+
+  const TiXmlNode* info = root->FirstChildElement("controls")
+                              ->FirstChildElement("control")
+                              ->FirstChildElement("info")
+                              ->FirstChild();
+  ASSERT_NE(nullptr, info->ToText());
+  EXPECT_TRUE(info->ToText()->CDATA());
+}
+
+TEST_F(TestGUIWindowCache, IgnoresOtherSkin)
+{
+  m_cache.Save(m_window, m_window, {m_include}, *m_root, {});
+  m_cache.Reset("skin.other-1.0.0");
+  EXPECT_EQ(nullptr, Load({m_include}));
+}
+
+TEST_F(TestGUIWindowCache, IgnoresOtherWindow)
+{
+  m_cache.Save(m_window, m_window, {m_include}, *m_root, {});
+
+  // as if the other window had the same hash
+  const std::string other = m_window + ".other";
+  auto cacheFile = [](const std::string& window)
+  { return StringUtils::Format("{}{:08x}.win", CACHE_PATH, Crc32::Compute(window)); };
+  ASSERT_TRUE(XFILE::CFile::Copy(cacheFile(m_window), cacheFile(other)));
+
+  std::map<INFO::InfoPtr, bool> includeConditions;
+  EXPECT_EQ(nullptr, m_cache.Load(other, {m_include}, includeConditions));
+  EXPECT_NE(nullptr, Load({m_include}));
+}
+
+TEST_F(TestGUIWindowCache, IgnoresChangedFiles)
+{
+  m_cache.Save(m_window, m_window, {m_include}, *m_root, {});
+
+  XFILE::CFile file;
+  ASSERT_TRUE(file.OpenForWrite(m_include, true));
+  file.Write("<includes></includes>", 21);
+  file.Close();
+
+  // files are only looked at again once the skin is reloaded
+  EXPECT_NE(nullptr, Load({m_include}));
+  m_cache.Reset(SKIN);
+  EXPECT_EQ(nullptr, Load({m_include}));
+}
+
+TEST_F(TestGUIWindowCache, ChecksIncludeFiles)
+{
+  m_cache.Save(m_window, m_window, {m_include}, *m_root, {});
+
+  // the window loaded an include file itself, or a conditional one was loaded with the skin
+  EXPECT_EQ(nullptr, Load({}));
+
+  // an include file the window wasn't resolved with
+  EXPECT_EQ(nullptr, Load({m_include, m_window}));
+
+  EXPECT_NE(nullptr, Load({m_include}));
+}
@@ -17,6 +17,7 @@
 #include "Util.h"
 #include "VideoLibrary.h"
 #include "filesystem/Directory.h"
+#include "filesystem/DirectoryCache.h"
 #include "media/MediaLockState.h"
 #include "playlists/PlayListFileItemClassify.h"
 #include "settings/AdvancedSettings.h"
@@ -113,12 +114,11 @@ JSONRPC_STATUS CFileOperations::GetDirectory(const std::string &method, ITranspo
         return status;
     }
 
+    CUtil::ExcludeFilesOrFolders(items, regexps);
+
     CFileItemList filteredFiles;
     for (unsigned int i = 0; i < (unsigned int)items.Size(); i++)
     {
-      if (CUtil::ExcludeFileOrFolder(items[i]->GetPath(), regexps))
-        continue;
-
       if (items[i]->IsSmb())
       {
         CURL url(items[i]->GetPath());
@@ -289,6 +289,27 @@ JSONRPC_STATUS CFileOperations::Download(const std::string &method, ITransportLa
   return transport->Download(parameterObject["path"].asString().c_str(), result) ? OK : InvalidParams;
 }
 
+JSONRPC_STATUS CFileOperations::GetDirectoryCacheStats(const std::string& method,
+                                                       ITransportLayer* transport,
+                                                       IClient* client,
+                                                       const CVariant& parameterObject,
+                                                       CVariant& result)
+{
+  const CDirectoryCache::Stats stats = g_directoryCache.GetStats();
+  g_directoryCache.PrintStats();
+
+  result["hits"] = stats.hits;
+  result["misses"] = stats.misses;
+  result["evictions"] = stats.evictions;
+  result["expirations"] = stats.expirations;
+  result["directories"] = static_cast<uint64_t>(stats.directories);
+  result["items"] = static_cast<uint64_t>(stats.items);
+  result["bytes"] = static_cast<uint64_t>(stats.bytes);
+  result["budget"] = static_cast<uint64_t>(stats.budget);
+
+  return OK;
+}
+
 bool CFileOperations::FillFileItem(
     const std::shared_ptr<CFileItem>& originalItem,
     std::shared_ptr<CFileItem>& item,
@@ -385,12 +406,11 @@ bool CFileOperations::FillFileItemList(const CVariant &parameterObject, CFileIte
             !URIUtils::IsUPnP(items.GetPath()))
           items.Sort(SortByFile, SortOrderAscending);
 
+        CUtil::ExcludeFilesOrFolders(items, regexps);
+
         CFileItemList filteredDirectories;
         for (unsigned int i = 0; i < (unsigned int)items.Size(); i++)
         {
-          if (CUtil::ExcludeFileOrFolder(items[i]->GetPath(), regexps))
-            continue;
-
           if (items[i]->IsFolder())
             filteredDirectories.Add(items[i]);
           else if ((media == "video" && items[i]->HasVideoInfoTag()) ||
@@ -53,6 +53,25 @@ namespace JSONRPC
      */
     static std::string MethodCall(const std::string &inputString, ITransportLayer *transport, IClient *client);
 
+    /*!
+     \brief Handles an incoming JSON-RPC request without serializing the response
+     \param inputString received JSON-RPC request
+     \param transport Transport protocol on which the request arrived
+     \param client Client which sent the request
+     \param response JSON-RPC response to be sent back to the client
+     \return True if there is a response to be sent back, false for notifications
+
+     Lets the transport write the response, e.g. piece by piece with a
+     CJSONVariantStreamWriter, instead of holding all of its JSON in memory.
+     The response CVariant itself is still built as a whole by the method,
+     which for large library listings is the bulk of the memory needed.
+     \sa MethodCall(const std::string&, ITransportLayer*, IClient*)
+     */
+    static bool MethodCall(const std::string& inputString,
+                           ITransportLayer* transport,
+                           IClient* client,
+                           CVariant& response);
+
     static JSONRPC_STATUS Introspect(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Version(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
     static JSONRPC_STATUS Permission(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result);
@@ -24,6 +24,7 @@
 #include "addons/AddonSystemSettings.h"
 #include "addons/Scraper.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/audiodecoder.h"
+#include "dbwrappers/FullTextIndex.h"
 #include "dbwrappers/dataset.h"
 #include "dialogs/GUIDialogKaiToast.h"
 #include "dialogs/GUIDialogProgress.h"
@@ -92,6 +93,27 @@ namespace
 constexpr unsigned int RECENTLY_PLAYED_LIMIT = 25;
 constexpr size_t MIN_FULL_SEARCH_LENGTH = 3;
 
+const CFullTextIndex& GetArtistSearchIndex()
+{
+  static const CFullTextIndex index{"artist", "idArtist", {"strArtist"},
+                                    CFullTextIndex::Tokenizer::WORDS};
+  return index;
+}
+
+const CFullTextIndex& GetAlbumSearchIndex()
+{
+  static const CFullTextIndex index{"album", "idAlbum", {"strAlbum"},
+                                    CFullTextIndex::Tokenizer::WORDS};
+  return index;
+}
+
+const CFullTextIndex& GetSongSearchIndex()
+{
+  static const CFullTextIndex index{"song", "idSong", {"strTitle"},
+                                    CFullTextIndex::Tokenizer::WORDS};
+  return index;
+}
+
 void AnnounceRemove(const std::string& content, int id)
 {
   CVariant data;
@@ -407,6 +429,11 @@ void CMusicDatabase::CreateAnalytics()
               "END");
   CreateRemovedLinkTriggers(); // DELETE ON song_artist and album_artist tables
 
+  // Word indexes for search, they match the same word starts as the LIKE conditions
+  CreateFullTextIndex(GetArtistSearchIndex());
+  CreateFullTextIndex(GetAlbumSearchIndex());
+  CreateFullTextIndex(GetSongSearchIndex());
+
   // Create native functions stored in DB (MySQL/MariaDB only)
   CreateNativeDBFunctions();
 
@@ -1709,16 +1736,14 @@ int CMusicDatabase::AddGenre(std::string& strGenre)
       return it->second;
 
 
-    strSQL = PrepareSQL("SELECT idGenre, strGenre FROM genre WHERE strGenre LIKE '%s'",
-                        strGenre.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT idGenre, strGenre FROM genre WHERE strGenre LIKE ?";
+    m_pDS->query(strSQL, dbiplus::make_bind_list(strGenre));
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("INSERT INTO genre (idGenre, strGenre) values( NULL, '%s' )",
-                          strGenre.c_str());
-      m_pDS->exec(strSQL);
+      strSQL = "INSERT INTO genre (idGenre, strGenre) values( NULL, ? )";
+      m_pDS->exec(strSQL, dbiplus::make_bind_list(strGenre));
 
       const int idGenre = static_cast<int>(m_pDS->lastinsertid());
       m_genreCache.try_emplace(strGenre, idGenre);
@@ -2458,16 +2483,16 @@ int CMusicDatabase::AddRole(const std::string& strRole)
       return -1;
     if (nullptr == m_pDS)
       return -1;
-    strSQL = PrepareSQL("SELECT idRole FROM role WHERE strRole LIKE '%s'", strRole.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT idRole FROM role WHERE strRole LIKE ?";
+    m_pDS->query(strSQL, dbiplus::make_bind_list(strRole));
     if (m_pDS->num_rows() > 0)
       idRole = m_pDS->fv("idRole").get_asInt();
     m_pDS->close();
 
     if (idRole < 0)
     {
-      strSQL = PrepareSQL("INSERT INTO role (strRole) VALUES ('%s')", strRole.c_str());
-      m_pDS->exec(strSQL);
+      strSQL = "INSERT INTO role (strRole) VALUES (?)";
+      m_pDS->exec(strSQL, dbiplus::make_bind_list(strRole));
       idRole = static_cast<int>(m_pDS->lastinsertid());
       m_pDS->close();
     }
@@ -2489,11 +2514,9 @@ bool CMusicDatabase::AddSongArtist(
 bool CMusicDatabase::AddSongArtist(
     int idArtist, int idSong, int idRole, const std::string& strArtist, int iOrder)
 {
-  std::string strSQL;
-  strSQL = PrepareSQL("REPLACE INTO song_artist (idArtist, idSong, idRole, strArtist, iOrder) "
-                      "VALUES(%i, %i, %i,'%s', %i)",
-                      idArtist, idSong, idRole, strArtist.c_str(), iOrder);
-  return ExecuteQuery(strSQL);
+  return ExecuteQuery("REPLACE INTO song_artist (idArtist, idSong, idRole, strArtist, iOrder) "
+                      "VALUES(?, ?, ?, ?, ?)",
+                      dbiplus::make_bind_list(idArtist, idSong, idRole, strArtist, iOrder));
 }
 
 int CMusicDatabase::AddSongContributor(int idSong,
@@ -2643,11 +2666,9 @@ bool CMusicDatabase::AddAlbumArtist(int idArtist,
                                     const std::string& strArtist,
                                     int iOrder)
 {
-  std::string strSQL;
-  strSQL = PrepareSQL("REPLACE INTO album_artist (idArtist, idAlbum, strArtist, iOrder) "
-                      "VALUES(%i,%i,'%s',%i)",
-                      idArtist, idAlbum, strArtist.c_str(), iOrder);
-  return ExecuteQuery(strSQL);
+  return ExecuteQuery("REPLACE INTO album_artist (idArtist, idAlbum, strArtist, iOrder) "
+                      "VALUES(?,?,?,?)",
+                      dbiplus::make_bind_list(idArtist, idAlbum, strArtist, iOrder));
 }
 
 bool CMusicDatabase::DeleteAlbumArtistsByAlbum(int idAlbum)
@@ -2672,9 +2693,8 @@ bool CMusicDatabase::AddSongGenres(int idSong, const std::vector<std::string>& g
     for (auto& strGenre : modgenres)
     {
       int idGenre = AddGenre(strGenre); // Genre string trimmed and matched case-insensitively
-      strSQL = PrepareSQL("INSERT INTO song_genre (idGenre, idSong, iOrder) VALUES(%i,%i,%i)",
-                          idGenre, idSong, index++);
-      if (!ExecuteQuery(strSQL))
+      strSQL = "INSERT INTO song_genre (idGenre, idSong, iOrder) VALUES(?,?,?)";
+      if (!ExecuteQuery(strSQL, dbiplus::make_bind_list(idGenre, idSong, index++)))
         return false;
     }
     // Update concatenated genre string from the standardised genre values
@@ -3042,16 +3062,15 @@ int CMusicDatabase::AddPath(const std::string& strPath1)
     if (it != m_pathCache.end())
       return it->second;
 
-    strSQL = PrepareSQL("SELECT * FROM path WHERE strPath='%s'", strPath.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT * FROM path WHERE strPath=?";
+    m_pDS->query(strSQL, dbiplus::make_bind_list(strPath));
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("INSERT INTO path (idPath, strPath) "
-                          "VALUES(NULL, '%s')",
-                          strPath.c_str());
-      m_pDS->exec(strSQL);
+      strSQL = "INSERT INTO path (idPath, strPath) "
+               "VALUES(NULL, ?)";
+      m_pDS->exec(strSQL, dbiplus::make_bind_list(strPath));
 
       const auto idPath = static_cast<int>(m_pDS->lastinsertid());
       m_pathCache.try_emplace(strPath, idPath);
@@ -3496,6 +3515,8 @@ bool CMusicDatabase::SearchArtists(const std::string& search, CFileItemList& art
                           "WHERE strArtist LIKE '%s%%' AND strArtist <> '%s' ",
                           search.c_str(), strVariousArtists.c_str());
 
+    AppendFullTextSearch(strSQL, GetArtistSearchIndex(), "artist.idArtist", search);
+
     if (!m_pDS->query(strSQL))
       return false;
     if (m_pDS->num_rows() == 0)
@@ -4135,13 +4156,16 @@ bool CMusicDatabase::SearchSongs(const std::string& search, CFileItemList& items
     std::string strSQL;
     if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM songview "
-                          "WHERE strTitle LIKE '%s%%' or strTitle LIKE '%% %s%%' LIMIT 1000",
+                          "WHERE (strTitle LIKE '%s%%' or strTitle LIKE '%% %s%%')",
                           search.c_str(), search.c_str());
     else
       strSQL = PrepareSQL("SELECT * FROM songview "
-                          "WHERE strTitle LIKE '%s%%' LIMIT 1000",
+                          "WHERE strTitle LIKE '%s%%'",
                           search.c_str());
 
+    AppendFullTextSearch(strSQL, GetSongSearchIndex(), "songview.idSong", search);
+    strSQL += " LIMIT 1000";
+
     if (!m_pDS->query(strSQL))
       return false;
     if (m_pDS->num_rows() == 0)
@@ -4178,13 +4202,15 @@ bool CMusicDatabase::SearchAlbums(const std::string& search, CFileItemList& albu
     std::string strSQL;
     if (search.size() >= MIN_FULL_SEARCH_LENGTH)
       strSQL = PrepareSQL("SELECT * FROM albumview "
-                          "WHERE strAlbum LIKE '%s%%' OR strAlbum LIKE '%% %s%%'",
+                          "WHERE (strAlbum LIKE '%s%%' OR strAlbum LIKE '%% %s%%')",
                           search.c_str(), search.c_str());
     else
       strSQL = PrepareSQL("SELECT * FROM albumview "
                           "WHERE strAlbum LIKE '%s%%'",
                           search.c_str());
 
+    AppendFullTextSearch(strSQL, GetAlbumSearchIndex(), "albumview.idAlbum", search);
+
     if (!m_pDS->query(strSQL))
       return false;
 
@@ -5519,6 +5545,8 @@ bool CMusicDatabase::GetArtistsByWhere(
     const SortDescription& sortDescription /* = SortDescription() */,
     bool countOnly /* = false */)
 {
+  CReadScope readScope(*this);
+
   if (nullptr == m_pDB)
     return false;
   if (nullptr == m_pDS)
@@ -5760,6 +5788,8 @@ bool CMusicDatabase::GetAlbumsByWhere(
     const SortDescription& sortDescription /* = SortDescription() */,
     bool countOnly /* = false */)
 {
+  CReadScope readScope(*this);
+
   if (m_pDB == nullptr || m_pDS == nullptr)
     return false;
 
@@ -6404,6 +6434,8 @@ bool CMusicDatabase::GetSongsByWhere(
     CFileItemList& items,
     const SortDescription& sortDescription /* = SortDescription() */)
 {
+  CReadScope readScope(*this);
+
   if (m_pDB == nullptr || m_pDS == nullptr)
     return false;
 
@@ -9451,7 +9483,7 @@ void CMusicDatabase::UpdateTables(int version)
 
 int CMusicDatabase::GetSchemaVersion() const
 {
-  return 83;
+  return 84;
 }
 
 int CMusicDatabase::GetMusicNeedsTagScan()
@@ -49,15 +49,18 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Event.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/FileUtils.h"
+#include "utils/JobManager.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <deque>
 #include <string_view>
 #include <utility>
 
@@ -69,6 +72,70 @@ using namespace MUSIC_GRABBER;
 using namespace ADDON;
 using KODI::UTILITY::CDigest;
 
+static void LoadTag(CFileItem& item)
+{
+  CMusicInfoTag& tag = *item.GetMusicInfoTag();
+  if (!tag.Loaded())
+  {
+    std::unique_ptr<IMusicInfoTagLoader> pLoader(CMusicInfoTagLoaderFactory::CreateLoader(item));
+    if (nullptr != pLoader)
+      pLoader->Load(item.GetPath(), tag);
+  }
+}
+
+/*!
+ \brief Pool of workers that read tags ahead of the scanner thread.
+
+ The scanner thread remains the only database writer. It queues a bounded window of reads and
+ takes the results in item order, so progress and cancellation behave as in a serial scan.
+ */
+class CMusicInfoScanner::CTagReader
+{
+public:
+  explicit CTagReader(unsigned int threads) : m_threads(threads), m_queue(false, threads) {}
+
+  unsigned int GetThreads() const { return m_threads; }
+
+  /*! \brief Queue a tag read for the item. The item must not be touched until Wait() returned
+   for the returned event.
+   */
+  std::shared_ptr<CEvent> Queue(const CFileItemPtr& item)
+  {
+    auto done = std::make_shared<CEvent>(true);
+    m_queue.Submit(
+        [item, done]()
+        {
+          LoadTag(*item);
+          done->Set();
+        });
+    return done;
+  }
+
+  /*! \brief Wait for a queued read.
+   \return true once the tag was read, false if the read was dropped or the scan was stopped.
+   */
+  bool Wait(CEvent& done, const bool& stop) const
+  {
+    using namespace std::chrono_literals;
+
+    while (!stop)
+    {
+      if (done.Wait(100ms))
+        return true;
+      // a job dropped by the job manager never signals, so stop waiting once nothing is queued
+      if (!m_queue.IsProcessing())
+        return done.Wait(0ms);
+    }
+    return false;
+  }
+
+  void Cancel() { m_queue.CancelJobs(); }
+
+private:
+  const unsigned int m_threads;
+  CJobQueue m_queue;
+};
+
 CMusicInfoScanner::CMusicInfoScanner()
 : m_fileCountReader(this, "MusicFileCounter")
 {
@@ -118,6 +185,12 @@ void CMusicInfoScanner::Process()
       // Reset progress vars
       m_currentItem=0;
       m_itemCount=-1;
+      m_stageStats = {};
+
+      const unsigned int readerThreads = CServiceBroker::GetSettingsComponent()
+                                             ->GetAdvancedSettings()
+                                             ->m_musicLibraryTagReaderThreads;
+      SetTagReaderThreads(readerThreads);
 
       // Create the thread to count all files to be scanned
       if (m_handle)
@@ -196,6 +269,7 @@ void CMusicInfoScanner::Process()
       }
 
       m_fileCountReader.StopThread();
+      SetTagReaderThreads(0);
 
       m_musicDatabase.EmptyCache();
 
@@ -204,6 +278,19 @@ void CMusicInfoScanner::Process()
       CLog::Log(LOGINFO,
                 "My Music: Scanning for music info using worker thread, operation took {}s",
                 elapsed.count());
+
+      const auto stage = [](unsigned int count, std::chrono::steady_clock::duration duration)
+      {
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+        return StringUtils::Format("{} in {} ms ({:.1f}/s)", count, ms,
+                                   ms > 0 ? count * 1000.0 / ms : 0.0);
+      };
+      CLog::Log(LOGINFO,
+                "My Music: Listed folders {}, read tags {} using {} reader threads, "
+                "wrote songs {}",
+                stage(m_stageStats.folders, m_stageStats.listing),
+                stage(m_stageStats.files, m_stageStats.tags), readerThreads,
+                stage(m_stageStats.songs, m_stageStats.database));
     }
     if (m_scanType == 1) // load album info
     {
@@ -496,6 +583,7 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
     return true;
 
   // load subfolder
+  auto start = std::chrono::steady_clock::now();
   CFileItemList items;
   CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetMusicExtensions() + "|.jpg|.tbn|.lrc|.cdg", DIR_FLAG_DEFAULTS);
 
@@ -505,6 +593,8 @@ bool CMusicInfoScanner::DoScan(const std::string& strDirectory)
   items.Sort(SortByLabel, SortOrderAscending);
   std::string hash;
   GetPathHash(items, hash);
+  m_stageStats.folders++;
+  m_stageStats.listing += std::chrono::steady_clock::now() - start;
 
   // check whether we need to rescan or not
   std::string dbHash;
@@ -574,11 +664,9 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
 {
   std::vector<std::string> regexps = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
 
+  std::vector<CFileItemPtr> tagItems;
   for (int i = 0; i < items.Size(); ++i)
   {
-    if (m_bStop)
-      return InfoRet::CANCELLED;
-
     CFileItemPtr pItem = items[i];
 
     if (CUtil::ExcludeFileOrFolder(pItem->GetPath(), regexps))
@@ -588,15 +676,50 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
         MUSIC::IsLyrics(*pItem))
       continue;
 
+    tagItems.push_back(pItem);
+  }
+
+  // with reader threads, keep a bounded window of reads in flight ahead of this thread
+  const size_t window = m_tagReader ? 2 * m_tagReader->GetThreads() : 0;
+  std::deque<std::shared_ptr<CEvent>> pending;
+  size_t queued = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < tagItems.size(); ++i)
+  {
+    if (m_bStop)
+    {
+      if (m_tagReader)
+        m_tagReader->Cancel();
+      return InfoRet::CANCELLED;
+    }
+
+    if (m_tagReader)
+    {
+      for (; queued < std::min(tagItems.size(), i + window); ++queued)
+        pending.push_back(m_tagReader->Queue(tagItems[queued]));
+    }
+
+    const CFileItemPtr& pItem = tagItems[i];
+
     m_currentItem++;
 
-    CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    if (!tag.Loaded())
+    if (pending.empty())
+      LoadTag(*pItem);
+    else
     {
-      std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
-      if (nullptr != pLoader)
-        pLoader->Load(pItem->GetPath(), tag);
+      const std::shared_ptr<CEvent> done = std::move(pending.front());
+      pending.pop_front();
+      if (!m_tagReader->Wait(*done, m_bStop))
+      {
+        if (m_bStop)
+          continue;
+        LoadTag(*pItem);
+      }
     }
+    m_stageStats.files++;
+
+    const CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
 
     if (m_handle && m_itemCount>0)
       m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) / static_cast<float>(m_itemCount));
@@ -617,9 +740,18 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
     else
       scannedItems.Add(pItem);
   }
+  m_stageStats.tags += std::chrono::steady_clock::now() - start;
   return InfoRet::ADDED;
 }
 
+void CMusicInfoScanner::SetTagReaderThreads(unsigned int threads)
+{
+  if (threads > 0)
+    m_tagReader = std::make_unique<CTagReader>(threads);
+  else
+    m_tagReader.reset();
+}
+
 static bool SortSongsByTrack(const CSong& song, const CSong& song2)
 {
   return song.iTrack < song2.iTrack;
@@ -919,8 +1051,10 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
   MAPSONGS songsMap;
 
   // get all information for all files in current directory from database, and remove them
+  auto start = std::chrono::steady_clock::now();
   if (m_musicDatabase.RemoveSongsFromPath(strDirectory, songsMap))
     m_needsCleanup = true;
+  m_stageStats.database += std::chrono::steady_clock::now() - start;
 
   CFileItemList scannedItems;
   if (ScanTags(items, scannedItems) == InfoRet::CANCELLED || scannedItems.Size() == 0)
@@ -963,6 +1097,8 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
   int numAdded = 0;
 
   // Add all albums to the library, and hence any new song or album artists or other contributors
+  // Each album is written in one transaction by AddAlbum()
+  start = std::chrono::steady_clock::now();
   for (auto& album : albums)
   {
     if (m_bStop)
@@ -978,6 +1114,8 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
 
     numAdded += static_cast<int>(album.songs.size());
   }
+  m_stageStats.songs += numAdded;
+  m_stageStats.database += std::chrono::steady_clock::now() - start;
   return numAdded;
 }
 
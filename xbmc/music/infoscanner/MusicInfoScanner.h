@@ -16,6 +16,9 @@
 #include "threads/Thread.h"
 #include "utils/ScraperUrl.h"
 
+#include <chrono>
+#include <memory>
+
 class CAlbum;
 class CArtist;
 class CGUIDialogProgressBarHandle;
@@ -251,6 +254,10 @@ protected:
    \param scannedItems [in] list to populate with the scannedItems
    */
   InfoRet ScanTags(const CFileItemList& items, CFileItemList& scannedItems);
+
+  /*! \brief Set the number of threads ScanTags() reads tags on, 0 reads them inline
+   */
+  void SetTagReaderThreads(unsigned int threads);
   int GetPathHash(const CFileItemList &items, std::string &hash);
 
   void Run() override;
@@ -281,5 +288,20 @@ protected:
   std::set<std::string> m_seenPaths;
   int m_flags;
   CThread m_fileCountReader;
+
+  class CTagReader;
+  std::unique_ptr<CTagReader> m_tagReader; //!< only set while a file scan runs with reader threads
+
+  //! Work done and time spent per stage of a file scan, for the throughput log
+  struct ScanStageStats
+  {
+    unsigned int folders{0};
+    unsigned int files{0};
+    unsigned int songs{0};
+    std::chrono::steady_clock::duration listing{};
+    std::chrono::steady_clock::duration tags{};
+    std::chrono::steady_clock::duration database{};
+  };
+  ScanStageStats m_stageStats;
 };
 }
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "music/infoscanner/MusicInfoScanner.h"
+#include "music/tags/MusicInfoTag.h"
+#include "utils/JobManager.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace MUSIC_INFO;
+
+namespace
+{
+class CTestMusicInfoScanner : public CMusicInfoScanner
+{
+public:
+  using CMusicInfoScanner::ScanTags;
+  using CMusicInfoScanner::SetTagReaderThreads;
+};
+
+CFileItemPtr MakeSong(const std::string& path, const std::string& title)
+{
+  auto item = std::make_shared<CFileItem>(path, false);
+  CMusicInfoTag& tag = *item->GetMusicInfoTag();
+  tag.SetTitle(title);
+  tag.SetLoaded(true);
+  return item;
+}
+} // namespace
+
+// Without reader threads, which is the default, the tags are read inline
+TEST(TestMusicInfoScanner, ScanTagsWithoutReaderThreads)
+{
+  CFileItemList items;
+  items.Add(MakeSong("/music/album/01.mp3", "one"));
+  items.Add(MakeSong("/music/album/02.mp3", "two"));
+  items.Add(MakeSong("/music/album/03.mp3", "three"));
+  items.Add(std::make_shared<CFileItem>("/music/album/cover.jpg", false));
+
+  CTestMusicInfoScanner scanner;
+  CFileItemList scannedItems;
+  EXPECT_EQ(CInfoScanner::InfoRet::ADDED, scanner.ScanTags(items, scannedItems));
+
+  ASSERT_EQ(3, scannedItems.Size());
+  EXPECT_EQ("one", scannedItems[0]->GetMusicInfoTag()->GetTitle());
+  EXPECT_EQ("two", scannedItems[1]->GetMusicInfoTag()->GetTitle());
+  EXPECT_EQ("three", scannedItems[2]->GetMusicInfoTag()->GetTitle());
+}
+
+// With reader threads the tags are read on the job manager, more items than fit in the window of
+// reads in flight still come back in item order
+TEST(TestMusicInfoScanner, ScanTagsWithReaderThreads)
+{
+  CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+
+  CFileItemList items;
+  for (int i = 0; i < 10; i++)
+    items.Add(MakeSong("/music/album/" + std::to_string(i) + ".mp3", std::to_string(i)));
+  items.Add(std::make_shared<CFileItem>("/music/album/cover.jpg", false));
+
+  CTestMusicInfoScanner scanner;
+  scanner.SetTagReaderThreads(2);
+  CFileItemList scannedItems;
+  EXPECT_EQ(CInfoScanner::InfoRet::ADDED, scanner.ScanTags(items, scannedItems));
+  scanner.SetTagReaderThreads(0);
+
+  ASSERT_EQ(10, scannedItems.Size());
+  for (int i = 0; i < 10; i++)
+    EXPECT_EQ(std::to_string(i), scannedItems[i]->GetMusicInfoTag()->GetTitle());
+
+  CServiceBroker::GetJobManager()->CancelJobs();
+  CServiceBroker::GetJobManager()->Restart();
+  CServiceBroker::UnregisterJobManager();
+}
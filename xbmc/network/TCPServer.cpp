@@ -14,6 +14,7 @@
 #include "network/Network.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
@@ -504,6 +505,7 @@ void CTCPServer::Deinitialize()
 CTCPServer::CTCPClient::CTCPClient()
 {
   m_new = true;
+  m_closing = false;
   m_announcementflags = ANNOUNCEMENT::ANNOUNCE_ALL;
   m_socket = INVALID_SOCKET;
   m_beginBrackets = 0;
@@ -551,6 +553,29 @@ void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
   } while (sent < size);
 }
 
+void CTCPServer::CTCPClient::SendResponse(const CVariant& response)
+{
+  CJSONVariantStreamWriter writer(
+      response,
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+
+  std::vector<char> buffer(16 * 1024);
+  size_t size;
+  do
+  {
+    size = writer.Read(buffer.data(), buffer.size());
+    if (size > 0)
+      Send(buffer.data(), static_cast<unsigned int>(size));
+  } while (size == buffer.size());
+
+  if (writer.HasFailed())
+  {
+    CLog::Log(LOGERROR,
+              "JSONRPC Server: Failed to write the JSON of a response, closing the connection");
+    m_closing = true;
+  }
+}
+
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
@@ -614,10 +639,15 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
       }
       if (m_beginBrackets > 0 && m_endBrackets > 0 && m_beginBrackets == m_endBrackets)
       {
-        std::string line = CJSONRPC::MethodCall(m_buffer, host, this);
-        Send(line.c_str(), line.size());
+        CVariant response;
+        if (CJSONRPC::MethodCall(m_buffer, host, this, response))
+          SendResponse(response);
         m_beginChar = m_beginBrackets = m_endBrackets = 0;
         m_buffer.clear();
+
+        // the server closes the connection, requests still in the buffer aren't answered
+        if (m_closing)
+          return;
       }
     }
   }
@@ -637,6 +667,7 @@ void CTCPServer::CTCPClient::Disconnect()
 void CTCPServer::CTCPClient::Copy(const CTCPClient& client)
 {
   m_new               = client.m_new;
+  m_closing           = client.m_closing;
   m_socket            = client.m_socket;
   m_cliaddr           = client.m_cliaddr;
   m_addrlen           = client.m_addrlen;
@@ -695,6 +726,16 @@ void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
 }
 
+void CTCPServer::CWebSocketClient::SendResponse(const CVariant& response)
+{
+  // every response has to go out as a single message
+  std::string str;
+  if (CJSONVariantWriter::Write(
+          response, str,
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact))
+    Send(str.c_str(), str.size());
+}
+
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   bool send;
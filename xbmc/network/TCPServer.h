@@ -65,11 +65,18 @@ namespace JSONRPC
       bool SetAnnouncementFlags(int flags) override;
 
       virtual void Send(const char *data, unsigned int size);
+      /*!
+       \brief Sends the JSON of a JSON-RPC response, piece by piece as it is written
+
+       The connection is closed if the response can't be written completely, as the client can't
+       make sense of whatever follows a partial response.
+       */
+      virtual void SendResponse(const CVariant& response);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
       virtual bool IsNew() const { return m_new; }
-      virtual bool Closing() const { return false; }
+      virtual bool Closing() const { return m_closing; }
 
       SOCKET m_socket;
       sockaddr_storage m_cliaddr;
@@ -80,6 +87,7 @@ namespace JSONRPC
       void Copy(const CTCPClient& client);
     private:
       bool m_new;
+      bool m_closing;
       int m_announcementflags;
       int m_beginBrackets, m_endBrackets;
       char m_beginChar, m_endChar;
@@ -96,6 +104,7 @@ namespace JSONRPC
       ~CWebSocketClient() override;
 
       void Send(const char *data, unsigned int size) override;
+      void SendResponse(const CVariant& response) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
       void Disconnect() override;
 
@@ -10,6 +10,7 @@
 
 #include "CompileInfo.h"
 #include "ServiceBroker.h"
+#include "WebServerLocalFile.h"
 #include "XBDateTime.h"
 #include "filesystem/File.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
@@ -36,6 +37,7 @@
 #include <inttypes.h>
 
 #define MAX_POST_BUFFER_SIZE 2048
+#define STREAM_BLOCK_SIZE 65536
 
 #define PAGE_FILE_NOT_FOUND \
   "<html><head><title>File not found</title></head><body>File not found</body></html>"
@@ -356,6 +358,10 @@ MHD_RESULT CWebServer::HandleRequest(const std::shared_ptr<IHTTPRequestHandler>&
       ret = CreateMemoryDownloadResponse(handler, response);
       break;
 
+    case HTTPStreamDownload:
+      ret = CreateStreamDownloadResponse(handler, response);
+      break;
+
     case HTTPError:
       ret =
           CreateErrorResponse(request.connection, responseDetails.status, request.method, response);
@@ -791,21 +797,32 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   const HTTPResponseDetails& responseDetails = handler->GetResponseDetails();
   HttpResponseRanges responseRanges = handler->GetResponseData();
 
-  std::shared_ptr<XFILE::CFile> file = std::make_shared<XFILE::CFile>();
+  std::shared_ptr<XFILE::CFile> file;
   std::string filePath = handler->GetResponseFile();
 
   // access check
   if (!CFileUtils::CheckFileAccessAllowed(filePath))
     return SendErrorResponse(request, MHD_HTTP_NOT_FOUND, request.method);
 
-  if (!file->Open(filePath, XFILE::READ_NO_CACHE))
+  // plain local files are handed to libmicrohttpd as a file descriptor so it can send them with
+  // sendfile() instead of copying everything through our reader callback
+  CWebServerLocalFile localFile;
+  uint64_t fileLength = 0;
+  if (localFile.Open(filePath))
+    fileLength = localFile.GetLength();
+  else
   {
-    m_logger->error("Failed to open {}", filePath);
-    return SendErrorResponse(request, MHD_HTTP_NOT_FOUND, request.method);
+    file = std::make_shared<XFILE::CFile>();
+    if (!file->Open(filePath, XFILE::READ_NO_CACHE))
+    {
+      m_logger->error("Failed to open {}", filePath);
+      return SendErrorResponse(request, MHD_HTTP_NOT_FOUND, request.method);
+    }
+
+    fileLength = static_cast<uint64_t>(file->GetLength());
   }
 
   bool ranged = false;
-  uint64_t fileLength = static_cast<uint64_t>(file->GetLength());
 
   // get the MIME type for the Content-Type header
   std::string mimeType = responseDetails.contentType;
@@ -818,7 +835,6 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
 
   uint64_t totalLength = 0;
   std::unique_ptr<HttpFileDownloadContext> context = std::make_unique<HttpFileDownloadContext>();
-  context->file = file;
   context->contentType = mimeType;
   context->boundaryWritten = false;
   context->writePosition = 0;
@@ -853,6 +869,20 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   // remember the total length
   totalLength = context->ranges.GetLength();
 
+  // multipart responses interleave boundaries with the data so they need the reader callback
+  if (localFile.IsOpen() && context->rangeCountTotal > 1)
+  {
+    localFile.Close();
+
+    file = std::make_shared<XFILE::CFile>();
+    if (!file->Open(filePath, XFILE::READ_NO_CACHE))
+    {
+      m_logger->error("Failed to open {}", filePath);
+      return SendErrorResponse(request, MHD_HTTP_NOT_FOUND, request.method);
+    }
+  }
+  context->file = file;
+
   // adjust the MIME type and range length in case of multiple ranges which requires multipart
   // boundaries
   if (context->rangeCountTotal > 1)
@@ -888,9 +918,16 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   context->ranges.GetFirstPosition(context->writePosition);
 
   // create the response object
-  response =
-      MHD_create_response_from_callback(totalLength, 2048, &CWebServer::ContentReaderCallback,
-                                        context.get(), &CWebServer::ContentReaderFreeCallback);
+  if (localFile.IsOpen())
+    response = localFile.CreateResponse(totalLength, context->writePosition);
+  else
+  {
+    response =
+        MHD_create_response_from_callback(totalLength, 2048, &CWebServer::ContentReaderCallback,
+                                          context.get(), &CWebServer::ContentReaderFreeCallback);
+    if (response != nullptr)
+      context.release(); // ownership was passed to mhd
+  }
   if (response == nullptr)
   {
     m_logger->error("failed to create a HTTP response for {} to be filled from{}", request.pathUrl,
@@ -898,8 +935,6 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
     return MHD_NO;
   }
 
-  context.release(); // ownership was passed to mhd
-
   // add Content-Range header
   if (ranged)
     handler->AddResponseHeader(
@@ -913,6 +948,28 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   return MHD_YES;
 }
 
+MHD_RESULT CWebServer::CreateStreamDownloadResponse(
+    const std::shared_ptr<IHTTPRequestHandler>& handler, struct MHD_Response*& response) const
+{
+  if (handler == nullptr)
+    return MHD_NO;
+
+  // the handler is kept alive until mhd has read all of the data
+  auto context = std::make_unique<std::shared_ptr<IHTTPRequestHandler>>(handler);
+  response = MHD_create_response_from_callback(MHD_SIZE_UNKNOWN, STREAM_BLOCK_SIZE,
+                                               &CWebServer::StreamReaderCallback, context.get(),
+                                               &CWebServer::StreamReaderFreeCallback);
+  if (response == nullptr)
+  {
+    m_logger->error("failed to create a HTTP stream response for {}",
+                    handler->GetRequest().pathUrl);
+    return MHD_NO;
+  }
+
+  context.release(); // ownership was passed to mhd
+  return MHD_YES;
+}
+
 MHD_RESULT CWebServer::CreateErrorResponse(struct MHD_Connection* connection,
                                            int responseType,
                                            HTTPMethod method,
@@ -1008,6 +1065,29 @@ void CWebServer::LogRequest(const char* uri) const
   m_logger->debug("request received for {}", uri);
 }
 
+ssize_t CWebServer::StreamReaderCallback(void* cls, uint64_t pos, char* buf, size_t max)
+{
+  const auto handler = static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+  if (handler == nullptr || *handler == nullptr)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+
+  const ssize_t read = (*handler)->ReadResponseData(buf, max);
+  if (read < 0)
+    return MHD_CONTENT_READER_END_WITH_ERROR;
+  if (read == 0)
+    return MHD_CONTENT_READER_END_OF_STREAM;
+
+  if (CServiceBroker::GetLogging().CanLogComponent(LOGWEBSERVER))
+    GetLogger()->debug("[OUT] streamed {} bytes at {}", read, pos);
+
+  return read;
+}
+
+void CWebServer::StreamReaderFreeCallback(void* cls)
+{
+  delete static_cast<std::shared_ptr<IHTTPRequestHandler>*>(cls);
+}
+
 ssize_t CWebServer::ContentReaderCallback(void* cls, uint64_t pos, char* buf, size_t max)
 {
   HttpFileDownloadContext* context = (HttpFileDownloadContext*)cls;
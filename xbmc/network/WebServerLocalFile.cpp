@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "WebServerLocalFile.h"
+
+#include "URL.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <microhttpd.h>
+
+#if defined(TARGET_POSIX)
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+#endif
+
+CWebServerLocalFile::~CWebServerLocalFile()
+{
+  Close();
+}
+
+bool CWebServerLocalFile::Open(const std::string& path)
+{
+  Close();
+
+#if defined(TARGET_POSIX)
+  const CURL url(CSpecialProtocol::TranslatePath(path));
+  if (!url.IsProtocol("file") && !url.GetProtocol().empty())
+    return false;
+
+  const std::string localPath = url.GetFileName();
+  if (localPath.empty())
+    return false;
+
+  const int fd = open(localPath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+  {
+    close(fd);
+    return false;
+  }
+
+  m_fd = fd;
+  m_length = static_cast<uint64_t>(st.st_size);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void CWebServerLocalFile::Close()
+{
+#if defined(TARGET_POSIX)
+  if (m_fd >= 0)
+    close(m_fd);
+#endif
+  m_fd = -1;
+  m_length = 0;
+}
+
+MHD_Response* CWebServerLocalFile::CreateResponse(uint64_t size, uint64_t offset)
+{
+  MHD_Response* response = nullptr;
+#if defined(TARGET_POSIX)
+  if (m_fd >= 0)
+  {
+    response = MHD_create_response_from_fd_at_offset64(size, m_fd, offset);
+    // mhd owns the file descriptor now and closes it with the response
+    if (response != nullptr)
+      m_fd = -1;
+  }
+#endif
+  Close();
+  return response;
+}
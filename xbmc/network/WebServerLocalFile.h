@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+struct MHD_Response;
+
+/*!
+ * \brief File descriptor of a plain local file served by the webserver.
+ *
+ * libmicrohttpd can send such a file with sendfile() instead of copying everything through a
+ * reader callback. Only available on POSIX platforms, elsewhere Open() always fails.
+ */
+class CWebServerLocalFile
+{
+public:
+  CWebServerLocalFile() = default;
+  ~CWebServerLocalFile();
+
+  CWebServerLocalFile(const CWebServerLocalFile&) = delete;
+  CWebServerLocalFile& operator=(const CWebServerLocalFile&) = delete;
+
+  /*!
+   * \brief Open a file which the VFS would read from the local filesystem.
+   * \return false for any other protocol or anything but a regular file
+   */
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const { return m_fd >= 0; }
+  uint64_t GetLength() const { return m_length; }
+
+  /*!
+   * \brief Create a response which sends size bytes of the file from offset on.
+   *
+   * The response takes over the file descriptor and closes it once it is destroyed. If the
+   * response can't be created the file descriptor is closed right away, so the file is closed
+   * in any case.
+   */
+  MHD_Response* CreateResponse(uint64_t size, uint64_t offset);
+
+private:
+  int m_fd = -1;
+  uint64_t m_length = 0;
+};
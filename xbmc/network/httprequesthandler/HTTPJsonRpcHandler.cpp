@@ -13,13 +13,27 @@
 #include "interfaces/json-rpc/JSONRPC.h"
 #include "interfaces/json-rpc/JSONServiceDescription.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/FileUtils.h"
-#include "utils/JSONVariantWriter.h"
-#include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cstring>
+
 #define MAX_HTTP_POST_SIZE 65536
 
+namespace
+{
+size_t ReadAffix(std::string& affix, char* buffer, size_t size)
+{
+  const size_t length = std::min(size, affix.size());
+  std::memcpy(buffer, affix.data(), length);
+  affix.erase(0, length);
+  return length;
+}
+} // unnamed namespace
+
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
   return (request.pathUrl.compare("/jsonrpc") == 0);
@@ -70,25 +84,20 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
       jsonpCallback = argument->second;
   }
 
+  bool hasResponse = false;
+  bool compact =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact;
   if (isRequest)
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
-
-    if (!jsonpCallback.empty())
-      m_responseData = jsonpCallback + "(" + m_responseData + ");";
+    hasResponse = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client,
+                                                m_responseValue);
   }
   else if (jsonpCallback.empty())
   {
     // get the whole output of JSONRPC.Introspect
-    CVariant result;
-    JSONRPC::CJSONServiceDescription::Print(result, &m_transportLayer, &client);
-    if (!CJSONVariantWriter::Write(result, m_responseData, false))
-    {
-      m_response.type = HTTPError;
-      m_response.status = MHD_HTTP_INTERNAL_SERVER_ERROR;
-
-      return MHD_YES;
-    }
+    JSONRPC::CJSONServiceDescription::Print(m_responseValue, &m_transportLayer, &client);
+    hasResponse = true;
+    compact = false;
   }
   else
   {
@@ -100,12 +109,29 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
 
   m_requestData.clear();
 
-  m_responseRange.SetData(m_responseData.c_str(), m_responseData.size());
+  if (!jsonpCallback.empty())
+  {
+    m_responsePrefix = jsonpCallback + "(";
+    m_responseSuffix = ");";
+  }
+
+  if (hasResponse)
+  {
+    // large responses would otherwise be held in memory as JSON in full, maybe more than once
+    m_responseWriter = std::make_unique<CJSONVariantStreamWriter>(m_responseValue, compact);
+    m_response.type = HTTPStreamDownload;
+  }
+  else
+  {
+    m_responseData = m_responsePrefix + m_responseSuffix;
+    m_responseRange.SetData(m_responseData.c_str(), m_responseData.size());
+
+    m_response.type = HTTPMemoryDownloadNoFreeCopy;
+    m_response.totalLength = m_responseData.size();
+  }
 
-  m_response.type = HTTPMemoryDownloadNoFreeCopy;
   m_response.status = MHD_HTTP_OK;
   m_response.contentType = "application/json";
-  m_response.totalLength = m_responseData.size();
 
   return MHD_YES;
 }
@@ -118,6 +144,28 @@ HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
   return ranges;
 }
 
+ssize_t CHTTPJsonRpcHandler::ReadResponseData(char* buffer, size_t size)
+{
+  if (!m_responseWriter)
+    return -1;
+
+  size_t written = ReadAffix(m_responsePrefix, buffer, size);
+  if (m_responsePrefix.empty())
+  {
+    written += m_responseWriter->Read(buffer + written, size - written);
+    if (m_responseWriter->HasFailed())
+    {
+      CLog::Log(LOGERROR, "JSONRPC: Failed to write the response");
+      return -1;
+    }
+
+    if (m_responseWriter->IsDone())
+      written += ReadAffix(m_responseSuffix, buffer + written, size - written);
+  }
+
+  return static_cast<ssize_t>(written);
+}
+
 bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
 {
   if (m_requestData.size() + size > MAX_HTTP_POST_SIZE)
@@ -11,7 +11,10 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
 
+#include <memory>
 #include <string>
 
 class CHTTPJsonRpcHandler : public IHTTPRequestHandler
@@ -27,6 +30,7 @@ public:
   MHD_RESULT HandleRequest() override;
 
   HttpResponseRanges GetResponseData() const override;
+  ssize_t ReadResponseData(char* buffer, size_t size) override;
 
   int GetPriority() const override { return 5; }
 
@@ -42,6 +46,12 @@ private:
   std::string m_responseData;
   CHttpResponseRange m_responseRange;
 
+  // responses are written while they are sent, wrapped in the JSONP callback if there is one
+  CVariant m_responseValue;
+  std::unique_ptr<CJSONVariantStreamWriter> m_responseWriter;
+  std::string m_responsePrefix;
+  std::string m_responseSuffix;
+
   class CHTTPTransportLayer : public JSONRPC::ITransportLayer
   {
   public:
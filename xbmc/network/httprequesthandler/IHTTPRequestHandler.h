@@ -60,7 +60,9 @@ typedef enum HTTPResponseType
   HTTPMemoryDownloadFreeNoCopy,
   // creates a HTTP response from a buffer by copying followed by freeing the buffer
   // the buffer must have been malloc'ed and not new'ed
-  HTTPMemoryDownloadFreeCopy
+  HTTPMemoryDownloadFreeCopy,
+  // creates a chunked HTTP response of unknown length read piece by piece from the handler
+  HTTPStreamDownload
 } HTTPResponseType;
 
 typedef struct HTTPRequest
@@ -153,6 +155,14 @@ public:
    */
   virtual HttpResponseRanges GetResponseData() const { return HttpResponseRanges(); }
 
+  /*!
+   * \brief Reads the next part of the response data into the given buffer.
+   *
+   * \details This is only used if the response type is HTTPStreamDownload. It is called from the
+   * web server's threads until it returns 0 at the end of the data or -1 on failure.
+   */
+  virtual ssize_t ReadResponseData(char* buffer, size_t size) { return -1; }
+
   /*!
   * \brief Returns the URL to which the request should be redirected.
   *
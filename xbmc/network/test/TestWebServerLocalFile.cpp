@@ -0,0 +1,120 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/SpecialProtocol.h"
+#include "network/WebServerLocalFile.h"
+#include "test/TestUtils.h"
+
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include <gtest/gtest.h>
+#include <microhttpd.h>
+
+namespace
+{
+const std::string TEST_FILE = "xbmc/network/test/data/webserver/test-ranges.txt";
+
+class TestWebServerLocalFile : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+#if !defined(TARGET_POSIX)
+    GTEST_SKIP() << "local files are only served by file descriptor on POSIX";
+#endif
+    m_path = XBMC_REF_FILE_PATH(TEST_FILE);
+  }
+
+  // number of file descriptors of this process that are open on the test file
+  int GetOpenDescriptors() const
+  {
+    int count = 0;
+#if defined(TARGET_LINUX)
+    const std::filesystem::path file = CSpecialProtocol::TranslatePath(m_path);
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/fd", ec))
+    {
+      if (std::filesystem::equivalent(std::filesystem::read_symlink(entry, ec), file, ec))
+        count++;
+    }
+#endif
+    return count;
+  }
+
+  std::string m_path;
+};
+} // namespace
+
+TEST_F(TestWebServerLocalFile, OpensRegularFile)
+{
+  CWebServerLocalFile file;
+  ASSERT_TRUE(file.Open(m_path));
+  EXPECT_TRUE(file.IsOpen());
+  EXPECT_EQ(20u, file.GetLength());
+
+  file.Close();
+  EXPECT_FALSE(file.IsOpen());
+  EXPECT_EQ(0, GetOpenDescriptors());
+}
+
+TEST_F(TestWebServerLocalFile, DoesNotOpenDirectory)
+{
+  CWebServerLocalFile file;
+  EXPECT_FALSE(file.Open(XBMC_REF_FILE_PATH("xbmc/network/test/data/webserver/")));
+  EXPECT_FALSE(file.IsOpen());
+}
+
+TEST_F(TestWebServerLocalFile, ClosesWhenDestroyed)
+{
+  {
+    CWebServerLocalFile file;
+    ASSERT_TRUE(file.Open(m_path));
+    EXPECT_EQ(1, GetOpenDescriptors());
+  }
+  EXPECT_EQ(0, GetOpenDescriptors());
+}
+
+// a single range is sent straight from the file descriptor, which the response owns
+TEST_F(TestWebServerLocalFile, ResponseOwnsDescriptor)
+{
+  CWebServerLocalFile file;
+  ASSERT_TRUE(file.Open(m_path));
+
+  MHD_Response* response = file.CreateResponse(6, 7);
+  ASSERT_NE(nullptr, response);
+  EXPECT_FALSE(file.IsOpen());
+  EXPECT_EQ(1, GetOpenDescriptors());
+
+  MHD_destroy_response(response);
+  EXPECT_EQ(0, GetOpenDescriptors());
+}
+
+// multiple ranges need the reader callback, the file descriptor isn't used
+TEST_F(TestWebServerLocalFile, ClosesForMultipleRanges)
+{
+  CWebServerLocalFile file;
+  ASSERT_TRUE(file.Open(m_path));
+
+  file.Close();
+  EXPECT_FALSE(file.IsOpen());
+  EXPECT_EQ(nullptr, file.CreateResponse(6, 7));
+  EXPECT_EQ(0, GetOpenDescriptors());
+}
+
+TEST_F(TestWebServerLocalFile, ClosesWhenResponseFails)
+{
+  CWebServerLocalFile file;
+  ASSERT_TRUE(file.Open(m_path));
+
+  // mhd refuses a response of unknown size from a file descriptor
+  EXPECT_EQ(nullptr, file.CreateResponse(MHD_SIZE_UNKNOWN, 0));
+  EXPECT_FALSE(file.IsOpen());
+  EXPECT_EQ(0, GetOpenDescriptors());
+}
@@ -92,6 +92,22 @@ CCPUInfoOsx::CCPUInfoOsx() : m_resourceCounter(new CPosixResourceCounter())
   else
     m_cpuFeatures |= CPU_FEATURE_MMX;
 
+  // these are only reported if the OS supports them as well
+  int supported = 0;
+  size_t supportedLength = sizeof(supported);
+  if (sysctlbyname("hw.optional.avx2_0", &supported, &supportedLength, nullptr, 0) == 0 &&
+      supported)
+    m_cpuFeatures |= CPU_FEATURE_AVX2;
+
+  supported = 0;
+  if (sysctlbyname("hw.optional.avx512f", &supported, &supportedLength, nullptr, 0) == 0 &&
+      supported)
+    m_cpuFeatures |= CPU_FEATURE_AVX512;
+
+#if defined(__aarch64__)
+  m_cpuFeatures |= CPU_FEATURE_NEON;
+#endif
+
   // Set MMX2 when SSE is present as SSE is a superset of MMX2 and Intel doesn't set the MMX2 cap
   if (m_cpuFeatures & CPU_FEATURE_SSE)
     m_cpuFeatures |= CPU_FEATURE_MMX2;
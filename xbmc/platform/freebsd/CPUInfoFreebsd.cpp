@@ -160,6 +160,26 @@ CCPUInfoFreebsd::CCPUInfoFreebsd()
         m_cpuFeatures |= CPU_FEATURE_3DNOWEXT;
     }
   }
+
+  // AVX registers are only usable if the OS saves them, check that before looking at AVX2/512
+  if (__get_cpuid(CPUID_INFOTYPE_STANDARD, &eax, &ebx, &ecx, &edx) &&
+      (ecx & CPUID_00000001_ECX_OSXSAVE) && (ecx & CPUID_00000001_ECX_AVX))
+  {
+    uint32_t xcr0Low;
+    uint32_t xcr0High;
+    __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    const uint64_t xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+
+    if ((xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE &&
+        __get_cpuid_count(CPUID_INFOTYPE_STRUCTURED_EXTENDED, 0, &eax, &ebx, &ecx, &edx))
+    {
+      if (ebx & CPUID_00000007_EBX_AVX2)
+        m_cpuFeatures |= CPU_FEATURE_AVX2;
+
+      if ((ebx & CPUID_00000007_EBX_AVX512F) && (xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE)
+        m_cpuFeatures |= CPU_FEATURE_AVX512;
+    }
+  }
 #endif
 
 #if defined(HAS_NEON)
@@ -0,0 +1,213 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "InotifyDirectoryWatcher.h"
+
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace
+{
+constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                                IN_MOVED_TO | IN_ONLYDIR | IN_DONT_FOLLOW;
+} // namespace
+
+CInotifyDirectoryWatcher::CInotifyDirectoryWatcher(XFILE::IDirectoryWatcherCallback& callback)
+  : CThread("InotifyWatcher"), m_callback(callback)
+{
+  m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (m_fd < 0)
+  {
+    CLog::LogF(LOGERROR, "inotify_init1 failed: {}", strerror(errno));
+    return;
+  }
+
+  m_wakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (m_wakeupFd < 0)
+  {
+    CLog::LogF(LOGERROR, "eventfd failed: {}", strerror(errno));
+    return;
+  }
+
+  Create();
+}
+
+CInotifyDirectoryWatcher::~CInotifyDirectoryWatcher()
+{
+  if (IsRunning())
+  {
+    m_bStop = true;
+    const uint64_t value = 1;
+    if (write(m_wakeupFd, &value, sizeof(value)) < 0)
+      CLog::LogF(LOGERROR, "failed to wake up watcher thread: {}", strerror(errno));
+    StopThread();
+  }
+
+  if (m_wakeupFd >= 0)
+    close(m_wakeupFd);
+  if (m_fd >= 0)
+    close(m_fd); // also removes all watches
+}
+
+bool CInotifyDirectoryWatcher::AddTree(const std::string& path)
+{
+  std::unique_lock lock(m_section);
+  return AddWatchesLocked(path);
+}
+
+void CInotifyDirectoryWatcher::RemoveTree(const std::string& path)
+{
+  std::unique_lock lock(m_section);
+  RemoveWatchesLocked(path);
+}
+
+bool CInotifyDirectoryWatcher::AddWatchesLocked(const std::string& path)
+{
+  if (!AddWatchLocked(path))
+    return false;
+
+  // symlinked directories are not followed, so a tree can't be entered twice
+  bool complete = true;
+  std::error_code ec;
+  for (auto it = std::filesystem::recursive_directory_iterator(
+           path, std::filesystem::directory_options::skip_permission_denied, ec);
+       !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+  {
+    if (it->is_directory(ec) && !it->is_symlink(ec) &&
+        !AddWatchLocked(it->path().string() + "/"))
+    {
+      complete = false;
+      break;
+    }
+  }
+
+  if (ec)
+    CLog::LogF(LOGWARNING, "failed to walk '{}': {}", path, ec.message());
+
+  return complete && !ec;
+}
+
+bool CInotifyDirectoryWatcher::AddWatchLocked(const std::string& directory)
+{
+  const int wd = inotify_add_watch(m_fd, directory.c_str(), WATCH_MASK);
+  if (wd < 0)
+  {
+    if (errno == ENOSPC)
+    {
+      if (!m_limitReported)
+        CLog::Log(LOGWARNING,
+                  "InotifyWatcher: Watch limit reached while adding '{}', raise "
+                  "fs.inotify.max_user_watches to watch all library sources",
+                  directory);
+      m_limitReported = true;
+    }
+    else
+      CLog::LogF(LOGDEBUG, "unable to watch '{}': {}", directory, strerror(errno));
+    return false;
+  }
+
+  // inotify returns the existing descriptor if the directory is already watched
+  m_directories[wd] = directory;
+  m_watches[directory] = wd;
+  return true;
+}
+
+void CInotifyDirectoryWatcher::RemoveWatchesLocked(const std::string& path)
+{
+  auto it = m_watches.lower_bound(path);
+  while (it != m_watches.end() && StringUtils::StartsWith(it->first, path))
+  {
+    inotify_rm_watch(m_fd, it->second);
+    m_directories.erase(it->second);
+    it = m_watches.erase(it);
+  }
+}
+
+void CInotifyDirectoryWatcher::HandleEvent(const inotify_event& event)
+{
+  if (event.mask & IN_Q_OVERFLOW)
+  {
+    CLog::Log(LOGWARNING, "InotifyWatcher: Event queue overflowed");
+    m_callback.OnWatchOverflow();
+    return;
+  }
+
+  std::string directory;
+  {
+    std::unique_lock lock(m_section);
+    auto it = m_directories.find(event.wd);
+    if (it == m_directories.end())
+      return;
+
+    directory = it->second;
+    if (event.mask & IN_IGNORED)
+    { // the directory itself was removed or unmounted
+      m_watches.erase(directory);
+      m_directories.erase(it);
+      return;
+    }
+
+    if ((event.mask & IN_ISDIR) && event.len > 0)
+    {
+      const std::string child = directory + event.name + "/";
+      if (event.mask & (IN_CREATE | IN_MOVED_TO))
+        AddWatchesLocked(child);
+      else if (event.mask & IN_MOVED_FROM)
+        RemoveWatchesLocked(child);
+    }
+  }
+
+  // a new file is only reported once it has been written completely
+  if ((event.mask & IN_CREATE) && !(event.mask & IN_ISDIR))
+    return;
+
+  m_callback.OnDirectoryChanged(directory);
+}
+
+void CInotifyDirectoryWatcher::Process()
+{
+  std::array<pollfd, 2> fds = {{{m_fd, POLLIN, 0}, {m_wakeupFd, POLLIN, 0}}};
+  alignas(inotify_event) std::array<char, 64 * 1024> buffer;
+
+  while (!m_bStop)
+  {
+    if (poll(fds.data(), fds.size(), -1) < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      CLog::LogF(LOGERROR, "poll failed: {}", strerror(errno));
+      break;
+    }
+
+    if (fds[1].revents)
+      break;
+
+    ssize_t length;
+    while ((length = read(m_fd, buffer.data(), buffer.size())) > 0)
+    {
+      for (const char* ptr = buffer.data(); ptr < buffer.data() + length;)
+      {
+        const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+        HandleEvent(*event);
+        ptr += sizeof(inotify_event) + event->len;
+      }
+    }
+  }
+}
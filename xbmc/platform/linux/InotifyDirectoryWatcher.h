@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/DirectoryWatcher.h"
+#include "threads/CriticalSection.h"
+#include "threads/Thread.h"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+
+struct inotify_event;
+
+/*!
+ \brief Directory watcher based on inotify.
+
+ inotify doesn't watch trees, so every directory below a watched path gets its own watch, and
+ directories created or moved into a watched tree are added as their events arrive.
+ */
+class CInotifyDirectoryWatcher : public XFILE::IDirectoryWatcher, private CThread
+{
+public:
+  explicit CInotifyDirectoryWatcher(XFILE::IDirectoryWatcherCallback& callback);
+  ~CInotifyDirectoryWatcher() override;
+
+  bool IsValid() const { return m_fd >= 0 && m_wakeupFd >= 0; }
+
+  bool AddTree(const std::string& path) override;
+  void RemoveTree(const std::string& path) override;
+
+protected:
+  void Process() override;
+
+private:
+  bool AddWatchesLocked(const std::string& path);
+  bool AddWatchLocked(const std::string& directory);
+  void RemoveWatchesLocked(const std::string& path);
+  void HandleEvent(const inotify_event& event);
+
+  XFILE::IDirectoryWatcherCallback& m_callback;
+
+  int m_fd = -1;
+  int m_wakeupFd = -1;
+  bool m_limitReported = false;
+
+  CCriticalSection m_section;
+  std::unordered_map<int, std::string> m_directories; //!< watch descriptor -> directory
+  std::map<std::string, int> m_watches; //!< directory -> watch descriptor, ordered for subtrees
+};
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "platform/linux/InotifyDirectoryWatcher.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+class CRecordingCallback : public XFILE::IDirectoryWatcherCallback
+{
+public:
+  void OnDirectoryChanged(const std::string& directory) override
+  {
+    std::unique_lock lock(m_mutex);
+    m_changed.insert(directory);
+    m_cond.notify_all();
+  }
+
+  void OnWatchOverflow() override {}
+
+  bool WaitFor(const std::string& directory)
+  {
+    std::unique_lock lock(m_mutex);
+    return m_cond.wait_for(lock, 5s, [&] { return m_changed.contains(directory); });
+  }
+
+  bool Seen(const std::string& directory)
+  {
+    std::unique_lock lock(m_mutex);
+    return m_changed.contains(directory);
+  }
+
+  void Clear()
+  {
+    std::unique_lock lock(m_mutex);
+    m_changed.clear();
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::set<std::string> m_changed;
+};
+
+void WriteFile(const std::filesystem::path& path)
+{
+  std::ofstream file(path);
+  file << "kodi";
+}
+} // namespace
+
+class TestInotifyDirectoryWatcher : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_root = std::filesystem::temp_directory_path() /
+             ("kodi-test-watcher-" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+              "-" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    std::filesystem::remove_all(m_root);
+    std::filesystem::create_directories(m_root / "sub");
+  }
+
+  void TearDown() override { std::filesystem::remove_all(m_root); }
+
+  std::string Dir(const std::filesystem::path& path) const { return path.string() + "/"; }
+
+  std::filesystem::path m_root;
+  CRecordingCallback m_callback;
+};
+
+TEST_F(TestInotifyDirectoryWatcher, ReportsWrittenFiles)
+{
+  CInotifyDirectoryWatcher watcher(m_callback);
+  ASSERT_TRUE(watcher.IsValid());
+  ASSERT_TRUE(watcher.AddTree(Dir(m_root)));
+
+  WriteFile(m_root / "sub" / "movie.mkv");
+  EXPECT_TRUE(m_callback.WaitFor(Dir(m_root / "sub")));
+}
+
+TEST_F(TestInotifyDirectoryWatcher, WatchesNewDirectories)
+{
+  CInotifyDirectoryWatcher watcher(m_callback);
+  ASSERT_TRUE(watcher.AddTree(Dir(m_root)));
+
+  std::filesystem::create_directory(m_root / "new");
+  ASSERT_TRUE(m_callback.WaitFor(Dir(m_root)));
+
+  WriteFile(m_root / "new" / "song.flac");
+  EXPECT_TRUE(m_callback.WaitFor(Dir(m_root / "new")));
+}
+
+TEST_F(TestInotifyDirectoryWatcher, ReportsRemovals)
+{
+  WriteFile(m_root / "sub" / "movie.mkv");
+
+  CInotifyDirectoryWatcher watcher(m_callback);
+  ASSERT_TRUE(watcher.AddTree(Dir(m_root)));
+
+  std::filesystem::remove(m_root / "sub" / "movie.mkv");
+  EXPECT_TRUE(m_callback.WaitFor(Dir(m_root / "sub")));
+
+  std::filesystem::remove(m_root / "sub");
+  EXPECT_TRUE(m_callback.WaitFor(Dir(m_root)));
+}
+
+TEST_F(TestInotifyDirectoryWatcher, RemoveTree)
+{
+  CInotifyDirectoryWatcher watcher(m_callback);
+  ASSERT_TRUE(watcher.AddTree(Dir(m_root)));
+  watcher.RemoveTree(Dir(m_root / "sub"));
+
+  WriteFile(m_root / "sub" / "movie.mkv");
+  WriteFile(m_root / "movie.mkv");
+  ASSERT_TRUE(m_callback.WaitFor(Dir(m_root)));
+  EXPECT_FALSE(m_callback.Seen(Dir(m_root / "sub")));
+}
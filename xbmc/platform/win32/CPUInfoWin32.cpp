@@ -149,6 +149,26 @@ CCPUInfoWin32::CCPUInfoWin32()
       m_cpuFeatures |= CPU_FEATURE_SSE42;
   }
 
+  // AVX registers are only usable if the OS saves them, check that before looking at AVX2/512
+  if (MaxStdInfoType >= CPUID_INFOTYPE_STRUCTURED_EXTENDED)
+  {
+    __cpuid(CPUInfo, CPUID_INFOTYPE_STANDARD);
+    if ((CPUInfo[CPUINFO_ECX] & CPUID_00000001_ECX_OSXSAVE) &&
+        (CPUInfo[CPUINFO_ECX] & CPUID_00000001_ECX_AVX))
+    {
+      const uint64_t xcr0 = _xgetbv(0);
+      if ((xcr0 & XCR0_AVX_STATE) == XCR0_AVX_STATE)
+      {
+        __cpuidex(CPUInfo, CPUID_INFOTYPE_STRUCTURED_EXTENDED, 0);
+        if (CPUInfo[CPUINFO_EBX] & CPUID_00000007_EBX_AVX2)
+          m_cpuFeatures |= CPU_FEATURE_AVX2;
+        if ((CPUInfo[CPUINFO_EBX] & CPUID_00000007_EBX_AVX512F) &&
+            (xcr0 & XCR0_AVX512_STATE) == XCR0_AVX512_STATE)
+          m_cpuFeatures |= CPU_FEATURE_AVX512;
+      }
+    }
+  }
+
   __cpuid(CPUInfo, CPUID_INFOTYPE_EXTENDED_IMPLEMENTED);
   if (CPUInfo[0] >= CPUID_INFOTYPE_EXTENDED)
   {
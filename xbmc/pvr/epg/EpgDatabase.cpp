@@ -9,6 +9,7 @@
 #include "EpgDatabase.h"
 
 #include "ServiceBroker.h"
+#include "dbwrappers/FullTextIndex.h"
 #include "dbwrappers/dataset.h"
 #include "pvr/epg/Epg.h"
 #include "pvr/epg/EpgInfoTag.h"
@@ -29,10 +30,31 @@
 using namespace dbiplus;
 using namespace PVR;
 
+namespace
+{
+const CFullTextIndex& GetSearchIndex()
+{
+  static const CFullTextIndex index{"epgtags",
+                                    "idBroadcast",
+                                    {"sTitle", "sPlotOutline", "sPlot"},
+                                    CFullTextIndex::Tokenizer::TRIGRAM};
+  return index;
+}
+} // unnamed namespace
+
 bool CPVREpgDatabase::Open()
 {
   std::unique_lock lock(m_critSection);
-  return CDatabase::Open(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg);
+  const bool connect = !IsOpen();
+  if (!CDatabase::Open(
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg))
+    return false;
+
+  // tags are persisted with REPLACE, whose deletes only reach the search index triggers this way
+  if (connect && m_sqlite)
+    ExecuteQuery("PRAGMA recursive_triggers = ON");
+
+  return true;
 }
 
 void CPVREpgDatabase::Close()
@@ -146,6 +168,7 @@ void CPVREpgDatabase::CreateAnalytics()
   std::unique_lock lock(m_critSection);
   m_pDS->exec("CREATE UNIQUE INDEX idx_epg_idEpg_iStartTime on epgtags(idEpg, iStartTime desc);");
   m_pDS->exec("CREATE INDEX idx_epg_iEndTime on epgtags(iEndTime);");
+  CreateFullTextIndex(GetSearchIndex());
 }
 
 void CPVREpgDatabase::UpdateTables(int iVersion)
@@ -600,6 +623,39 @@ public:
     return result;
   }
 
+  /*!
+   * @brief Get a search index query for a superset of the rows matched by ToSQL.
+   * @param bSearchInDescription Whether the plot is searched as well.
+   * @return The query or an empty string if the index can't narrow down the search.
+   */
+  std::string ToFullTextQuery(bool bSearchInDescription) const
+  {
+    std::string query;
+    for (const auto& group : m_fullTextGroups)
+    {
+      // only negated or short terms, which match rows the index can't find
+      if (group.empty())
+        return {};
+
+      std::vector<std::string> phrases;
+      phrases.reserve(group.size());
+      for (const auto& term : group)
+        phrases.emplace_back(CFullTextIndex::Phrase(term));
+
+      if (!query.empty())
+        query += " OR ";
+      query += "(" + StringUtils::Join(phrases, " AND ") + ")";
+    }
+
+    if (query.empty())
+      return {};
+
+    if (bSearchInDescription)
+      return CFullTextIndex::ColumnFilter({"sTitle", "sPlotOutline", "sPlot"}, query);
+
+    return CFullTextIndex::ColumnFilter({"sTitle", "sPlotOutline"}, query);
+  }
+
 private:
   void Parse(const std::string& strSearchTerm)
   {
@@ -609,6 +665,8 @@ private:
     std::string strFragment;
 
     bool bNextOR = false;
+    bool bNextAND = false;
+    bool bNextNOT = false;
     while (!strParsedSearchTerm.empty())
     {
       StringUtils::TrimLeft(strParsedSearchTerm);
@@ -620,6 +678,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " NOT ";
         bNextOR = false;
+        bNextNOT = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "+") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "and"))
@@ -628,6 +687,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " AND ";
         bNextOR = false;
+        bNextAND = true;
       }
       else if (StringUtils::StartsWith(strParsedSearchTerm, "|") ||
                StringUtils::StartsWithNoCase(strParsedSearchTerm, "or"))
@@ -636,6 +696,7 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strDummy);
         strFragment += " OR ";
         bNextOR = false;
+        bNextAND = false;
       }
       else
       {
@@ -643,6 +704,15 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strTerm);
         if (!strTerm.empty())
         {
+          // AND binds tighter than OR, so the index query is an OR of AND groups. Negated and
+          // short terms are left out of their group, which only widens the match.
+          if (m_fullTextGroups.empty() || !bNextAND)
+            m_fullTextGroups.emplace_back();
+          if (!bNextNOT && CFullTextIndex::CanSearch(strTerm, CFullTextIndex::Tokenizer::TRIGRAM))
+            m_fullTextGroups.back().emplace_back(strTerm);
+          bNextAND = false;
+          bNextNOT = false;
+
           if (bNextOR && !m_fragments.empty())
             strFragment += " OR "; // default operator
 
@@ -695,6 +765,7 @@ private:
   }
 
   std::vector<std::string> m_fragments;
+  std::vector<std::vector<std::string>> m_fullTextGroups;
 };
 
 } // unnamed namespace
@@ -805,6 +876,10 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
   const CSearchTermConverter conv{searchData.m_strSearchTerm};
   if (conv.HasSearchTerm())
   {
+    const std::string strFullTextQuery = conv.ToFullTextQuery(searchData.m_bSearchInDescription);
+    if (!strFullTextQuery.empty() && HasFullTextIndex(GetSearchIndex()))
+      filter.AppendWhere(GetSearchIndex().Match("idBroadcast", strFullTextQuery));
+
     // title
     std::string strWhere = conv.ToSQL("sTitle");
 
@@ -17,12 +17,17 @@
 #include "pvr/epg/EpgChannelData.h"
 #include "pvr/epg/EpgContainer.h"
 #include "pvr/epg/EpgInfoTag.h"
+#include "threads/CriticalSection.h"
+#include "utils/JobManager.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 using namespace PVR;
@@ -52,8 +57,8 @@ std::shared_ptr<CFileItem> CGUIEPGGridContainerModel::CreateGapItem(int iChannel
   return std::make_shared<CFileItem>(gapTag);
 }
 
-std::vector<std::shared_ptr<CPVREpgInfoTag>> CGUIEPGGridContainerModel::GetEPGTimeline(
-    int iChannel, const CDateTime& minEventEnd, const CDateTime& maxEventStart) const
+std::pair<CDateTime, CDateTime> CGUIEPGGridContainerModel::GetEPGTimelineBounds(
+    const CDateTime& minEventEnd, const CDateTime& maxEventStart) const
 {
   CDateTime min =
       minEventEnd - CDateTimeSpan(0, 0, m_minutesPerBlock, 0) + CDateTimeSpan(0, 0, 0, 1);
@@ -65,6 +70,13 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CGUIEPGGridContainerModel::GetEPGTi
   if (max > m_gridEnd)
     max = m_gridEnd;
 
+  return {min, max};
+}
+
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CGUIEPGGridContainerModel::GetEPGTimeline(
+    int iChannel, const CDateTime& minEventEnd, const CDateTime& maxEventStart) const
+{
+  const auto [min, max] = GetEPGTimelineBounds(minEventEnd, maxEventStart);
   return m_channelItems[iChannel]->GetPVRChannelInfoTag()->GetEPGTimeline(m_gridStart, m_gridEnd,
                                                                           min, max);
 }
@@ -86,6 +98,8 @@ void CGUIEPGGridContainerModel::Initialize(const CFileItemList& items,
   }
 
   m_fBlockSize = fBlockSize;
+  m_channelsPerPage = iChannelsPerPage;
+  m_blocksPerPage = iBlocksPerPage;
 
   ////////////////////////////////////////////////////////////////////////
   // Create channel items
@@ -518,70 +532,218 @@ bool CGUIEPGGridContainerModel::FreeProgrammeMemory(int firstChannel,
   // clear the grid. it will be recreated on-demand.
   m_gridIndex.clear();
 
-  bool newChannels = false;
+  // keep the epg tags of one page around the active area, so that scrolling does not refetch them
+  const int keepFirstChannel = firstChannel - m_channelsPerPage;
+  const int keepLastChannel = lastChannel + m_channelsPerPage;
+  const int keepFirstBlock = firstBlock - m_blocksPerPage;
+  const int keepLastBlock = lastBlock + m_blocksPerPage;
 
-  if (channelsChanged)
+  MergePrefetchedEpgTags(keepFirstChannel, keepLastChannel);
+
+  // purge epg tags outside of the kept area
+  for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
   {
-    // purge epg tags for inactive channels
-    for (auto it = m_epgItems.begin(); it != m_epgItems.end();)
+    if ((*it).first < keepFirstChannel || (*it).first > keepLastChannel ||
+        !TrimEpgTags((*it).second, keepFirstBlock, keepLastBlock))
     {
-      if ((*it).first < firstChannel || (*it).first > lastChannel)
-      {
-        it = m_epgItems.erase(it);
-        continue; // next channel
-      }
-      ++it;
+      it = m_epgItems.erase(it);
+      continue; // next channel
     }
-
-    newChannels = (firstChannel < m_firstActiveChannel) || (lastChannel > m_lastActiveChannel);
+    ++it;
   }
 
-  if (blocksChanged || newChannels)
+  // fetch epg tags still missing for the active area. it can't wait for the prefetch.
+  const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
+  const CDateTime minStart = GetStartTimeForBlock(lastBlock);
+  for (int i = firstChannel; i <= lastChannel; ++i)
   {
-    // clear and refetch epg tags for active channels
-    const CDateTime maxEnd = GetStartTimeForBlock(firstBlock);
-    const CDateTime minStart = GetStartTimeForBlock(lastBlock);
-    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
-    for (int i = firstChannel; i <= lastChannel; ++i)
+    auto it = m_epgItems.find(i);
+    if (it == m_epgItems.end())
     {
-      auto it = m_epgItems.find(i);
-      if (it == m_epgItems.end())
-        it = m_epgItems.try_emplace(i).first;
+      it = m_epgItems.try_emplace(i).first;
+      AssignEpgTags((*it).second, GetEPGTimeline(i, maxEnd, minStart));
+      continue; // next channel
+    }
 
-      if (blocksChanged || i < m_firstActiveChannel || i > m_lastActiveChannel)
-      {
-        EpgTags& epgTags = (*it).second;
+    EpgTags& epgTags = (*it).second;
+    if (firstBlock < epgTags.firstBlock)
+      GetEpgTagsBefore(epgTags, i, firstBlock);
+    if (lastBlock > epgTags.lastBlock)
+      GetEpgTagsAfter(epgTags, i, lastBlock);
+  }
 
-        (*it).second.tags.clear();
+  m_firstActiveChannel = firstChannel;
+  m_lastActiveChannel = lastChannel;
+  m_firstActiveBlock = firstBlock;
+  m_lastActiveBlock = lastBlock;
 
-        tags = GetEPGTimeline(i, maxEnd, minStart);
-        const int firstResultBlock = GetFirstEventBlock(tags.front());
-        const int lastResultBlock = GetLastEventBlock(tags.back());
-        if (firstResultBlock > lastResultBlock)
-          continue;
+  PrefetchEpgTags(keepFirstChannel, keepLastChannel, keepFirstBlock, keepLastBlock);
 
-        epgTags.firstBlock = firstResultBlock;
-        epgTags.lastBlock = lastResultBlock;
+  return true;
+}
 
-        for (const auto& tag : tags)
-        {
-          if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
-            continue;
+bool CGUIEPGGridContainerModel::AssignEpgTags(
+    EpgTags& epgTags, const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const
+{
+  epgTags.tags.clear();
 
-          epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
-        }
-      }
-    }
+  const int firstResultBlock = GetFirstEventBlock(tags.front());
+  const int lastResultBlock = GetLastEventBlock(tags.back());
+  if (firstResultBlock > lastResultBlock)
+    return false;
+
+  epgTags.firstBlock = firstResultBlock;
+  epgTags.lastBlock = lastResultBlock;
+
+  for (const auto& tag : tags)
+  {
+    if (GetFirstEventBlock(tag) > GetLastEventBlock(tag))
+      continue;
+
+    epgTags.tags.emplace_back(std::make_shared<CFileItem>(tag));
   }
+  return true;
+}
 
-  m_firstActiveChannel = firstChannel;
-  m_lastActiveChannel = lastChannel;
-  m_firstActiveBlock = firstBlock;
-  m_lastActiveBlock = lastBlock;
+bool CGUIEPGGridContainerModel::TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const
+{
+  auto& tags = epgTags.tags;
+
+  const auto first = std::ranges::find_if(
+      tags, [this, firstBlock](const auto& item)
+      { return GetLastEventBlock(item->GetEPGInfoTag()) >= firstBlock; });
+  const auto last = std::find_if(first, tags.end(),
+                                 [this, lastBlock](const auto& item)
+                                 { return GetFirstEventBlock(item->GetEPGInfoTag()) > lastBlock; });
+  if (first == last)
+    return false;
+
+  const bool trimFront = (first != tags.begin());
+  const bool trimBack = (last != tags.end());
+  tags.erase(last, tags.end());
+  tags.erase(tags.begin(), first);
+
+  if (trimFront)
+    epgTags.firstBlock = GetFirstEventBlock(tags.front()->GetEPGInfoTag());
+  if (trimBack)
+    epgTags.lastBlock = GetLastEventBlock(tags.back()->GetEPGInfoTag());
 
   return true;
 }
 
+void CGUIEPGGridContainerModel::MergePrefetchedEpgTags(int firstChannel, int lastChannel)
+{
+  for (const auto& result : m_prefetcher.TakeResults())
+  {
+    if (result.channel < firstChannel || result.channel > lastChannel)
+      continue;
+
+    EpgTags epgTags;
+    if (!AssignEpgTags(epgTags, result.tags))
+      continue;
+
+    // only replace tags covering less than the prefetched ones
+    const auto it = m_epgItems.find(result.channel);
+    if (it == m_epgItems.end())
+      m_epgItems.try_emplace(result.channel, std::move(epgTags));
+    else if (epgTags.firstBlock <= (*it).second.firstBlock &&
+             epgTags.lastBlock >= (*it).second.lastBlock)
+      (*it).second = std::move(epgTags);
+  }
+}
+
+void CGUIEPGGridContainerModel::PrefetchEpgTags(int firstChannel,
+                                                int lastChannel,
+                                                int firstBlock,
+                                                int lastBlock)
+{
+  if (m_prefetcher.IsBusy())
+    return; // picked up by the next call
+
+  firstChannel = std::max(firstChannel, 0);
+  lastChannel = std::min(lastChannel, GetLastChannel());
+  firstBlock = std::max(firstBlock, 0);
+  lastBlock = std::min(lastBlock, GetLastBlock());
+
+  const auto [minEventEnd, maxEventStart] =
+      GetEPGTimelineBounds(GetStartTimeForBlock(firstBlock), GetStartTimeForBlock(lastBlock));
+
+  std::vector<CPrefetcher::Request> requests;
+  for (int i = firstChannel; i <= lastChannel; ++i)
+  {
+    const auto it = m_epgItems.find(i);
+    if (it != m_epgItems.end() && (*it).second.firstBlock <= firstBlock &&
+        (*it).second.lastBlock >= lastBlock)
+      continue; // already covered
+
+    requests.emplace_back(CPrefetcher::Request{i, m_channelItems[i]->GetPVRChannelInfoTag(),
+                                               minEventEnd, maxEventStart});
+  }
+
+  if (!requests.empty())
+    m_prefetcher.Submit(std::move(requests), m_gridStart, m_gridEnd);
+}
+
+struct CGUIEPGGridContainerModel::CPrefetcher::State
+{
+  mutable CCriticalSection m_critSection;
+  std::vector<Result> m_results;
+  bool m_busy{false};
+  std::atomic<bool> m_cancelled{false};
+};
+
+CGUIEPGGridContainerModel::CPrefetcher::CPrefetcher() : m_state(std::make_shared<State>())
+{
+}
+
+CGUIEPGGridContainerModel::CPrefetcher::~CPrefetcher()
+{
+  m_state->m_cancelled = true;
+}
+
+bool CGUIEPGGridContainerModel::CPrefetcher::IsBusy() const
+{
+  std::unique_lock lock(m_state->m_critSection);
+  return m_state->m_busy;
+}
+
+void CGUIEPGGridContainerModel::CPrefetcher::Submit(std::vector<Request> requests,
+                                                    const CDateTime& gridStart,
+                                                    const CDateTime& gridEnd)
+{
+  {
+    std::unique_lock lock(m_state->m_critSection);
+    m_state->m_busy = true;
+  }
+
+  CServiceBroker::GetJobManager()->Submit(
+      [state = m_state, requests = std::move(requests), gridStart, gridEnd]
+      {
+        for (const auto& request : requests)
+        {
+          if (state->m_cancelled)
+            break;
+
+          auto tags = request.channelTag->GetEPGTimeline(gridStart, gridEnd, request.minEventEnd,
+                                                         request.maxEventStart);
+
+          std::unique_lock lock(state->m_critSection);
+          state->m_results.emplace_back(Result{request.channel, std::move(tags)});
+        }
+
+        std::unique_lock lock(state->m_critSection);
+        state->m_busy = false;
+      },
+      CJob::PRIORITY_NORMAL);
+}
+
+std::vector<CGUIEPGGridContainerModel::CPrefetcher::Result> CGUIEPGGridContainerModel::
+    CPrefetcher::TakeResults()
+{
+  std::unique_lock lock(m_state->m_critSection);
+  return std::exchange(m_state->m_results, {});
+}
+
 void CGUIEPGGridContainerModel::FreeRulerMemory(int keepStart, int keepEnd)
 {
   if (keepStart < keepEnd)
@@ -712,9 +874,14 @@ std::unique_ptr<CFileItemList> CGUIEPGGridContainerModel::GetCurrentTimeLineItem
     const auto itEpg = m_epgItems.find(channel);
     if (itEpg != m_epgItems.end())
     {
-      // tags are sorted, so we can iterate and append
+      // tags are sorted, so we can iterate and append. skip the ones kept around the active area.
       for (const auto& tag : (*itEpg).second.tags)
       {
+        const std::shared_ptr<const CPVREpgInfoTag> epgTag = tag->GetEPGInfoTag();
+        if (GetLastEventBlock(epgTag) < m_firstActiveBlock ||
+            GetFirstEventBlock(epgTag) > m_lastActiveBlock)
+          continue;
+
         tag->SetProperty("TimelineIndex", i);
         items->Add(tag);
         ++i;
@@ -41,6 +41,7 @@ struct GridItem
   int endBlock = 0;
 };
 
+class CPVRChannel;
 class CPVREpgInfoTag;
 
 class CGUIEPGGridContainerModel
@@ -68,6 +69,15 @@ public:
                                 int& newBlockIndex) const;
 
   void FreeChannelMemory(int keepStart, int keepEnd);
+
+  /*!
+   * \brief Move the active area of the grid to the given channels and blocks.
+   *
+   * EPG tags are kept for one page of channels and blocks around the active area. Tags missing
+   * in the active area are fetched right away, the ones for the rest of the page around it are
+   * fetched by a background job and picked up with the next call.
+   * \return True if the active area changed, false otherwise.
+   */
   bool FreeProgrammeMemory(int firstChannel, int lastChannel, int firstBlock, int lastBlock);
   void FreeRulerMemory(int keepStart, int keepEnd);
 
@@ -116,6 +126,8 @@ private:
   std::shared_ptr<CFileItem> CreateGapItem(int iChannel) const;
   std::shared_ptr<CFileItem> GetItem(int iChannel, int iBlock) const;
 
+  std::pair<CDateTime, CDateTime> GetEPGTimelineBounds(const CDateTime& minEventEnd,
+                                                       const CDateTime& maxEventStart) const;
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEPGTimeline(int iChannel,
                                                               const CDateTime& minEventEnd,
                                                               const CDateTime& maxEventStart) const;
@@ -135,8 +147,54 @@ private:
                                         int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsBefore(EpgTags& epgTags, int iChannel, int iBlock) const;
   std::shared_ptr<CFileItem> GetEpgTagsAfter(EpgTags& epgTags, int iChannel, int iBlock) const;
+  bool AssignEpgTags(EpgTags& epgTags,
+                     const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const;
+  bool TrimEpgTags(EpgTags& epgTags, int firstBlock, int lastBlock) const;
+
+  void MergePrefetchedEpgTags(int firstChannel, int lastChannel);
+  void PrefetchEpgTags(int firstChannel, int lastChannel, int firstBlock, int lastBlock);
+
+  /*!
+   * \brief Fetches EPG timelines of channels on a background job.
+   *
+   * The job only queries the EPG, CFileItems are created by the model on the GUI thread. Copies
+   * start without a job in flight and results of a destroyed prefetcher are dropped.
+   */
+  class CPrefetcher
+  {
+  public:
+    struct Request
+    {
+      int channel = 0;
+      std::shared_ptr<const CPVRChannel> channelTag;
+      CDateTime minEventEnd;
+      CDateTime maxEventStart;
+    };
+
+    struct Result
+    {
+      int channel = 0;
+      std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+    };
+
+    CPrefetcher();
+    CPrefetcher(const CPrefetcher& other) : CPrefetcher() {}
+    CPrefetcher& operator=(const CPrefetcher& other) = delete;
+    ~CPrefetcher();
+
+    bool IsBusy() const;
+    void Submit(std::vector<Request> requests,
+                const CDateTime& gridStart,
+                const CDateTime& gridEnd);
+    std::vector<Result> TakeResults();
+
+  private:
+    struct State;
+    std::shared_ptr<State> m_state;
+  };
 
   mutable EpgTagsMap m_epgItems;
+  CPrefetcher m_prefetcher;
 
   CDateTime m_gridStart;
   CDateTime m_gridEnd;
@@ -167,6 +225,8 @@ private:
   int m_blocks = 0;
   const unsigned int m_minutesPerBlock{0};
   float m_fBlockSize = 0.0f;
+  int m_channelsPerPage = 0;
+  int m_blocksPerPage = 0;
 
   int m_firstActiveChannel = 0;
   int m_lastActiveChannel = 0;
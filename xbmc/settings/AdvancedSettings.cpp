@@ -437,6 +437,9 @@ void CAdvancedSettings::Initialize()
   m_stereoscopicregex_tab = "[-. _]h?tab[-. _]";
 
   m_logLevelHint = m_logLevel = LOG_LEVEL_NORMAL;
+  m_logAsync = false;
+  m_logQueueSize = 8192;
+  m_logOverflowPolicy = LogOverflowPolicy::DROP;
 
   m_openGlDebugging = false;
 
@@ -460,6 +463,8 @@ bool CAdvancedSettings::Load(const CProfileManager &profileManager)
 
   ParseSettingsFile(profileManager.GetUserDataItem("advancedsettings.xml"));
 
+  CServiceBroker::GetLogging().SetAsync(m_logAsync, m_logQueueSize, m_logOverflowPolicy);
+
   // Add the list of disc stub extensions (if any) to the list of video extensions
   if (!m_discStubExtensions.empty())
     m_videoExtensions += "|" + m_discStubExtensions;
@@ -797,6 +802,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
+    XMLUtils::GetUInt(pElement, "tagreaderthreads", m_musicLibraryTagReaderThreads, 0, 16);
+    XMLUtils::GetBoolean(pElement, "watchsources", m_musicLibraryWatchSources);
     //Music artist name separators
     TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
     if (separators)
@@ -819,6 +826,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetBoolean(pElement, "watchsources", m_videoLibraryWatchSources);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
@@ -832,6 +840,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (pElement)
   {
     XMLUtils::GetBoolean(pElement, "ignoreerrors", m_bVideoScannerIgnoreErrors);
+    XMLUtils::GetUInt(pElement, "iothreads", m_videoScannerIOThreads, 0, 16);
+    XMLUtils::GetUInt(pElement, "probethreads", m_videoScannerProbeThreads, 0, 16);
+    XMLUtils::GetUInt(pElement, "thumbthreads", m_videoScannerThumbThreads, 0, 16);
   }
 
   // Backward-compatibility of ExternalPlayer config
@@ -901,6 +912,20 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     CServiceBroker::GetLogging().SetLogLevel(m_logLevel);
   }
 
+  pElement = pRootElement->FirstChildElement("logging");
+  if (pElement)
+  {
+    // write the log file on a thread of its own, messages logged while the queue of messages to
+    // write is full are either dropped or wait
+    XMLUtils::GetBoolean(pElement, "async", m_logAsync);
+    XMLUtils::GetInt(pElement, "queuesize", m_logQueueSize, 64, 1048576);
+    std::string overflow;
+    if (XMLUtils::GetString(pElement, "overflow", overflow))
+      m_logOverflowPolicy = StringUtils::EqualsNoCase(overflow, "block")
+                                ? LogOverflowPolicy::BLOCK
+                                : LogOverflowPolicy::DROP;
+  }
+
   XMLUtils::GetString(pRootElement, "cddbaddress", m_cddbAddress);
   XMLUtils::GetBoolean(pRootElement, "addsourceontop", m_addSourceOnTop);
 
@@ -1164,6 +1189,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseVideo.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseVideo.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseVideo.compression);
+    XMLUtils::GetBoolean(pDatabase, "walmode", m_databaseVideo.walmode);
+    XMLUtils::GetUInt(pDatabase, "readconnections", m_databaseVideo.readconnections, 0, 8);
   }
 
   pDatabase = pRootElement->FirstChildElement("musicdatabase");
@@ -1182,6 +1209,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseMusic.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseMusic.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseMusic.compression);
+    XMLUtils::GetBoolean(pDatabase, "walmode", m_databaseMusic.walmode);
+    XMLUtils::GetUInt(pDatabase, "readconnections", m_databaseMusic.readconnections, 0, 8);
   }
 
   pDatabase = pRootElement->FirstChildElement("tvdatabase");
@@ -1200,6 +1229,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseTV.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseTV.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseTV.compression);
+    XMLUtils::GetBoolean(pDatabase, "walmode", m_databaseTV.walmode);
+    XMLUtils::GetUInt(pDatabase, "readconnections", m_databaseTV.readconnections, 0, 8);
   }
 
   pDatabase = pRootElement->FirstChildElement("epgdatabase");
@@ -1218,6 +1249,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetString(pDatabase, "ciphers", m_databaseEpg.ciphers);
     XMLUtils::GetUInt(pDatabase, "connecttimeout", m_databaseEpg.connecttimeout, 1, 300);
     XMLUtils::GetBoolean(pDatabase, "compression", m_databaseEpg.compression);
+    XMLUtils::GetBoolean(pDatabase, "walmode", m_databaseEpg.walmode);
+    XMLUtils::GetUInt(pDatabase, "readconnections", m_databaseEpg.readconnections, 0, 8);
   }
 
   pElement = pRootElement->FirstChildElement("enablemultimediakeys");
@@ -1236,6 +1269,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "fronttobackrendering", m_guiFrontToBackRendering);
     XMLUtils::GetBoolean(pElement, "geometryclear", m_guiGeometryClear);
     XMLUtils::GetBoolean(pElement, "asynctextureupload", m_guiAsyncTextureUpload);
+    XMLUtils::GetInt(pElement, "textureuploadbudget", m_guiTextureUploadBudget, 0, 100);
     XMLUtils::GetBoolean(pElement, "transparentvideolayout", m_guiVideoLayoutTransparent);
   }
 
@@ -13,6 +13,7 @@
 #include "settings/lib/ISettingCallback.h"
 #include "settings/lib/ISettingsHandler.h"
 #include "utils/SortUtils.h"
+#include "utils/logtypes.h"
 
 #include <cstdint>
 #include <string>
@@ -34,6 +35,7 @@ class DatabaseSettings
 {
 public:
   static constexpr unsigned int DEFAULT_CONNECT_TIMEOUT = 5; // secs
+  static constexpr unsigned int DEFAULT_READ_CONNECTIONS = 2;
 
   DatabaseSettings() { Reset(); }
   void Reset()
@@ -51,6 +53,8 @@ public:
     ciphers.clear();
     connecttimeout = DEFAULT_CONNECT_TIMEOUT;
     compression = false;
+    walmode = false;
+    readconnections = DEFAULT_READ_CONNECTIONS;
   };
   std::string type;
   std::string host;
@@ -65,6 +69,8 @@ public:
   std::string ciphers;
   unsigned int connecttimeout{DEFAULT_CONNECT_TIMEOUT};
   bool compression;
+  bool walmode; // sqlite only, write-ahead logging so readers don't wait for the writer
+  unsigned int readconnections{DEFAULT_READ_CONNECTIONS}; // pooled readers in wal mode
 };
 
 struct TVShowRegexp
@@ -188,6 +194,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_songInfoDuration;
     int m_logLevel;
     int m_logLevelHint;
+    bool m_logAsync;
+    int m_logQueueSize;
+    LogOverflowPolicy m_logOverflowPolicy;
     std::string m_cddbAddress;
     bool m_addSourceOnTop; //!< True to put 'add source' buttons on top
 
@@ -255,6 +264,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
     bool m_bMusicLibraryArtistNavigatesToSongs;
+    unsigned int m_musicLibraryTagReaderThreads{0}; //!< 0 reads tags on the scanner thread
+    bool m_musicLibraryWatchSources{false};
     std::string m_strMusicLibraryAlbumFormat;
     bool m_prioritiseAPEv2tags;
     std::string m_musicItemSeparator;
@@ -268,8 +279,12 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bVideoLibraryUseFastHash;
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
+    bool m_videoLibraryWatchSources{false};
 
     bool m_bVideoScannerIgnoreErrors;
+    unsigned int m_videoScannerIOThreads{0}; //!< 0 lists and hashes folders on the scanner thread
+    unsigned int m_videoScannerProbeThreads{0}; //!< 0 probes stream details on the scanner thread
+    unsigned int m_videoScannerThumbThreads{0}; //!< 0 extracts thumbs on the texture cache queue
     int m_iVideoLibraryDateAdded;
 
     bool m_caseSensitiveLocalArtMatch{true};
@@ -348,6 +363,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiFrontToBackRendering{false};
     bool m_guiGeometryClear{true};
     bool m_guiAsyncTextureUpload{false};
+    int m_guiTextureUploadBudget{4}; ///< \brief image upload ms per frame, 0 = on first draw
     bool m_guiVideoLayoutTransparent{false};
 
     unsigned int m_addonPackageFolderSize;
@@ -45,6 +45,7 @@ void CreateUserDirs()
   XFILE::CDirectory::Create("special://temp/");
   XFILE::CDirectory::Create("special://logpath");
   XFILE::CDirectory::Create("special://temp/temp"); // temp directory for python and dllGetTempPathA
+  XFILE::CDirectory::Create("special://temp/skin_cache");
 
   //Let's clear our archive cache before starting up anything more
   const std::string archiveCachePath =
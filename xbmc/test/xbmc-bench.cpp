@@ -0,0 +1,28 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TestBasicEnvironment.h"
+#include "TestUtils.h"
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv)
+{
+  // strips the --benchmark_* arguments, the rest is for the test environment
+  benchmark::Initialize(&argc, argv);
+  CXBMCTestUtils::Instance().ParseArgs(argc, argv);
+
+  TestBasicEnvironment environment;
+  environment.SetUp();
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  environment.TearDown();
+  return 0;
+}
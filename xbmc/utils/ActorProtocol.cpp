@@ -8,13 +8,60 @@
 
 #include "ActorProtocol.h"
 
-#include "threads/Event.h"
-
 #include <cstring>
+#include <iterator>
 #include <mutex>
+#include <new>
 
 using namespace Actor;
 
+namespace
+{
+struct PayloadBlock
+{
+  PayloadBlock* next;
+};
+
+// payloads up to 64, 128 and 256 bytes are pooled, larger ones are rare
+constexpr size_t PAYLOAD_BLOCK_SIZES[] = {64, 128, 256};
+CLockFreeStack<PayloadBlock> payloadPool[std::size(PAYLOAD_BLOCK_SIZES)];
+
+int PayloadSizeClass(size_t size)
+{
+  for (size_t i = 0; i < std::size(PAYLOAD_BLOCK_SIZES); ++i)
+  {
+    if (size <= PAYLOAD_BLOCK_SIZES[i])
+      return static_cast<int>(i);
+  }
+  return -1;
+}
+} // namespace
+
+void* CPayloadWrapBase::operator new(size_t size)
+{
+  const int sizeClass = PayloadSizeClass(size);
+  if (sizeClass < 0)
+    return ::operator new(size);
+
+  if (PayloadBlock* block = payloadPool[sizeClass].TryPop())
+    return block;
+  return ::operator new(PAYLOAD_BLOCK_SIZES[sizeClass]);
+}
+
+void CPayloadWrapBase::operator delete(void* ptr, size_t size)
+{
+  if (!ptr)
+    return;
+
+  // blocks are kept for the lifetime of the process, the pool only grows to the peak of
+  // payloads in flight at once
+  const int sizeClass = PayloadSizeClass(size);
+  if (sizeClass < 0)
+    ::operator delete(ptr);
+  else
+    payloadPool[sizeClass].Push(new (ptr) PayloadBlock);
+}
+
 void Message::Release()
 {
   bool skip;
@@ -32,9 +79,6 @@ void Message::Release()
 
   payloadObj.reset();
 
-  // delete event in case of sync message
-  delete event;
-
   origin.ReturnMessage(this);
 }
 
@@ -74,30 +118,84 @@ bool Message::Reply(int sig, void *data /* = NULL*/, size_t size /* = 0 */)
   return true;
 }
 
-Protocol::~Protocol()
+void Protocol::MessageQueue::Collect()
 {
-  Message *msg;
-  Purge();
-  while (!freeMessageQueue.empty())
+  // the pending stack has the newest message first, reverse it and append
+  Message* pending = m_pending.PopAll();
+  if (!pending)
+    return;
+
+  Message* tail = pending;
+  Message* reversed = nullptr;
+  while (pending)
   {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
-    delete msg;
+    Message* next = pending->next;
+    pending->next = reversed;
+    reversed = pending;
+    pending = next;
   }
+
+  if (m_tail)
+    m_tail->next = reversed;
+  else
+    m_head = reversed;
+  m_tail = tail;
 }
 
-Message *Protocol::GetMessage()
+Message* Protocol::MessageQueue::Pop()
 {
-  Message *msg;
+  if (!m_head)
+    Collect();
 
-  std::unique_lock lock(criticalSection);
+  Message* msg = m_head;
+  if (msg)
+  {
+    m_head = msg->next;
+    if (!m_head)
+      m_tail = nullptr;
+    msg->next = nullptr;
+  }
+  return msg;
+}
+
+void Protocol::MessageQueue::Remove(int signal, Message*& removed)
+{
+  Collect();
 
-  if (!freeMessageQueue.empty())
+  Message** link = &m_head;
+  m_tail = nullptr;
+  while (Message* msg = *link)
   {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
+    if (msg->signal == signal)
+    {
+      *link = msg->next;
+      msg->next = removed;
+      removed = msg;
+    }
+    else
+    {
+      m_tail = msg;
+      link = &msg->next;
+    }
   }
-  else
+}
+
+Protocol::~Protocol()
+{
+  Purge();
+  Message* msg = freeMessages.PopAll();
+  while (msg)
+  {
+    Message* next = msg->next;
+    delete msg;
+    msg = next;
+  }
+}
+
+Message *Protocol::GetMessage()
+{
+  Message* msg = freeMessages.TryPop();
+  if (!msg)
     msg = new Message(*this);
 
   msg->isSync = false;
@@ -107,15 +205,14 @@ Message *Protocol::GetMessage()
   msg->data = NULL;
   msg->payloadSize = 0;
   msg->replyMessage = NULL;
+  msg->next = nullptr;
 
   return msg;
 }
 
 void Protocol::ReturnMessage(Message *msg)
 {
-  std::unique_lock lock(criticalSection);
-
-  freeMessageQueue.push(msg);
+  freeMessages.Push(msg);
 }
 
 bool Protocol::SendOutMessage(int signal,
@@ -141,10 +238,7 @@ bool Protocol::SendOutMessage(int signal,
     memcpy(msg->data, data, size);
   }
 
-  {
-    std::unique_lock lock(criticalSection);
-    outMessages.push(msg);
-  }
+  outMessages.Push(msg);
   if (containerOutEvent)
     containerOutEvent->Set();
 
@@ -164,10 +258,7 @@ bool Protocol::SendOutMessage(int signal, CPayloadWrapBase *payload, Message *ou
 
   msg->payloadObj.reset(payload);
 
-  {
-    std::unique_lock lock(criticalSection);
-    outMessages.push(msg);
-  }
+  outMessages.Push(msg);
   if (containerOutEvent)
     containerOutEvent->Set();
 
@@ -190,17 +281,14 @@ bool Protocol::SendInMessage(int signal,
 
   if (data)
   {
-    if (size > sizeof(msg->data))
+    if (size > sizeof(msg->buffer))
       msg->data = new uint8_t[size];
     else
       msg->data = msg->buffer;
     memcpy(msg->data, data, size);
   }
 
-  {
-    std::unique_lock lock(criticalSection);
-    inMessages.push(msg);
-  }
+  inMessages.Push(msg);
   if (containerInEvent)
     containerInEvent->Set();
 
@@ -220,10 +308,7 @@ bool Protocol::SendInMessage(int signal, CPayloadWrapBase *payload, Message *out
 
   msg->payloadObj.reset(payload);
 
-  {
-    std::unique_lock lock(criticalSection);
-    inMessages.push(msg);
-  }
+  inMessages.Push(msg);
   if (containerInEvent)
     containerInEvent->Set();
 
@@ -239,7 +324,7 @@ bool Protocol::SendOutMessageSync(int signal,
   Message *msg = GetMessage();
   msg->isOut = true;
   msg->isSync = true;
-  msg->event = new CEvent;
+  msg->event = &msg->syncEvent;
   msg->event->Reset();
   SendOutMessage(signal, data, size, msg);
 
@@ -273,7 +358,7 @@ bool Protocol::SendOutMessageSync(int signal,
   Message *msg = GetMessage();
   msg->isOut = true;
   msg->isSync = true;
-  msg->event = new CEvent;
+  msg->event = &msg->syncEvent;
   msg->event->Reset();
   SendOutMessage(signal, payload, msg);
 
@@ -303,26 +388,24 @@ bool Protocol::ReceiveOutMessage(Message **msg)
 {
   std::unique_lock lock(criticalSection);
 
-  if (outMessages.empty() || outDefered)
+  if (outDefered)
     return false;
 
-  *msg = outMessages.front();
-  outMessages.pop();
+  *msg = outMessages.Pop();
 
-  return true;
+  return *msg != nullptr;
 }
 
 bool Protocol::ReceiveInMessage(Message **msg)
 {
   std::unique_lock lock(criticalSection);
 
-  if (inMessages.empty() || inDefered)
+  if (inDefered)
     return false;
 
-  *msg = inMessages.front();
-  inMessages.pop();
+  *msg = inMessages.Pop();
 
-  return true;
+  return *msg != nullptr;
 }
 
 
@@ -339,44 +422,32 @@ void Protocol::Purge()
 
 void Protocol::PurgeIn(int signal)
 {
-  Message *msg;
-  std::queue<Message*> msgs;
-
-  std::unique_lock lock(criticalSection);
-
-  while (!inMessages.empty())
+  Message* removed = nullptr;
   {
-    msg = inMessages.front();
-    inMessages.pop();
-    if (msg->signal != signal)
-      msgs.push(msg);
+    std::unique_lock lock(criticalSection);
+    inMessages.Remove(signal, removed);
   }
-  while (!msgs.empty())
+
+  while (removed)
   {
-    msg = msgs.front();
-    msgs.pop();
-    inMessages.push(msg);
+    Message* next = removed->next;
+    removed->Release();
+    removed = next;
   }
 }
 
 void Protocol::PurgeOut(int signal)
 {
-  Message *msg;
-  std::queue<Message*> msgs;
-
-  std::unique_lock lock(criticalSection);
-
-  while (!outMessages.empty())
+  Message* removed = nullptr;
   {
-    msg = outMessages.front();
-    outMessages.pop();
-    if (msg->signal != signal)
-      msgs.push(msg);
+    std::unique_lock lock(criticalSection);
+    outMessages.Remove(signal, removed);
   }
-  while (!msgs.empty())
+
+  while (removed)
   {
-    msg = msgs.front();
-    msgs.pop();
-    outMessages.push(msg);
+    Message* next = removed->next;
+    removed->Release();
+    removed = next;
   }
 }
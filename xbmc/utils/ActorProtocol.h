@@ -9,35 +9,93 @@
 #pragma once
 
 #include "threads/CriticalSection.h"
+#include "threads/Event.h"
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
-#include <queue>
+#include <optional>
 #include <string>
 #include <utility>
 
-class CEvent;
-
 namespace Actor
 {
 
+/*!
+ * \brief Payload of a message. Small payloads come from a pool, so sending one does not
+ * hit the heap once the pool is warm.
+ */
 class CPayloadWrapBase
 {
 public:
   virtual ~CPayloadWrapBase() = default;
+
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
 };
 
 template<typename Payload>
 class CPayloadWrap : public CPayloadWrapBase
 {
 public:
-  ~CPayloadWrap() override = default;
-  CPayloadWrap(Payload* data) { m_pPayload.reset(data); }
-  CPayloadWrap(Payload& data) { m_pPayload.reset(new Payload(data)); }
-  Payload* GetPlayload() { return m_pPayload.get(); }
+  ~CPayloadWrap() override
+  {
+    if (!m_storage)
+      delete m_pPayload;
+  }
+  CPayloadWrap(Payload* data) : m_pPayload(data) {}
+  CPayloadWrap(Payload& data) : m_storage(data), m_pPayload(&*m_storage) {}
+  CPayloadWrap(const CPayloadWrap&) = delete;
+  CPayloadWrap& operator=(const CPayloadWrap&) = delete;
+  Payload* GetPlayload() { return m_pPayload; }
 
 protected:
-  std::unique_ptr<Payload> m_pPayload;
+  std::optional<Payload> m_storage; // copies are kept in place
+  Payload* m_pPayload;
+};
+
+/*!
+ * \brief Intrusive LIFO of T linked through T::next.
+ *
+ * Push never blocks. Only one thread at a time may pop, TryPop gives up and returns nullptr if
+ * another one is popping. That also keeps the stack safe from ABA, as a node can't be popped and
+ * pushed again while a pop is in progress.
+ */
+template<typename T>
+class CLockFreeStack
+{
+public:
+  void Push(T* node)
+  {
+    T* head = m_head.load(std::memory_order_relaxed);
+    do
+    {
+      node->next = head;
+    } while (!m_head.compare_exchange_weak(head, node, std::memory_order_release,
+                                           std::memory_order_relaxed));
+  }
+
+  T* TryPop()
+  {
+    if (m_popping.exchange(true, std::memory_order_acquire))
+      return nullptr;
+
+    T* head = m_head.load(std::memory_order_acquire);
+    while (head && !m_head.compare_exchange_weak(head, head->next, std::memory_order_acquire,
+                                                 std::memory_order_acquire))
+    {
+    }
+
+    m_popping.store(false, std::memory_order_release);
+    return head;
+  }
+
+  //! Take all nodes at once, the last pushed first
+  T* PopAll() { return m_head.exchange(nullptr, std::memory_order_acquire); }
+
+private:
+  std::atomic<T*> m_head{nullptr};
+  std::atomic<bool> m_popping{false};
 };
 
 class Protocol;
@@ -61,6 +119,7 @@ public:
   Message *replyMessage = nullptr;
   Protocol &origin;
   CEvent *event = nullptr;
+  Message* next = nullptr; // link in the queue or free list the message is in
 
   void Release();
   bool Reply(int sig, void *data = nullptr, size_t size = 0);
@@ -68,6 +127,8 @@ public:
 private:
   explicit Message(Protocol &_origin) noexcept
     :origin(_origin) {}
+
+  CEvent syncEvent; // event points here for sync messages
 };
 
 class Protocol
@@ -112,11 +173,32 @@ public:
   std::string portName;
 
 protected:
+  /*!
+   * \brief Messages waiting to be received.
+   *
+   * Senders push without taking a lock. The receiving side moves them over into the FIFO
+   * in send order and must hold criticalSection while doing so.
+   */
+  class MessageQueue
+  {
+  public:
+    void Push(Message* msg) { m_pending.Push(msg); }
+    Message* Pop();
+    void Remove(int signal, Message*& removed);
+
+  private:
+    void Collect();
+
+    CLockFreeStack<Message> m_pending;
+    Message* m_head = nullptr;
+    Message* m_tail = nullptr;
+  };
+
   CEvent *containerInEvent, *containerOutEvent;
   CCriticalSection criticalSection;
-  std::queue<Message*> outMessages;
-  std::queue<Message*> inMessages;
-  std::queue<Message*> freeMessageQueue;
+  MessageQueue outMessages;
+  MessageQueue inMessages;
+  CLockFreeStack<Message> freeMessages;
   bool inDefered = false, outDefered = false;
 };
 
@@ -0,0 +1,279 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AsyncLogSink.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <utility>
+
+#include <spdlog/pattern_formatter.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// only a backstop in case a wakeup is missed, logging threads notify the writer thread
+constexpr auto WriterIdleTimeout = 100ms;
+constexpr auto LoggerWaitTimeout = 10ms;
+constexpr int WriterSpinCount = 64;
+} // unnamed namespace
+
+CAsyncLogSink::CAsyncLogSink(std::shared_ptr<spdlog::sinks::sink> target)
+  : m_target(std::move(target))
+{
+  // messages reach the target formatted already
+  m_target->set_formatter(
+      std::make_unique<spdlog::pattern_formatter>("%v", spdlog::pattern_time_type::local, ""));
+}
+
+CAsyncLogSink::~CAsyncLogSink()
+{
+  if (m_thread.joinable())
+    Stop();
+}
+
+void CAsyncLogSink::SetAsync(bool async, size_t queueSize, LogOverflowPolicy policy)
+{
+  // no message is logged while switching
+  std::unique_lock lock(mutex_);
+
+  m_policy = policy;
+
+  const size_t size = std::bit_ceil(std::max<size_t>(queueSize, 2));
+  if (m_thread.joinable() && (!async || size != m_mask + 1))
+    Stop();
+  if (async && !m_thread.joinable())
+    Start(size);
+}
+
+void CAsyncLogSink::sink_it_(const spdlog::details::log_msg& msg)
+{
+  // let the log tell that messages are missing once there's room again
+  const uint64_t dropped = m_dropped;
+  if (dropped != m_reportedDropped)
+  {
+    const std::string report =
+        fmt::format("{} messages were dropped, the log queue was full or not writable",
+                    dropped - m_reportedDropped);
+    if (Emit(spdlog::details::log_msg(msg.time, msg.source, msg.logger_name, spdlog::level::warn,
+                                      report)))
+      m_reportedDropped = dropped;
+  }
+
+  if (Emit(msg))
+    return;
+
+  if (m_policy == LogOverflowPolicy::DROP)
+  {
+    m_dropped++;
+    return;
+  }
+
+  // the message is still formatted in m_buffer
+  {
+    std::unique_lock lock(m_wakeMutex);
+    m_loggerWaiting = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!Push())
+      m_wakeLogger.wait_for(lock, LoggerWaitTimeout);
+    m_loggerWaiting = false;
+  }
+  WakeWriter();
+}
+
+void CAsyncLogSink::flush_()
+{
+  // the writer thread flushes whenever it has caught up
+  if (!m_thread.joinable())
+    m_target->flush();
+}
+
+bool CAsyncLogSink::Emit(const spdlog::details::log_msg& msg)
+{
+  m_buffer.clear();
+  formatter_->format(msg, m_buffer);
+
+  if (!m_thread.joinable())
+  {
+    Write(std::string_view(m_buffer.data(), m_buffer.size()));
+    return true;
+  }
+
+  if (!Push())
+    return false;
+
+  WakeWriter();
+  return true;
+}
+
+bool CAsyncLogSink::Push()
+{
+  // bounded MPMC queue: a slot is free for the push at position pos once its sequence is pos and
+  // holds a message for the pop at position pos once its sequence is pos + 1
+  size_t pos = m_pushPosition.load(std::memory_order_relaxed);
+  Slot* slot;
+  while (true)
+  {
+    slot = &m_slots[pos & m_mask];
+    const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (diff == 0)
+    {
+      if (m_pushPosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+      return false;
+    else
+      pos = m_pushPosition.load(std::memory_order_relaxed);
+  }
+
+  // the slot keeps the capacity of earlier messages
+  slot->message.assign(m_buffer.data(), m_buffer.size());
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+bool CAsyncLogSink::Pop(std::string& message)
+{
+  size_t pos = m_popPosition.load(std::memory_order_relaxed);
+  Slot* slot;
+  while (true)
+  {
+    slot = &m_slots[pos & m_mask];
+    const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+    if (diff == 0)
+    {
+      if (m_popPosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+      return false;
+    else
+      pos = m_popPosition.load(std::memory_order_relaxed);
+  }
+
+  // swapping hands the capacity of the previous message back to the slot
+  message.swap(slot->message);
+  slot->sequence.store(pos + m_mask + 1, std::memory_order_release);
+  return true;
+}
+
+bool CAsyncLogSink::IsEmpty() const
+{
+  const size_t pos = m_popPosition.load(std::memory_order_relaxed);
+  return m_slots[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+}
+
+void CAsyncLogSink::Write(std::string_view message)
+{
+  m_target->log(spdlog::details::log_msg(spdlog::string_view_t(), spdlog::level::info,
+                                         spdlog::string_view_t(message.data(), message.size())));
+}
+
+void CAsyncLogSink::WakeWriter()
+{
+  // pairs with the fence of the writer thread going to sleep
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_writerSleeping)
+  {
+    std::unique_lock lock(m_wakeMutex);
+    m_wakeWriter.notify_one();
+  }
+}
+
+void CAsyncLogSink::Start(size_t size)
+{
+  m_slots = std::make_unique<Slot[]>(size);
+  for (size_t i = 0; i < size; i++)
+    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  m_mask = size - 1;
+  m_pushPosition = 0;
+  m_popPosition = 0;
+  m_stop = false;
+
+  // not a CThread, which logs itself
+  m_thread = std::thread(&CAsyncLogSink::Process, this);
+}
+
+void CAsyncLogSink::Stop()
+{
+  {
+    std::unique_lock lock(m_wakeMutex);
+    m_stop = true;
+    m_wakeWriter.notify_one();
+  }
+  m_thread.join();
+}
+
+void CAsyncLogSink::Process()
+{
+  std::string message;
+  bool flush = false;
+  int idle = 0;
+  while (true)
+  {
+    while (Pop(message))
+    {
+      // a failing target must neither end the writer thread nor leave the logging threads waiting
+      try
+      {
+        Write(message);
+      }
+      catch (...)
+      {
+        m_dropped++;
+      }
+      flush = true;
+      idle = 0;
+
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (m_loggerWaiting)
+      {
+        std::unique_lock lock(m_wakeMutex);
+        m_wakeLogger.notify_all();
+      }
+    }
+
+    // look for messages queued in the meantime before going to sleep
+    if (flush)
+    {
+      try
+      {
+        m_target->flush();
+      }
+      catch (...)
+      {
+      }
+      flush = false;
+      continue;
+    }
+
+    // everything has been written once stopping
+    if (m_stop)
+      break;
+
+    // messages tend to come in bursts, waking the writer thread costs the logging thread a syscall
+    if (++idle < WriterSpinCount)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    idle = 0;
+
+    std::unique_lock lock(m_wakeMutex);
+    m_writerSleeping = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (IsEmpty() && !m_stop)
+      m_wakeWriter.wait_for(lock, WriterIdleTimeout);
+    m_writerSleeping = false;
+  }
+}
@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/logtypes.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <spdlog/sinks/base_sink.h>
+
+/*!
+ * \brief Sink handing the messages it formats to another sink, optionally on a thread of its own.
+ *
+ * Messages are always formatted on the logging thread. In asynchronous mode they are queued in a
+ * bounded lock-free ring and written to the target sink by a writer thread, which flushes the
+ * target whenever it has caught up, so logging threads never wait for the disk. Otherwise they are
+ * written to the target right away.
+ */
+class CAsyncLogSink : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+  explicit CAsyncLogSink(std::shared_ptr<spdlog::sinks::sink> target);
+  ~CAsyncLogSink() override;
+
+  /*!
+   * \brief Switch between writing messages on the writer thread and on the logging thread.
+   *
+   * Messages still queued are written before the writer thread is stopped.
+   * \param async whether to write messages on the writer thread
+   * \param queueSize the number of messages that can be queued, rounded up to a power of two
+   * \param policy what to do with a message once the queue is full
+   */
+  void SetAsync(bool async, size_t queueSize, LogOverflowPolicy policy);
+
+  /*!
+   * \brief Number of messages dropped as the queue was full or the target sink failed to write
+   * them on the writer thread.
+   */
+  uint64_t GetDroppedMessages() const { return m_dropped; }
+
+protected:
+  // implementation of spdlog::sinks::base_sink
+  void sink_it_(const spdlog::details::log_msg& msg) override;
+  void flush_() override;
+
+private:
+  struct Slot
+  {
+    std::atomic<size_t> sequence;
+    std::string message;
+  };
+
+  bool Emit(const spdlog::details::log_msg& msg);
+  bool Push();
+  bool Pop(std::string& message);
+  bool IsEmpty() const;
+  void Write(std::string_view message);
+  void WakeWriter();
+  void Start(size_t size);
+  void Stop();
+  void Process();
+
+  const std::shared_ptr<spdlog::sinks::sink> m_target;
+  spdlog::memory_buf_t m_buffer;
+
+  std::unique_ptr<Slot[]> m_slots;
+  size_t m_mask = 0;
+  alignas(64) std::atomic<size_t> m_pushPosition{0};
+  alignas(64) std::atomic<size_t> m_popPosition{0};
+
+  std::atomic<LogOverflowPolicy> m_policy{LogOverflowPolicy::DROP};
+  std::atomic<uint64_t> m_dropped{0};
+  uint64_t m_reportedDropped = 0;
+
+  std::thread m_thread;
+  std::mutex m_wakeMutex;
+  std::condition_variable m_wakeWriter;
+  std::condition_variable m_wakeLogger;
+  std::atomic<bool> m_writerSleeping{false};
+  std::atomic<bool> m_loggerWaiting{false};
+  std::atomic<bool> m_stop{false};
+};
@@ -18,11 +18,18 @@
 #include "utils/Utf8Utils.h"
 
 #include <algorithm>
+#include <bit>
 #include <mutex>
+#include <string_view>
+#include <type_traits>
 
 #include <fribidi.h>
 #include <iconv.h>
 
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #ifdef WORDS_BIGENDIAN
   #define ENDIAN_SUFFIX "BE"
 #else
@@ -316,6 +323,317 @@ CConverterType CCharsetConverter::CInnerConverter::m_stdConversion[NumberOfStdCo
 
 CCriticalSection CCharsetConverter::CInnerConverter::m_critSectionFriBiDi;
 
+namespace
+{
+/* Conversions between Unicode encodings don't need iconv as long as the source is well-formed.
+   The kernels below give up on anything iconv could treat differently (malformed sequences,
+   surrogates, code points above U+10FFFF) and the conversion is then made by iconv. */
+
+#if defined(WCHAR_IS_UTF16)
+constexpr bool WCharIsUnicode = sizeof(wchar_t) == 2;
+#elif defined(WCHAR_IS_UCS_4) || __STDC_ISO_10646__
+constexpr bool WCharIsUnicode = sizeof(wchar_t) == 4;
+#else
+constexpr bool WCharIsUnicode = false;
+#endif
+
+#ifdef WORDS_BIGENDIAN
+constexpr bool Utf16LEIsNative = false;
+#else
+constexpr bool Utf16LEIsNative = true;
+#endif
+
+// UTF-8-MAC sources are normalized by iconv
+constexpr bool Utf8SourceIsUtf8 = std::string_view(UTF8_SOURCE) == "UTF-8";
+
+template<class IN_CHAR, class OUT_CHAR>
+bool isUnicodeConversion(StdConversionType convertType)
+{
+  constexpr size_t inSize = sizeof(IN_CHAR);
+  constexpr size_t outSize = sizeof(OUT_CHAR);
+  constexpr size_t wSize = sizeof(wchar_t);
+
+  switch (convertType)
+  {
+    case Utf8ToUtf32:
+      return Utf8SourceIsUtf8 && inSize == 1 && outSize == 4;
+    case Utf32ToUtf8:
+      return inSize == 4 && outSize == 1;
+    case Utf32ToW:
+      return WCharIsUnicode && inSize == 4 && outSize == wSize;
+    case WToUtf32:
+      return WCharIsUnicode && inSize == wSize && outSize == 4;
+    case WtoUtf8:
+      return WCharIsUnicode && inSize == wSize && outSize == 1;
+    case Utf8toW:
+      return WCharIsUnicode && Utf8SourceIsUtf8 && inSize == 1 && outSize == wSize;
+    case Utf16LEtoUtf8:
+      return Utf16LEIsNative && inSize == 2 && outSize == 1;
+    case Utf16LEtoW:
+      return Utf16LEIsNative && WCharIsUnicode && inSize == 2 && outSize == wSize;
+    default:
+      return false;
+  }
+}
+
+template<class CHAR>
+using UnitType = std::make_unsigned_t<CHAR>;
+
+/* number of code units at the start of str which are US-ASCII characters */
+template<class CHAR>
+size_t sizeOfAsciiPrefix(const CHAR* str, size_t len)
+{
+  if constexpr (sizeof(CHAR) == 1)
+    return CUtf8Utils::SizeOfAsciiPrefix(reinterpret_cast<const char*>(str), len);
+  else
+  {
+    size_t pos = 0;
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+    constexpr size_t unitsPerChunk = 16 / sizeof(CHAR);
+    const __m128i nonAsciiBits = sizeof(CHAR) == 2
+                                     ? _mm_set1_epi16(static_cast<short>(0xFF80))
+                                     : _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; pos + unitsPerChunk <= len; pos += unitsPerChunk)
+    {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+      // one bit for each byte of a non-ASCII code unit which isn't zero
+      const int nonAscii =
+          _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(chunk, nonAsciiBits), zero)) ^ 0xFFFF;
+      if (nonAscii)
+        return pos + std::countr_zero(static_cast<unsigned int>(nonAscii)) / sizeof(CHAR);
+    }
+#endif
+    while (pos < len && static_cast<UnitType<CHAR>>(str[pos]) < 0x80)
+      pos++;
+
+    return pos;
+  }
+}
+
+/* copy US-ASCII characters between encodings, the code unit size being the only difference */
+template<class IN_CHAR, class OUT_CHAR>
+OUT_CHAR* copyAscii(const IN_CHAR* in, size_t len, OUT_CHAR* out)
+{
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  if constexpr (sizeof(IN_CHAR) == 1 && sizeof(OUT_CHAR) > 1)
+  {
+    const __m128i zero = _mm_setzero_si128();
+    for (; len >= 16; len -= 16, in += 16)
+    {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+      const __m128i low = _mm_unpacklo_epi8(chunk, zero);
+      const __m128i high = _mm_unpackhi_epi8(chunk, zero);
+      __m128i* dst = reinterpret_cast<__m128i*>(out);
+      if constexpr (sizeof(OUT_CHAR) == 2)
+      {
+        _mm_storeu_si128(dst, low);
+        _mm_storeu_si128(dst + 1, high);
+      }
+      else
+      {
+        _mm_storeu_si128(dst, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(high, zero));
+      }
+      out += 16;
+    }
+  }
+  else if constexpr (sizeof(IN_CHAR) == 4 && sizeof(OUT_CHAR) == 1)
+  {
+    for (; len >= 16; len -= 16, in += 16)
+    {
+      const __m128i* src = reinterpret_cast<const __m128i*>(in);
+      // no saturation happens, all values are below 0x80
+      const __m128i low =
+          _mm_packs_epi32(_mm_loadu_si128(src), _mm_loadu_si128(src + 1));
+      const __m128i high =
+          _mm_packs_epi32(_mm_loadu_si128(src + 2), _mm_loadu_si128(src + 3));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(low, high));
+      out += 16;
+    }
+  }
+#endif
+  for (; len > 0; len--)
+    *out++ = static_cast<OUT_CHAR>(*in++);
+
+  return out;
+}
+
+/* decode the character at in and move in past it */
+template<class CHAR>
+bool decodeChar(const CHAR*& in, const CHAR* end, char32_t& codePoint)
+{
+  const auto first = static_cast<UnitType<CHAR>>(*in);
+  if constexpr (sizeof(CHAR) == 1)
+  {
+    /* same limits as CUtf8Utils::SizeOfUtf8Char(), no overlong forms, no surrogates */
+    const size_t avail = end - in;
+    const unsigned char* const bytes = reinterpret_cast<const unsigned char*>(in);
+    const auto isTrail = [bytes](size_t i) { return (bytes[i] & 0xC0) == 0x80; };
+
+    if (first < 0x80)
+    {
+      codePoint = first;
+      in++;
+      return true;
+    }
+    if (first >= 0xC2 && first <= 0xDF)
+    {
+      if (avail < 2 || !isTrail(1))
+        return false;
+      codePoint = ((first & 0x1F) << 6) | (bytes[1] & 0x3F);
+      in += 2;
+      return true;
+    }
+    if (first >= 0xE0 && first <= 0xEF)
+    {
+      if (avail < 3 || !isTrail(1) || !isTrail(2))
+        return false;
+      codePoint = ((first & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6) | (bytes[2] & 0x3F);
+      if (codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        return false;
+      in += 3;
+      return true;
+    }
+    if (first >= 0xF0 && first <= 0xF4)
+    {
+      if (avail < 4 || !isTrail(1) || !isTrail(2) || !isTrail(3))
+        return false;
+      codePoint = ((first & 0x07) << 18) | ((bytes[1] & 0x3F) << 12) | ((bytes[2] & 0x3F) << 6) |
+                  (bytes[3] & 0x3F);
+      if (codePoint < 0x10000 || codePoint > 0x10FFFF)
+        return false;
+      in += 4;
+      return true;
+    }
+    return false;
+  }
+  else if constexpr (sizeof(CHAR) == 2)
+  {
+    if (first < 0xD800 || first > 0xDFFF)
+    {
+      codePoint = first;
+      in++;
+      return true;
+    }
+
+    /* high surrogate followed by low surrogate */
+    if (first > 0xDBFF || end - in < 2)
+      return false;
+    const auto second = static_cast<UnitType<CHAR>>(in[1]);
+    if (second < 0xDC00 || second > 0xDFFF)
+      return false;
+
+    codePoint = 0x10000 + ((static_cast<char32_t>(first - 0xD800) << 10) | (second - 0xDC00));
+    in += 2;
+    return true;
+  }
+  else
+  {
+    if ((first >= 0xD800 && first <= 0xDFFF) || first > 0x10FFFF)
+      return false;
+
+    codePoint = first;
+    in++;
+    return true;
+  }
+}
+
+template<class CHAR>
+CHAR* encodeChar(char32_t codePoint, CHAR* out)
+{
+  if constexpr (sizeof(CHAR) == 1)
+  {
+    if (codePoint < 0x80)
+      *out++ = static_cast<CHAR>(codePoint);
+    else if (codePoint < 0x800)
+    {
+      *out++ = static_cast<CHAR>(0xC0 | (codePoint >> 6));
+      *out++ = static_cast<CHAR>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+      *out++ = static_cast<CHAR>(0xE0 | (codePoint >> 12));
+      *out++ = static_cast<CHAR>(0x80 | ((codePoint >> 6) & 0x3F));
+      *out++ = static_cast<CHAR>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+      *out++ = static_cast<CHAR>(0xF0 | (codePoint >> 18));
+      *out++ = static_cast<CHAR>(0x80 | ((codePoint >> 12) & 0x3F));
+      *out++ = static_cast<CHAR>(0x80 | ((codePoint >> 6) & 0x3F));
+      *out++ = static_cast<CHAR>(0x80 | (codePoint & 0x3F));
+    }
+  }
+  else if constexpr (sizeof(CHAR) == 2)
+  {
+    if (codePoint < 0x10000)
+      *out++ = static_cast<CHAR>(codePoint);
+    else
+    {
+      *out++ = static_cast<CHAR>(0xD800 + ((codePoint - 0x10000) >> 10));
+      *out++ = static_cast<CHAR>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+    }
+  }
+  else
+    *out++ = static_cast<CHAR>(codePoint);
+
+  return out;
+}
+
+/* maximum number of output code units for a single input code unit */
+template<class IN_CHAR, class OUT_CHAR>
+constexpr size_t maxOutputUnits()
+{
+  if constexpr (sizeof(OUT_CHAR) == 1)
+    return sizeof(IN_CHAR) == 1 ? 1 : sizeof(IN_CHAR) == 2 ? 3 : 4;
+  else if constexpr (sizeof(OUT_CHAR) == 2)
+    return sizeof(IN_CHAR) == 4 ? 2 : 1;
+  else
+    return 1;
+}
+
+template<class INPUT, class OUTPUT>
+bool unicodeConvert(const INPUT& strSource, OUTPUT& strDest)
+{
+  using InChar = typename INPUT::value_type;
+  using OutChar = typename OUTPUT::value_type;
+
+  const InChar* in = strSource.data();
+  const InChar* const end = in + strSource.length();
+
+  strDest.resize(strSource.length() * maxOutputUnits<InChar, OutChar>());
+  OutChar* const outStart = strDest.data();
+  OutChar* out = outStart;
+
+  while (in < end)
+  {
+    if (static_cast<UnitType<InChar>>(*in) < 0x80)
+    {
+      const size_t asciiLen = sizeOfAsciiPrefix(in, end - in);
+      out = copyAscii(in, asciiLen, out);
+      in += asciiLen;
+      continue;
+    }
+
+    char32_t codePoint;
+    if (!decodeChar(in, end, codePoint))
+      return false;
+    out = encodeChar(codePoint, out);
+  }
+
+  strDest.resize(out - outStart);
+
+  /* iconv converts the terminating null as well, convert() keeps it if the source ends with null */
+  if (strSource.back() == 0)
+    strDest.push_back(0);
+
+  return true;
+}
+} // unnamed namespace
+
 template<class INPUT,class OUTPUT>
 bool CCharsetConverter::CInnerConverter::stdConvert(StdConversionType convertType, const INPUT& strSource, OUTPUT& strDest, bool failOnInvalidChar /*= false*/)
 {
@@ -326,6 +644,13 @@ bool CCharsetConverter::CInnerConverter::stdConvert(StdConversionType convertTyp
   if (convertType < 0 || convertType >= NumberOfStdConversionTypes)
     return false;
 
+  if (isUnicodeConversion<typename INPUT::value_type, typename OUTPUT::value_type>(convertType))
+  {
+    if (unicodeConvert(strSource, strDest))
+      return true;
+    strDest.clear();
+  }
+
   CConverterType& convType = m_stdConversion[convertType];
   std::unique_lock<CCriticalSection> converterLock(convType);
 
@@ -8,78 +8,302 @@
 
 #include "JSONVariantWriter.h"
 
-#include "utils/Variant.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <string_view>
 
 #include <nlohmann/json.hpp>
 
-void InternalWrite(nlohmann::json& writer, const CVariant& value)
+namespace
 {
-  switch (value.type())
+/*!
+ * \brief Length of the UTF-8 sequence at the start of text, 0 if it isn't valid.
+ *
+ * Rejects overlong forms, surrogates and code points beyond U+10FFFF like the nlohmann serializer
+ * used to.
+ */
+size_t GetSequenceLength(std::string_view text)
+{
+  const auto lead = static_cast<unsigned char>(text[0]);
+  size_t length;
+  unsigned char min = 0x80;
+  unsigned char max = 0xBF;
+  if (lead >= 0xC2 && lead <= 0xDF)
+    length = 2;
+  else if (lead >= 0xE0 && lead <= 0xEF)
   {
-  case CVariant::VariantTypeInteger:
-    writer = value.asInteger();
-    break;
-  case CVariant::VariantTypeUnsignedInteger:
-    writer = value.asUnsignedInteger();
-    break;
-  case CVariant::VariantTypeDouble:
-    writer = value.asDouble();
-    break;
-  case CVariant::VariantTypeBoolean:
-    writer = value.asBoolean();
-    break;
-  case CVariant::VariantTypeString:
-    writer = std::string(value.c_str(), value.size());
-    break;
-  case CVariant::VariantTypeArray:
-    writer = nlohmann::json::array();
-
-    for (CVariant::const_iterator_array itr = value.begin_array(); itr != value.end_array(); ++itr)
-    {
-      nlohmann::json& o = writer.emplace_back();
-      InternalWrite(o, *itr);
-    }
+    length = 3;
+    if (lead == 0xE0)
+      min = 0xA0;
+    else if (lead == 0xED)
+      max = 0x9F;
+  }
+  else if (lead >= 0xF0 && lead <= 0xF4)
+  {
+    length = 4;
+    if (lead == 0xF0)
+      min = 0x90;
+    else if (lead == 0xF4)
+      max = 0x8F;
+  }
+  else
+    return 0;
+
+  if (text.size() < length)
+    return 0;
+
+  for (size_t i = 1; i < length; ++i)
+  {
+    const auto c = static_cast<unsigned char>(text[i]);
+    if (c < min || c > max)
+      return 0;
+    min = 0x80;
+    max = 0xBF;
+  }
+  return length;
+}
 
-    break;
-  case CVariant::VariantTypeObject:
-    writer = nlohmann::json::object();
+bool WriteString(std::string_view text, std::string& output)
+{
+  static constexpr char HEX[] = "0123456789abcdef";
 
-    for (CVariant::const_iterator_map itr = value.begin_map(); itr != value.end_map(); ++itr)
+  output += '"';
+  size_t pos = 0;
+  while (pos < text.size())
+  {
+    // copy everything not needing an escape at once
+    const size_t start = pos;
+    while (pos < text.size())
     {
-      nlohmann::json& o = writer[itr->first];
-      InternalWrite(o, itr->second);
+      const auto c = static_cast<unsigned char>(text[pos]);
+      if (c < 0x20 || c == '"' || c == '\\')
+        break;
+      if (c < 0x80)
+      {
+        ++pos;
+        continue;
+      }
+      const size_t length = GetSequenceLength(text.substr(pos));
+      if (length == 0)
+        return false;
+      pos += length;
     }
+    output.append(text.data() + start, pos - start);
+    if (pos == text.size())
+      break;
 
-    break;
-
-  case CVariant::VariantTypeConstNull:
-  case CVariant::VariantTypeNull:
-  default:
-    writer = nullptr;
-    break;
+    const char c = text[pos++];
+    switch (c)
+    {
+      case '"':
+        output += "\\\"";
+        break;
+      case '\\':
+        output += "\\\\";
+        break;
+      case '\b':
+        output += "\\b";
+        break;
+      case '\f':
+        output += "\\f";
+        break;
+      case '\n':
+        output += "\\n";
+        break;
+      case '\r':
+        output += "\\r";
+        break;
+      case '\t':
+        output += "\\t";
+        break;
+      default:
+        output += "\\u00";
+        output += HEX[(c >> 4) & 0x0F];
+        output += HEX[c & 0x0F];
+        break;
+    }
   }
+  output += '"';
+  return true;
 }
 
+template<typename T>
+void WriteNumber(T value, std::string& output)
+{
+  char buffer[24];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  output.append(buffer, result.ptr);
+}
+} // unnamed namespace
+
 bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
 {
-  try
+  CJSONVariantStreamWriter writer(value, compact);
+
+  std::string json;
+  while (writer.Next(json))
+    ;
+
+  if (writer.HasFailed())
+    return false;
+
+  output = std::move(json);
+  return true;
+}
+
+CJSONVariantStreamWriter::CJSONVariantStreamWriter(const CVariant& value, bool compact)
+  : m_value(value), m_compact(compact)
+{
+}
+
+size_t CJSONVariantStreamWriter::Read(char* buffer, size_t size)
+{
+  size_t written = 0;
+  while (written < size)
   {
-    nlohmann::json json;
-    InternalWrite(json, value);
+    if (m_pendingPosition == m_pending.size())
+    {
+      m_pending.clear();
+      m_pendingPosition = 0;
+      // collect a few values at once rather than one per copy
+      while (m_pending.size() < size - written && Next(m_pending))
+        ;
+      if (m_pending.empty())
+        break;
+    }
+
+    const size_t length = std::min(size - written, m_pending.size() - m_pendingPosition);
+    std::memcpy(buffer + written, m_pending.data() + m_pendingPosition, length);
+    m_pendingPosition += length;
+    written += length;
+  }
+  return written;
+}
+
+bool CJSONVariantStreamWriter::Next(std::string& output)
+{
+  if (m_done)
+    return false;
 
-    if (compact)
+  // nothing of a value that can't be written ends up in output
+  const size_t length = output.size();
+
+  if (!m_started)
+  {
+    m_started = true;
+    if (!WriteValue(m_value, output))
+    {
+      output.resize(length);
+      return false;
+    }
+  }
+  else
+  {
+    Frame& frame = m_stack.back();
+    const bool isArray = frame.value->isArray();
+    if (isArray ? frame.array == frame.value->end_array() : frame.map == frame.value->end_map())
     {
-      output = json.dump();
+      m_stack.pop_back();
+      WriteNewline(output);
+      output += isArray ? ']' : '}';
     }
     else
     {
-      output = json.dump(1, '\t');
+      if (!frame.first)
+        output += ',';
+      frame.first = false;
+      WriteNewline(output);
+
+      // the frame is gone once WriteValue() pushes the next one
+      const CVariant* value;
+      if (isArray)
+      {
+        value = &*frame.array++;
+      }
+      else
+      {
+        if (!WriteString(frame.map->first, output))
+        {
+          m_failed = m_done = true;
+          output.resize(length);
+          return false;
+        }
+        output += m_compact ? ":" : ": ";
+        value = &(frame.map++)->second;
+      }
+
+      if (!WriteValue(*value, output))
+      {
+        output.resize(length);
+        return false;
+      }
     }
   }
-  catch (nlohmann::json::exception& e)
+
+  if (m_stack.empty())
+    m_done = true;
+
+  return true;
+}
+
+bool CJSONVariantStreamWriter::WriteValue(const CVariant& value, std::string& output)
+{
+  switch (value.type())
   {
-    return false;
-  }
+    case CVariant::VariantTypeInteger:
+      WriteNumber(value.asInteger(), output);
+      break;
+    case CVariant::VariantTypeUnsignedInteger:
+      WriteNumber(value.asUnsignedInteger(), output);
+      break;
+    case CVariant::VariantTypeDouble:
+      // keep the number format of nlohmann, e.g. 1.0 and null for NaN
+      output += nlohmann::json(value.asDouble()).dump();
+      break;
+    case CVariant::VariantTypeBoolean:
+      output += value.asBoolean() ? "true" : "false";
+      break;
+    case CVariant::VariantTypeString:
+      if (!WriteString(std::string_view(value.c_str(), value.size()), output))
+      {
+        m_failed = m_done = true;
+        return false;
+      }
+      break;
+    case CVariant::VariantTypeArray:
+      if (value.empty())
+        output += "[]";
+      else
+      {
+        output += '[';
+        m_stack.emplace_back(Frame{&value, value.begin_array(), {}});
+      }
+      break;
+    case CVariant::VariantTypeObject:
+      if (value.empty())
+        output += "{}";
+      else
+      {
+        output += '{';
+        m_stack.emplace_back(Frame{&value, {}, value.begin_map()});
+      }
+      break;
 
+    case CVariant::VariantTypeConstNull:
+    case CVariant::VariantTypeNull:
+    default:
+      output += "null";
+      break;
+  }
   return true;
 }
+
+void CJSONVariantStreamWriter::WriteNewline(std::string& output) const
+{
+  if (m_compact)
+    return;
+
+  output += '\n';
+  output.append(m_stack.size(), '\t');
+}
@@ -8,9 +8,11 @@
 
 #pragma once
 
-#include <string>
+#include "utils/Variant.h"
 
-class CVariant;
+#include <stddef.h>
+#include <string>
+#include <vector>
 
 class CJSONVariantWriter
 {
@@ -19,3 +21,56 @@ public:
 
   static bool Write(const CVariant &value, std::string& output, bool compact);
 };
+
+/*!
+ * \brief Writes the JSON of a CVariant piece by piece.
+ *
+ * The output is the same as the one of CJSONVariantWriter::Write() but never held in memory as a
+ * whole, so that large responses can be sent while they are being written. The value has to
+ * outlive the writer.
+ */
+class CJSONVariantStreamWriter
+{
+public:
+  CJSONVariantStreamWriter(const CVariant& value, bool compact);
+
+  /*!
+   * \brief Write the next part of the JSON to buffer.
+   * \return The number of bytes written. Less than size only once the end has been reached or
+   * writing failed.
+   */
+  size_t Read(char* buffer, size_t size);
+
+  /*!
+   * \brief Write the next part of the JSON, at least one value or bracket, to output.
+   *
+   * Nothing is appended to output if writing fails, e.g. on a string that isn't valid UTF-8.
+   * \return False once the end has been reached or writing failed, true otherwise.
+   */
+  bool Next(std::string& output);
+
+  bool IsDone() const { return m_done && m_pendingPosition == m_pending.size(); }
+  bool HasFailed() const { return m_failed; }
+
+private:
+  struct Frame
+  {
+    const CVariant* value;
+    CVariant::const_iterator_array array;
+    CVariant::const_iterator_map map;
+    bool first = true;
+  };
+
+  bool WriteValue(const CVariant& value, std::string& output);
+  void WriteNewline(std::string& output) const;
+
+  const CVariant& m_value;
+  const bool m_compact;
+  std::vector<Frame> m_stack;
+  bool m_started = false;
+  bool m_done = false;
+  bool m_failed = false;
+
+  std::string m_pending;
+  size_t m_pendingPosition = 0;
+};
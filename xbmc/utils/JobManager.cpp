@@ -16,9 +16,16 @@
 #include <functional>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 
 using namespace std::chrono_literals;
 
+namespace
+{
+// work queue of the worker running on this thread, jobs added from a job stay on it
+thread_local size_t t_workerQueue = SIZE_MAX;
+} // unnamed namespace
+
 bool CJob::ShouldCancel(unsigned int progress, unsigned int total) const
 {
   if (m_callback)
@@ -26,7 +33,7 @@ bool CJob::ShouldCancel(unsigned int progress, unsigned int total) const
   return false;
 }
 
-CJobWorker::CJobWorker(CJobManager *manager) : CThread("JobWorker")
+CJobWorker::CJobWorker(CJobManager* manager, size_t queue) : CThread("JobWorker"), m_queue(queue)
 {
   m_jobManager = manager;
   Create(true); // start work immediately, and kill ourselves when we're done
@@ -42,10 +49,12 @@ CJobWorker::~CJobWorker()
 void CJobWorker::Process()
 {
   SetPriority(ThreadPriority::LOWEST);
+  t_workerQueue = m_queue;
   while (true)
   {
     // request an item from our manager (this call is blocking)
-    CJob* job = m_jobManager->GetNextJob();
+    size_t queue = m_queue;
+    CJob* job = m_jobManager->GetNextJob(queue);
     if (!job)
       break;
 
@@ -58,8 +67,9 @@ void CJobWorker::Process()
     {
       CLog::Log(LOGERROR, "{} error processing job {}", __FUNCTION__, job->GetType());
     }
-    m_jobManager->OnJobComplete(success, job);
+    m_jobManager->OnJobComplete(success, job, queue);
   }
+  t_workerQueue = SIZE_MAX;
 }
 
 void CJobQueue::CJobPointer::CancelJob()
@@ -178,11 +188,14 @@ bool CJobQueue::QueueEmpty() const
 
 CJobManager::CJobManager()
 {
-  m_jobCounter = 0;
-  m_running = true;
-  m_pauseJobs = false;
+  const unsigned int queues = GetMaxWorkers(CJob::PRIORITY_HIGH);
+  m_queues.reserve(queues);
+  for (unsigned int i = 0; i < queues; ++i)
+    m_queues.emplace_back(std::make_unique<CWorkQueue>());
 }
 
+CJobManager::~CJobManager() = default;
+
 void CJobManager::Restart()
 {
   std::unique_lock lock(m_section);
@@ -194,28 +207,35 @@ void CJobManager::Restart()
 
 void CJobManager::CancelJobs()
 {
-  std::unique_lock lock(m_section);
   m_running = false;
 
-  // clear any pending jobs
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED; ++priority)
+  for (const auto& queue : m_queues)
   {
-    std::for_each(m_jobQueue[priority].begin(), m_jobQueue[priority].end(), [](CWorkItem& wi) {
+    std::unique_lock lock(queue->m_section);
+
+    // clear any pending jobs
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED; ++priority)
+    {
+      std::for_each(queue->m_jobQueue[priority].begin(), queue->m_jobQueue[priority].end(),
+                    [](CWorkItem& wi) {
+                      if (wi.m_callback)
+                        wi.m_callback->OnJobAbort(wi.m_id, wi.m_job);
+                      wi.FreeJob();
+                    });
+      m_queued[priority] -= queue->m_jobQueue[priority].size();
+      queue->m_jobQueue[priority].clear();
+    }
+
+    // cancel any callbacks on jobs still processing
+    std::for_each(queue->m_processing.begin(), queue->m_processing.end(), [](CWorkItem& wi) {
       if (wi.m_callback)
         wi.m_callback->OnJobAbort(wi.m_id, wi.m_job);
-      wi.FreeJob();
+      wi.Cancel();
     });
-    m_jobQueue[priority].clear();
   }
 
-  // cancel any callbacks on jobs still processing
-  std::for_each(m_processing.begin(), m_processing.end(), [](CWorkItem& wi) {
-    if (wi.m_callback)
-      wi.m_callback->OnJobAbort(wi.m_id, wi.m_job);
-    wi.Cancel();
-  });
-
   // tell our workers to finish
+  std::unique_lock lock(m_section);
   while (!m_workers.empty())
   {
     lock.unlock();
@@ -227,46 +247,64 @@ void CJobManager::CancelJobs()
 
 unsigned int CJobManager::AddJob(CJob *job, IJobCallback *callback, CJob::PRIORITY priority)
 {
-  std::unique_lock lock(m_section);
+  // jobs added by a job stay with its worker, others are spread over all queues
+  const size_t queueIndex =
+      t_workerQueue < m_queues.size() ? t_workerQueue : m_nextQueue++ % m_queues.size();
+  CWorkQueue& queue = *m_queues[queueIndex];
 
-  if (!m_running)
+  unsigned int id;
   {
-    delete job;
-    return 0;
-  }
+    std::unique_lock lock(queue.m_section);
 
-  // increment the job counter, ensuring 0 (invalid job) is never hit
-  m_jobCounter++;
-  if (m_jobCounter == 0)
-    m_jobCounter++;
+    // checked under the queue lock, so CancelJobs() either sees the job or we see it stopped
+    if (!m_running)
+    {
+      lock.unlock();
+      delete job;
+      return 0;
+    }
 
-  // create a work item for this job
-  CWorkItem work(job, m_jobCounter, priority, callback);
-  m_jobQueue[priority].push_back(work);
+    // increment the job counter, ensuring 0 (invalid job) is never hit
+    id = ++m_jobCounter;
+    if (id == 0)
+      id = ++m_jobCounter;
+
+    // create a work item for this job
+    queue.m_jobQueue[priority].emplace_back(job, id, priority, callback);
+    m_queued[priority]++;
+  }
 
   StartWorkers(priority);
-  return work.m_id;
+  return id;
 }
 
 void CJobManager::CancelJob(unsigned int jobID)
 {
-  std::unique_lock lock(m_section);
-
-  // check whether we have this job in the queue
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED; ++priority)
+  for (const auto& queue : m_queues)
   {
-    JobQueue::iterator i = find(m_jobQueue[priority].begin(), m_jobQueue[priority].end(), jobID);
-    if (i != m_jobQueue[priority].end())
+    std::unique_lock lock(queue->m_section);
+
+    // check whether we have this job in the queue
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED; ++priority)
     {
-      delete i->m_job;
-      m_jobQueue[priority].erase(i);
+      JobQueue& jobs = queue->m_jobQueue[priority];
+      JobQueue::iterator i = find(jobs.begin(), jobs.end(), jobID);
+      if (i != jobs.end())
+      {
+        delete i->m_job;
+        jobs.erase(i);
+        m_queued[priority]--;
+        return;
+      }
+    }
+    // or if we're processing it
+    Processing::iterator it = find(queue->m_processing.begin(), queue->m_processing.end(), jobID);
+    if (it != queue->m_processing.end())
+    {
+      it->m_callback = NULL; // job is in progress, so only thing to do is to remove callback
       return;
     }
   }
-  // or if we're processing it
-  Processing::iterator it = find(m_processing.begin(), m_processing.end(), jobID);
-  if (it != m_processing.end())
-    it->m_callback = NULL; // job is in progress, so only thing to do is to remove callback
 }
 
 void CJobManager::StartWorkers(CJob::PRIORITY priority)
@@ -274,68 +312,149 @@ void CJobManager::StartWorkers(CJob::PRIORITY priority)
   std::unique_lock lock(m_section);
 
   // check how many free threads we have
-  if (m_processing.size() >= GetMaxWorkers(priority))
+  if (m_processingCount >= GetMaxWorkers(priority))
     return;
 
   // do we have any sleeping threads?
-  if (m_processing.size() < m_workers.size())
+  if (m_processingCount < m_workers.size())
   {
     m_jobEvent.Set();
     return;
   }
 
   // everyone is busy - we need more workers
-  m_workers.push_back(new CJobWorker(this));
+  m_workers.push_back(new CJobWorker(this, m_workers.size() % m_queues.size()));
 }
 
-CJob *CJobManager::PopJob()
+bool CJobManager::ReserveWorker(CJob::PRIORITY priority)
+{
+  const size_t maxWorkers = GetMaxWorkers(priority);
+  size_t processing = m_processingCount;
+  while (processing < maxWorkers)
+  {
+    if (m_processingCount.compare_exchange_weak(processing, processing + 1))
+      return true;
+  }
+  return false;
+}
+
+bool CJobManager::AcquireTypeSlot(CWorkItem& item)
+{
+  if (!m_hasTypeLimits)
+    return true;
+
+  std::unique_lock lock(m_typeSection);
+  const auto limit = m_typeLimits.find(item.m_job->GetType());
+  if (limit == m_typeLimits.end())
+    return true;
+
+  unsigned int& processing = m_typeProcessing[limit->first];
+  if (processing >= limit->second)
+    return false;
+  processing++;
+  item.m_typeSlot = true;
+  return true;
+}
+
+void CJobManager::ReleaseTypeSlot(const CWorkItem& item)
+{
+  // the limit may have been changed since, only give back what was taken
+  if (!item.m_typeSlot)
+    return;
+
+  std::unique_lock lock(m_typeSection);
+  const auto processing = m_typeProcessing.find(item.m_job->GetType());
+  if (processing != m_typeProcessing.end() && processing->second > 0)
+    processing->second--;
+}
+
+bool CJobManager::PopJob(CWorkQueue& queue, unsigned int priority, CWorkItem& job)
+{
+  std::unique_lock lock(queue.m_section);
+  JobQueue& jobs = queue.m_jobQueue[priority];
+
+  // oldest job first, passing over jobs whose type is at its concurrency limit
+  const auto it =
+      std::ranges::find_if(jobs, [this](CWorkItem& item) { return AcquireTypeSlot(item); });
+  if (it == jobs.end())
+    return false;
+
+  job = *it;
+  jobs.erase(it);
+  m_queued[priority]--;
+
+  // add to the processing vector
+  queue.m_processing.push_back(job);
+  job.m_job->m_callback = this;
+  return true;
+}
+
+CJob *CJobManager::PopJob(size_t& queue)
 {
-  std::unique_lock lock(m_section);
   for (int priority = CJob::PRIORITY_DEDICATED; priority >= CJob::PRIORITY_LOW_PAUSABLE; --priority)
   {
     // Check whether we're pausing pausable jobs
     if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
       continue;
 
-    if (!m_jobQueue[priority].empty() &&
-        m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
-    {
-      // pop the job off the queue
-      CWorkItem job = m_jobQueue[priority].front();
-      m_jobQueue[priority].pop_front();
+    if (m_queued[priority] == 0 || !ReserveWorker(CJob::PRIORITY(priority)))
+      continue;
 
-      // add to the processing vector
-      m_processing.push_back(job);
-      job.m_job->m_callback = this;
+    // our own queue first, then steal from the others
+    for (size_t i = 0; i < m_queues.size(); ++i)
+    {
+      const size_t index = (queue + i) % m_queues.size();
+      CWorkItem job(nullptr, 0, CJob::PRIORITY(priority), nullptr);
+      if (!PopJob(*m_queues[index], priority, job))
+        continue;
+
+      const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - job.m_queued)
+                            .count();
+      m_started[priority]++;
+      m_waitTotal[priority] += wait;
+      uint64_t maxWait = m_waitMax[priority];
+      while (static_cast<uint64_t>(wait) > maxWait &&
+             !m_waitMax[priority].compare_exchange_weak(maxWait, wait))
+        ;
+      if (i > 0)
+        m_stolen++;
+
+      queue = index;
       return job.m_job;
     }
+    m_processingCount--;
   }
   return NULL;
 }
 
 void CJobManager::PauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = true;
 }
 
 void CJobManager::UnPauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = false;
+
+  // paused jobs may have been passed over by all workers
+  if (m_queued[CJob::PRIORITY_LOW_PAUSABLE] > 0)
+    StartWorkers(CJob::PRIORITY_LOW_PAUSABLE);
 }
 
 bool CJobManager::IsProcessing(const CJob::PRIORITY &priority) const
 {
-  std::unique_lock lock(m_section);
-
   if (m_pauseJobs)
     return false;
 
-  for(Processing::const_iterator it = m_processing.begin(); it < m_processing.end(); ++it)
+  for (const auto& queue : m_queues)
   {
-    if (priority == it->m_priority)
-      return true;
+    std::unique_lock lock(queue->m_section);
+    for(Processing::const_iterator it = queue->m_processing.begin(); it < queue->m_processing.end(); ++it)
+    {
+      if (priority == it->m_priority)
+        return true;
+    }
   }
   return false;
 }
@@ -343,64 +462,116 @@ bool CJobManager::IsProcessing(const CJob::PRIORITY &priority) const
 int CJobManager::IsProcessing(const std::string &type) const
 {
   int jobsMatched = 0;
-  std::unique_lock lock(m_section);
 
   if (m_pauseJobs)
     return 0;
 
-  for(Processing::const_iterator it = m_processing.begin(); it < m_processing.end(); ++it)
+  for (const auto& queue : m_queues)
   {
-    if (type == std::string(it->m_job->GetType()))
-      jobsMatched++;
+    std::unique_lock lock(queue->m_section);
+    for(Processing::const_iterator it = queue->m_processing.begin(); it < queue->m_processing.end(); ++it)
+    {
+      if (type == std::string(it->m_job->GetType()))
+        jobsMatched++;
+    }
   }
   return jobsMatched;
 }
 
-CJob* CJobManager::GetNextJob()
+void CJobManager::SetConcurrencyLimit(const std::string& type, unsigned int limit)
+{
+  {
+    std::unique_lock lock(m_typeSection);
+    if (limit > 0)
+      m_typeLimits[type] = limit;
+    else
+      m_typeLimits.erase(type);
+    m_hasTypeLimits = !m_typeLimits.empty();
+  }
+
+  // a higher limit may allow jobs that were passed over to run now
+  StartWorkers(CJob::PRIORITY_DEDICATED);
+}
+
+CJobManager::Stats CJobManager::GetStats() const
 {
+  Stats stats;
+  for (size_t priority = 0; priority < PRIORITIES; ++priority)
+  {
+    stats.queued[priority] = m_queued[priority];
+    stats.started[priority] = m_started[priority];
+    if (stats.started[priority] > 0)
+      stats.meanWait[priority] =
+          std::chrono::microseconds(m_waitTotal[priority] / stats.started[priority]);
+    stats.maxWait[priority] = std::chrono::microseconds(m_waitMax[priority]);
+  }
+  stats.processing = m_processingCount;
+  stats.stolen = m_stolen;
+
   std::unique_lock lock(m_section);
+  stats.workers = m_workers.size();
+  return stats;
+}
+
+CJob* CJobManager::GetNextJob(size_t& queue)
+{
+  const size_t home = queue;
   while (m_running)
   {
     // grab a job off the queue if we have one
-    CJob *job = PopJob();
+    CJob *job = PopJob(queue);
     if (job)
+    {
+      // several jobs may have been added for a single wake up, pass it on
+      for (const auto& queued : m_queued)
+      {
+        if (queued > 0)
+        {
+          m_jobEvent.Set();
+          break;
+        }
+      }
       return job;
+    }
     // no jobs are left - sleep for 30 seconds to allow new jobs to come in
-    lock.unlock();
-    bool newJob = m_jobEvent.Wait(30000ms);
-    lock.lock();
-    if (!newJob)
+    if (!m_jobEvent.Wait(30000ms))
       break;
+    queue = home;
   }
   // ensure no jobs have come in during the period after
   // timeout and before we held the lock
-  return PopJob();
+  return PopJob(queue);
 }
 
 bool CJobManager::OnJobProgress(unsigned int progress, unsigned int total, const CJob *job) const
 {
-  std::unique_lock lock(m_section);
-  // find the job in the processing queue, and check whether it's cancelled (no callback)
-  Processing::const_iterator i = find(m_processing.begin(), m_processing.end(), job);
-  if (i != m_processing.end())
+  for (const auto& queue : m_queues)
   {
-    CWorkItem item(*i);
-    lock.unlock(); // leave section prior to call
-    if (item.m_callback)
+    std::unique_lock lock(queue->m_section);
+    // find the job in the processing queue, and check whether it's cancelled (no callback)
+    Processing::const_iterator i = find(queue->m_processing.begin(), queue->m_processing.end(), job);
+    if (i != queue->m_processing.end())
     {
-      item.m_callback->OnJobProgress(item.m_id, progress, total, job);
-      return false;
+      CWorkItem item(*i);
+      lock.unlock(); // leave section prior to call
+      if (item.m_callback)
+      {
+        item.m_callback->OnJobProgress(item.m_id, progress, total, job);
+        return false;
+      }
+      break;
     }
   }
   return true; // couldn't find the job, or it's been cancelled
 }
 
-void CJobManager::OnJobComplete(bool success, CJob *job)
+void CJobManager::OnJobComplete(bool success, CJob *job, size_t queueIndex)
 {
-  std::unique_lock lock(m_section);
+  CWorkQueue& queue = *m_queues[queueIndex];
+  std::unique_lock lock(queue.m_section);
   // remove the job from the processing queue
-  Processing::iterator i = find(m_processing.begin(), m_processing.end(), job);
-  if (i != m_processing.end())
+  Processing::iterator i = find(queue.m_processing.begin(), queue.m_processing.end(), job);
+  if (i != queue.m_processing.end())
   {
     // tell any listeners we're done with the job, then delete it
     CWorkItem item(*i);
@@ -415,10 +586,12 @@ void CJobManager::OnJobComplete(bool success, CJob *job)
       CLog::Log(LOGERROR, "{} error processing job {}", __FUNCTION__, item.m_job->GetType());
     }
     lock.lock();
-    Processing::iterator j = find(m_processing.begin(), m_processing.end(), job);
-    if (j != m_processing.end())
-      m_processing.erase(j);
+    Processing::iterator j = find(queue.m_processing.begin(), queue.m_processing.end(), job);
+    if (j != queue.m_processing.end())
+      queue.m_processing.erase(j);
     lock.unlock();
+    ReleaseTypeSlot(item);
+    m_processingCount--;
     item.FreeJob();
   }
 }
@@ -434,7 +607,8 @@ void CJobManager::RemoveWorker(const CJobWorker *worker)
 
 unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
 {
-  static const unsigned int max_workers = 5;
+  // at least the historical five workers, more on hosts with more cores
+  static const unsigned int max_workers = std::max(5U, std::thread::hardware_concurrency());
   if (priority == CJob::PRIORITY_DEDICATED)
     return 10000; // A large number..
   return max_workers - (CJob::PRIORITY_HIGH - priority);
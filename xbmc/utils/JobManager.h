@@ -12,6 +12,11 @@
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
 #include <queue>
 #include <string>
 #include <vector>
@@ -21,12 +26,13 @@ class CJobManager;
 class CJobWorker : public CThread
 {
 public:
-  explicit CJobWorker(CJobManager *manager);
+  CJobWorker(CJobManager* manager, size_t queue);
   ~CJobWorker() override;
 
   void Process() override;
 private:
   CJobManager  *m_jobManager;
+  size_t m_queue; //!< work queue this worker serves first
 };
 
 template<typename F>
@@ -200,6 +206,13 @@ private:
  on priority levels.  Lower priority jobs are executed only if there are sufficient
  spare worker threads free to allow for higher priority jobs that may arise.
 
+ Jobs are spread over one work queue per possible worker rather than a single shared queue.
+ Jobs added from a worker thread stay on that worker's queue, other jobs are distributed round
+ robin. Workers take the oldest job of the highest priority from their own queue and steal from
+ the other queues when theirs is empty, so adding and taking jobs rarely contend on a lock.
+ Jobs of the same priority therefore don't necessarily start in the order they were added, use a
+ CJobQueue where the order matters.
+
  \sa CJob and IJobCallback
  */
 class CJobManager final
@@ -213,6 +226,7 @@ class CJobManager final
       m_id = id;
       m_callback = callback;
       m_priority = priority;
+      m_queued = std::chrono::steady_clock::now();
     }
     bool operator==(unsigned int jobID) const
     {
@@ -235,10 +249,26 @@ class CJobManager final
     unsigned int  m_id;
     IJobCallback *m_callback;
     CJob::PRIORITY m_priority;
+    std::chrono::steady_clock::time_point m_queued;
+    bool m_typeSlot = false; //!< counted against the concurrency limit of its type
   };
 
 public:
+  static constexpr size_t PRIORITIES = CJob::PRIORITY_DEDICATED + 1;
+
+  struct Stats
+  {
+    std::array<size_t, PRIORITIES> queued{}; //!< jobs waiting, per priority
+    std::array<uint64_t, PRIORITIES> started{}; //!< jobs started since creation, per priority
+    std::array<std::chrono::microseconds, PRIORITIES> meanWait{}; //!< from AddJob to start
+    std::array<std::chrono::microseconds, PRIORITIES> maxWait{};
+    size_t processing{0}; //!< jobs currently running
+    size_t workers{0}; //!< worker threads alive
+    uint64_t stolen{0}; //!< jobs started from another worker's queue
+  };
+
   CJobManager();
+  ~CJobManager();
 
   /*!
    \brief Add a job to the threaded job manager.
@@ -320,6 +350,20 @@ public:
    */
   bool IsProcessing(const CJob::PRIORITY &priority) const;
 
+  /*!
+   \brief Limit how many jobs of a type may run at the same time.
+   Keeps e.g. disk heavy jobs from occupying all workers. Queued jobs over the limit are passed
+   over in favour of other jobs of the same priority until a running one finishes.
+   \param type the job type as returned by CJob::GetType()
+   \param limit maximum number of concurrent jobs, 0 to remove the limit
+   */
+  void SetConcurrencyLimit(const std::string& type, unsigned int limit);
+
+  /*!
+   \brief Get queue depths and queueing latencies, e.g. for diagnostics.
+   */
+  Stats GetStats() const;
+
 protected:
   friend class CJobWorker;
   friend class CJob;
@@ -327,18 +371,20 @@ protected:
 
   /*!
    \brief Get a new job to process. Blocks until a new job is available, or a timeout has occurred.
+   \param queue the work queue of the calling worker, set to the queue the job was taken from
    \sa CJob
    */
-  CJob* GetNextJob();
+  CJob* GetNextJob(size_t& queue);
 
   /*!
    \brief Callback from CJobWorker after a job has completed.
    Calls IJobCallback::OnJobComplete(), and then destroys job.
    \param job a pointer to the calling subclassed CJob instance.
    \param success the result from the DoWork call
+   \param queue the work queue the job was taken from
    \sa IJobCallback, CJob
    */
-  void  OnJobComplete(bool success, CJob *job);
+  void  OnJobComplete(bool success, CJob *job, size_t queue);
 
   /*!
    \brief Callback from CJob to report progress and check for cancellation.
@@ -355,27 +401,55 @@ private:
   CJobManager(const CJobManager&) = delete;
   CJobManager const& operator=(CJobManager const&) = delete;
 
-  /*! \brief Pop a job off the job queue and add to the processing queue ready to process
+  typedef std::deque<CWorkItem>    JobQueue;
+  typedef std::vector<CWorkItem>   Processing;
+  typedef std::vector<CJobWorker*> Workers;
+
+  /*!
+   \brief Jobs queued at one worker, and the jobs taken from them that are still running.
+   */
+  struct CWorkQueue
+  {
+    mutable CCriticalSection m_section;
+    JobQueue m_jobQueue[PRIORITIES];
+    Processing m_processing;
+  };
+
+  /*! \brief Pop a job off the job queues and add to the processing queue ready to process
+   \param queue the work queue to look at first, set to the queue the job was taken from
    \return the job to process, NULL if no jobs are available
    */
-  CJob *PopJob();
+  CJob *PopJob(size_t& queue);
+  bool PopJob(CWorkQueue& queue, unsigned int priority, CWorkItem& job);
 
+  bool ReserveWorker(CJob::PRIORITY priority);
+  bool AcquireTypeSlot(CWorkItem& item);
+  void ReleaseTypeSlot(const CWorkItem& item);
   void StartWorkers(CJob::PRIORITY priority);
   void RemoveWorker(const CJobWorker *worker);
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
 
-  unsigned int m_jobCounter;
+  std::atomic<unsigned int> m_jobCounter{0};
+  std::atomic<unsigned int> m_nextQueue{0};
 
-  typedef std::deque<CWorkItem>    JobQueue;
-  typedef std::vector<CWorkItem>   Processing;
-  typedef std::vector<CJobWorker*> Workers;
+  std::vector<std::unique_ptr<CWorkQueue>> m_queues;
+  std::array<std::atomic<size_t>, PRIORITIES> m_queued{};
+  std::atomic<size_t> m_processingCount{0};
+  std::atomic<bool> m_pauseJobs{false};
+
+  mutable CCriticalSection m_typeSection;
+  std::map<std::string, unsigned int, std::less<>> m_typeLimits;
+  std::map<std::string, unsigned int, std::less<>> m_typeProcessing;
+  std::atomic<bool> m_hasTypeLimits{false};
+
+  std::array<std::atomic<uint64_t>, PRIORITIES> m_started{};
+  std::array<std::atomic<uint64_t>, PRIORITIES> m_waitTotal{}; // microseconds
+  std::array<std::atomic<uint64_t>, PRIORITIES> m_waitMax{}; // microseconds
+  std::atomic<uint64_t> m_stolen{0};
 
-  JobQueue   m_jobQueue[CJob::PRIORITY_DEDICATED + 1];
-  bool       m_pauseJobs;
-  Processing m_processing;
   Workers    m_workers;
 
-  mutable CCriticalSection m_section;
+  mutable CCriticalSection m_section; // guards m_workers
   CEvent           m_jobEvent;
-  bool             m_running;
+  std::atomic<bool> m_running{true};
 };
@@ -13,13 +13,167 @@
 #include "utils/Utf8Utils.h"
 
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <stdlib.h>
 #include <string.h>
+#include <utility>
 
 int CRegExp::m_Utf8Supported = -1;
 int CRegExp::m_UcpSupported  = -1;
 int CRegExp::m_JitSupported  = -1;
 
+namespace
+{
+// room for the results of expressions with many subpatterns, only the first ones can be queried
+constexpr uint32_t MATCH_PAIRS = (CRegExp::m_MaxNumOfBackrefrences + 1) * 3;
+// enough for the expressions of the code and the settings, an evicted expression stays alive
+// as long as a CRegExp uses it
+constexpr size_t MAX_CACHED_PATTERNS = 512;
+
+/*!
+ * \brief Compiled expressions by expression and options, shared by all threads
+ *
+ * Filename parsers, label formatters and scanners compile the same expressions for each item.
+ */
+class CPatternCache
+{
+public:
+  std::shared_ptr<pcre2_code> Get(const std::string& pattern,
+                                  uint32_t options,
+                                  int& errCode,
+                                  PCRE2_SIZE& errOffset)
+  {
+    auto key = std::make_pair(pattern, options);
+    {
+      std::unique_lock lock(m_mutex);
+      const auto it = m_patterns.find(key);
+      if (it != m_patterns.end())
+      {
+        it->second.lastUse = ++m_uses;
+        return it->second.code;
+      }
+    }
+
+    // compile outside of the lock, another thread might compile the same expression meanwhile
+    std::shared_ptr<pcre2_code> code = Compile(pattern, options, errCode, errOffset);
+    if (!code)
+      return nullptr;
+
+    std::unique_lock lock(m_mutex);
+    if (m_patterns.size() >= MAX_CACHED_PATTERNS)
+    {
+      const auto oldest =
+          std::min_element(m_patterns.begin(), m_patterns.end(),
+                           [](const auto& a, const auto& b)
+                           { return a.second.lastUse < b.second.lastUse; });
+      m_patterns.erase(oldest);
+    }
+    const auto it = m_patterns.emplace(std::move(key), Entry{code, 0}).first;
+    it->second.lastUse = ++m_uses;
+    return it->second.code;
+  }
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<pcre2_code> code;
+    uint64_t lastUse;
+  };
+
+  static std::shared_ptr<pcre2_code> Compile(const std::string& pattern,
+                                             uint32_t options,
+                                             int& errCode,
+                                             PCRE2_SIZE& errOffset)
+  {
+    pcre2_compile_context* ctxt = pcre2_compile_context_create(nullptr);
+    pcre2_set_newline(ctxt, PCRE2_NEWLINE_ANY);
+    pcre2_code* re = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(pattern.c_str()), pattern.length(),
+                                   options, &errCode, &errOffset, ctxt);
+    pcre2_compile_context_free(ctxt);
+    if (!re)
+      return nullptr;
+
+    // the compiled code is used for many matches, the interpreter is used if JIT fails
+    if (CRegExp::IsJitSupported())
+      pcre2_jit_compile(re, PCRE2_JIT_COMPLETE);
+
+    return std::shared_ptr<pcre2_code>(re, pcre2_code_free);
+  }
+
+  std::mutex m_mutex;
+  std::map<std::pair<std::string, uint32_t>, Entry> m_patterns;
+  uint64_t m_uses = 0;
+};
+
+CPatternCache& GetPatternCache()
+{
+  static CPatternCache cache;
+  return cache;
+}
+
+/*!
+ * \brief Match data, context and JIT stack of a thread, reused by all of its matches
+ */
+class CMatchResources
+{
+public:
+  CMatchResources()
+    : m_matchData(pcre2_match_data_create(MATCH_PAIRS, nullptr)),
+      m_context(pcre2_match_context_create(nullptr))
+  {
+  }
+
+  ~CMatchResources()
+  {
+    pcre2_match_data_free(m_matchData);
+    pcre2_match_context_free(m_context);
+    if (m_jitStack)
+      pcre2_jit_stack_free(m_jitStack);
+  }
+
+  CMatchResources(const CMatchResources&) = delete;
+  CMatchResources& operator=(const CMatchResources&) = delete;
+
+  int Match(const pcre2_code* re, bool jitCompiled, const char* subject, size_t length)
+  {
+    if (jitCompiled && !m_jitStackCreated)
+    {
+      m_jitStackCreated = true;
+      m_jitStack = pcre2_jit_stack_create(32 * 1024, 512 * 1024, nullptr);
+      if (m_jitStack == nullptr)
+        CLog::Log(LOGWARNING, "{}: can't allocate address space for JIT stack", __FUNCTION__);
+
+      pcre2_jit_stack_assign(m_context, nullptr, m_jitStack);
+    }
+
+    return pcre2_match(re, reinterpret_cast<PCRE2_SPTR>(subject), length, 0, 0, m_matchData,
+                       m_context);
+  }
+
+  const PCRE2_SIZE* GetOvector() const { return pcre2_get_ovector_pointer(m_matchData); }
+  PCRE2_SIZE GetStartChar() const { return pcre2_get_startchar(m_matchData); }
+
+private:
+  pcre2_match_data* m_matchData;
+  pcre2_match_context* m_context;
+  pcre2_jit_stack* m_jitStack = nullptr;
+  bool m_jitStackCreated = false;
+};
+
+CMatchResources& GetMatchResources()
+{
+  thread_local CMatchResources resources;
+  return resources;
+}
+
+bool IsJitCompiled(const pcre2_code* re)
+{
+  size_t jitSize = 0;
+  return pcre2_pattern_info(re, PCRE2_INFO_JITSIZE, &jitSize) == 0 && jitSize > 0;
+}
+} // unnamed namespace
+
 
 CRegExp::CRegExp(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly*/)
 {
@@ -29,8 +183,7 @@ CRegExp::CRegExp(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly
 void CRegExp::InitValues(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= asciiOnly*/)
 {
   m_utf8Mode    = utf8;
-  m_re          = NULL;
-  m_ctxt = nullptr;
+  m_re.reset();
   m_iOptions = PCRE2_DOTALL;
   if(caseless)
     m_iOptions |= PCRE2_CASELESS;
@@ -46,9 +199,7 @@ void CRegExp::InitValues(bool caseless /*= false*/, CRegExp::utf8Mode utf8 /*= a
   m_jitCompiled = false;
   m_bMatched    = false;
   m_iMatchCount = 0;
-  m_matchData = nullptr;
-  m_iOvector = nullptr;
-  m_jitStack = NULL;
+  std::fill(std::begin(m_iOvector), std::end(m_iOvector), 0);
 }
 
 CRegExp::CRegExp(bool caseless, CRegExp::utf8Mode utf8, const char *re, studyMode study /*= NoStudy*/)
@@ -201,51 +352,6 @@ bool CRegExp::isCharClassWithUnicode(const std::string& regexp, size_t& pos)
 }
 
 
-CRegExp::CRegExp(const CRegExp& re)
-{
-  m_re = NULL;
-  m_ctxt = nullptr;
-  m_matchData = nullptr;
-  m_iOvector = nullptr;
-  m_jitStack = NULL;
-  m_utf8Mode = re.m_utf8Mode;
-  m_iOptions = re.m_iOptions;
-  *this = re;
-}
-
-CRegExp& CRegExp::operator=(const CRegExp& re)
-{
-  size_t size;
-  Cleanup();
-  m_jitCompiled = false;
-  m_pattern = re.m_pattern;
-  if (re.m_re)
-  {
-    if (pcre2_pattern_info(re.m_re, PCRE2_INFO_SIZE, &size) >= 0)
-    {
-      if ((m_re = pcre2_code_copy(re.m_re)))
-      {
-        if (re.m_ctxt)
-          m_ctxt = pcre2_match_context_copy(re.m_ctxt);
-        m_iOvector = re.m_iOvector;
-        m_offset = re.m_offset;
-        m_iMatchCount = re.m_iMatchCount;
-        m_bMatched = re.m_bMatched;
-        m_subject = re.m_subject;
-        m_iOptions = re.m_iOptions;
-      }
-      else
-        CLog::Log(LOGFATAL, "{}: Failed to allocate memory", __FUNCTION__);
-    }
-  }
-  return *this;
-}
-
-CRegExp::~CRegExp()
-{
-  Cleanup();
-}
-
 bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
 {
   if (!re)
@@ -255,7 +361,6 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
   m_jitCompiled      = false;
   m_bMatched         = false;
   m_iMatchCount      = 0;
-  pcre2_compile_context* ctxt;
   int errCode;
   char errMsg[120];
   PCRE2_SIZE errOffset;
@@ -266,11 +371,7 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
 
   Cleanup();
 
-  ctxt = pcre2_compile_context_create(NULL);
-  pcre2_set_newline(ctxt, PCRE2_NEWLINE_ANY);
-  m_re = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(re), PCRE2_ZERO_TERMINATED, options, &errCode,
-                       &errOffset, ctxt);
-  pcre2_compile_context_free(ctxt);
+  m_re = GetPatternCache().Get(re, options, errCode, errOffset);
 
   if (!m_re)
   {
@@ -282,18 +383,7 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
   }
 
   m_pattern = re;
-
-  if (study)
-  {
-    const bool jitCompile = (study == StudyWithJitComp) && IsJitSupported();
-    if (jitCompile)
-    {
-      pcre2_jit_compile(m_re, PCRE2_JIT_COMPLETE);
-      size_t jitPresent = 0;
-      m_jitCompiled =
-          (pcre2_pattern_info(m_re, PCRE2_INFO_JITSIZE, &jitPresent) == 0 && jitPresent > 0);
-    }
-  }
+  m_jitCompiled = IsJitCompiled(m_re.get());
 
   return true;
 }
@@ -329,28 +419,14 @@ int CRegExp::PrivateRegFind(size_t bufferLen, const char *str, unsigned int star
     return -1;
   }
 
-  if (!m_ctxt)
-    m_ctxt = pcre2_match_context_create(NULL);
-
-  if (m_jitCompiled && !m_jitStack)
-  {
-    m_jitStack = pcre2_jit_stack_create(32 * 1024, 512 * 1024, NULL);
-    if (m_jitStack == NULL)
-      CLog::Log(LOGWARNING, "{}: can't allocate address space for JIT stack", __FUNCTION__);
-
-    pcre2_jit_stack_assign(m_ctxt, NULL, m_jitStack);
-  }
-
   if (maxNumberOfCharsToTest >= 0)
     bufferLen = std::min<size_t>(bufferLen, startoffset + maxNumberOfCharsToTest);
 
   m_subject.assign(str + startoffset, bufferLen - startoffset);
-  if (m_matchData == nullptr)
-    m_matchData = pcre2_match_data_create(OVECCOUNT, nullptr);
-  int rc = pcre2_match(m_re, reinterpret_cast<PCRE2_SPTR>(m_subject.c_str()), m_subject.length(), 0,
-                       0, m_matchData, m_ctxt);
-  m_iOvector = pcre2_get_ovector_pointer(m_matchData);
-  offset = pcre2_get_startchar(m_matchData);
+  CMatchResources& resources = GetMatchResources();
+  int rc = resources.Match(m_re.get(), m_jitCompiled, m_subject.c_str(), m_subject.length());
+  const PCRE2_SIZE* ovector = resources.GetOvector();
+  offset = resources.GetStartChar();
 
   if (rc<1)
   {
@@ -400,12 +476,12 @@ int CRegExp::PrivateRegFind(size_t bufferLen, const char *str, unsigned int star
         char errbuf[120];
 
         pcre2_get_error_message(rc, reinterpret_cast<PCRE2_UCHAR*>(errbuf), sizeof(errbuf));
-        const size_t startPos = (m_iOvector[0] > fragmentLen) ? CUtf8Utils::RFindValidUtf8Char(m_subject, m_iOvector[0] - fragmentLen) : 0;
-        if ((int)m_iOvector[0] >= 0 && startPos != std::string::npos)
+        const size_t startPos = (ovector[0] > fragmentLen) ? CUtf8Utils::RFindValidUtf8Char(m_subject, ovector[0] - fragmentLen) : 0;
+        if ((int)ovector[0] >= 0 && startPos != std::string::npos)
           CLog::Log(LOGERROR,
                     "PCRE: Bad UTF-8 character, error code: {}, position: {}. Text before bad "
                     "char: \"{}\"",
-                    errbuf, offset, m_subject.substr(startPos, m_iOvector[0] - startPos + 1));
+                    errbuf, offset, m_subject.substr(startPos, ovector[0] - startPos + 1));
         else
           CLog::Log(LOGERROR, "PCRE: Bad UTF-8 character, error code: {}, position: {}", errbuf,
                     offset);
@@ -420,6 +496,10 @@ int CRegExp::PrivateRegFind(size_t bufferLen, const char *str, unsigned int star
         return -1;
     }
   }
+  // the match data belongs to the thread, keep what can be queried
+  const int pairs = std::min(rc + 1, m_MaxNumOfBackrefrences + 1);
+  std::copy(ovector, ovector + pairs * 2, m_iOvector);
+
   m_offset = startoffset;
   m_bMatched = true;
   m_iMatchCount = rc;
@@ -430,7 +510,7 @@ int CRegExp::GetCaptureTotal() const
 {
   int c = -1;
   if (m_re)
-    pcre2_pattern_info(m_re, PCRE2_INFO_CAPTURECOUNT, &c);
+    pcre2_pattern_info(m_re.get(), PCRE2_INFO_CAPTURECOUNT, &c);
   return c;
 }
 
@@ -519,7 +599,8 @@ void CRegExp::DumpOvector(int iLog /* = LOGDEBUG */)
     return;
 
   std::string str = "{";
-  int size = GetSubCount(); // past the subpatterns is junk
+  // past the subpatterns is junk, only the first ones are kept
+  int size = std::min(GetSubCount(), static_cast<int>(m_MaxNumOfBackrefrences));
   for (int i = 0; i <= size; i++)
   {
     std::string t = StringUtils::Format("[{},{}]", m_iOvector[(i * 2)], m_iOvector[(i * 2) + 1]);
@@ -533,29 +614,7 @@ void CRegExp::DumpOvector(int iLog /* = LOGDEBUG */)
 
 void CRegExp::Cleanup()
 {
-  if (m_re)
-  {
-    pcre2_code_free(m_re);
-    m_re = nullptr;
-  }
-
-  if (m_ctxt)
-  {
-    pcre2_match_context_free(m_ctxt);
-    m_ctxt = nullptr;
-  }
-
-  if (m_jitStack)
-  {
-    pcre2_jit_stack_free(m_jitStack);
-    m_jitStack = NULL;
-  }
-
-  if (m_matchData)
-  {
-    pcre2_match_data_free(m_matchData);
-    m_matchData = nullptr;
-  }
+  m_re.reset();
 }
 
 inline bool CRegExp::IsValidSubNumber(int iSub) const
@@ -626,3 +685,28 @@ bool CRegExp::IsJitSupported(void)
 
   return m_JitSupported == 1;
 }
+
+std::vector<int> CRegExp::FindFirstMatching(const std::vector<CRegExp>& expressions,
+                                            const std::vector<std::string>& strings)
+{
+  CMatchResources& resources = GetMatchResources();
+
+  std::vector<int> result(strings.size(), -1);
+  for (size_t i = 0; i < strings.size(); i++)
+  {
+    for (size_t j = 0; j < expressions.size(); j++)
+    {
+      const CRegExp& expression = expressions[j];
+      if (!expression.m_re)
+        continue;
+
+      if (resources.Match(expression.m_re.get(), expression.m_jitCompiled, strings[i].c_str(),
+                          strings[i].length()) >= 0)
+      {
+        result[i] = static_cast<int>(j);
+        break;
+      }
+    }
+  }
+  return result;
+}
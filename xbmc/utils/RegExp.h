@@ -10,17 +10,24 @@
 
 //! @todo - move to std::regex (after switching to gcc 4.9 or higher) and get rid of CRegExp
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
 
+/*!
+ * Compiled expressions are shared by all CRegExp objects using the same expression and options and
+ * JIT-compiled if possible, so compiling an expression again is a lookup. Matches use data kept per
+ * thread.
+ */
 class CRegExp
 {
 public:
   enum studyMode
   {
+    // expressions are always JIT-compiled if possible, the modes are kept for compatibility
     NoStudy          = 0, // do not study expression
     StudyRegExp      = 1, // study expression (slower compilation, faster find)
     StudyWithJitComp      // study expression and JIT-compile it, if possible (heavyweight optimization)
@@ -52,8 +59,8 @@ public:
    */
   CRegExp(bool caseless, utf8Mode utf8, const char *re, studyMode study = NoStudy);
 
-  CRegExp(const CRegExp& re);
-  ~CRegExp();
+  CRegExp(const CRegExp& re) = default;
+  ~CRegExp() = default;
 
   /**
    * Compile (prepare) regular expression
@@ -114,12 +121,23 @@ public:
    */
   inline bool IsCompiled(void) const
   { return !m_pattern.empty(); }
-  CRegExp& operator= (const CRegExp& re);
+  CRegExp& operator=(const CRegExp& re) = default;
   static bool IsUtf8Supported(void);
   static bool AreUnicodePropertiesSupported(void);
   static bool LogCheckUtf8Support(void);
   static bool IsJitSupported(void);
 
+  /**
+   * Find the first of a set of regular expressions matching each of many strings, e.g. exclude
+   * expressions and the files of a directory, without keeping any match in the CRegExp objects
+   * @param expressions The compiled regular expressions, tried in order
+   * @param strings     The strings to match against the regular expressions
+   * @return For each string the index of the first regular expression found in it, -1 if none is
+   *         or matching failed
+   */
+  static std::vector<int> FindFirstMatching(const std::vector<CRegExp>& expressions,
+                                            const std::vector<std::string>& strings);
+
 private:
   int PrivateRegFind(size_t bufferLen, const char *str, unsigned int startoffset = 0, int maxNumberOfCharsToTest = -1);
   void InitValues(bool caseless = false, CRegExp::utf8Mode utf8 = asciiOnly);
@@ -130,18 +148,14 @@ private:
   void Cleanup();
   inline bool IsValidSubNumber(int iSub) const;
 
-  pcre2_code* m_re;
-  pcre2_match_context* m_ctxt;
-  static const int OVECCOUNT=(m_MaxNumOfBackrefrences + 1) * 3;
+  std::shared_ptr<pcre2_code> m_re;
   unsigned int m_offset;
-  pcre2_match_data* m_matchData;
-  PCRE2_SIZE* m_iOvector;
+  PCRE2_SIZE m_iOvector[(m_MaxNumOfBackrefrences + 1) * 2];
   utf8Mode    m_utf8Mode;
   int         m_iMatchCount;
   uint32_t m_iOptions;
   bool        m_jitCompiled;
   bool        m_bMatched;
-  pcre2_jit_stack* m_jitStack;
   std::string m_subject;
   std::string m_pattern;
   static int  m_Utf8Supported;
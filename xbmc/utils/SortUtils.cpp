@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 
 std::string ArrayToString(SortAttribute attributes, const CVariant &variant, const std::string &separator = " / ")
 {
@@ -991,41 +992,24 @@ void SortUtils::GetFieldsForSQLSort(const MediaType& mediaType,
 
 void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, DatabaseResults& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
 {
-  if (sortBy != SortByNone)
-  {
-    // get the matching SortPreparator
-    SortPreparator preparator = getPreparator(sortBy);
-    if (preparator != NULL)
-    {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (DatabaseResults::iterator item = items.begin(); item != items.end(); ++item)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (Fields::const_iterator field = sortingFields.begin(); field != sortingFields.end(); ++field)
-        {
-          if (!item->contains(*field))
-            item->insert(std::pair<Field, CVariant>(*field, CVariant::ConstNullVariant));
-        }
+  SortDescription sorting;
+  sorting.sortBy = sortBy;
+  sorting.sortOrder = sortOrder;
+  sorting.sortAttributes = attributes;
+  sorting.limitEnd = limitEnd;
+  sorting.limitStart = limitStart;
 
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, *item), sortLabel, false);
-        item->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
-      }
+  const SortedIndices sorted = SortIndices(sorting, items.size(),
+                                           [&items](size_t index, SortItem&) -> SortItem&
+                                           { return items[index]; });
 
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
-    }
-  }
+  // move the results into their new order
+  DatabaseResults sortedItems;
+  sortedItems.reserve(sorted.order.size());
+  for (size_t index : sorted.order)
+    sortedItems.emplace_back(std::move(items[index]));
 
-  if (limitStart > 0 && (size_t)limitStart < items.size())
-  {
-    items.erase(items.begin(), items.begin() + limitStart);
-    limitEnd -= limitStart;
-  }
-  if (limitEnd > 0 && (size_t)limitEnd < items.size())
-    items.erase(items.begin() + limitEnd, items.end());
+  items = std::move(sortedItems);
 }
 
 void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, SortItems& items, int limitEnd /* = -1 */, int limitStart /* = 0 */)
@@ -1077,6 +1061,99 @@ void SortUtils::Sort(const SortDescription &sortDescription, SortItems& items)
   Sort(sortDescription.sortBy, sortDescription.sortOrder, sortDescription.sortAttributes, items, sortDescription.limitEnd, sortDescription.limitStart);
 }
 
+std::wstring_view SortUtils::SortedIndices::GetSortLabel(size_t index) const
+{
+  if (index + 1 >= labelOffsets.size())
+    return {};
+
+  return std::wstring_view(labels).substr(labelOffsets[index],
+                                          labelOffsets[index + 1] - labelOffsets[index]);
+}
+
+SortUtils::SortedIndices SortUtils::SortIndices(const SortDescription& sortDescription,
+                                                size_t count,
+                                                const SortItemGetter& getItem)
+{
+  SortedIndices result;
+  result.order.resize(count);
+  std::iota(result.order.begin(), result.order.end(), 0);
+
+  const SortPreparator preparator =
+      sortDescription.sortBy != SortByNone ? getPreparator(sortDescription.sortBy) : nullptr;
+  if (preparator != nullptr)
+  {
+    const SortAttribute attributes = sortDescription.sortAttributes;
+    const Fields& sortingFields = GetFieldsForSorting(sortDescription.sortBy);
+
+    // the keys preliminarySort() looks at, folder is -1 if the item doesn't say
+    std::vector<SortSpecial> special(count, SortSpecialNone);
+    std::vector<int8_t> folder(count, -1);
+    result.labelOffsets.reserve(count + 1);
+    result.labelOffsets.emplace_back(0);
+
+    SortItem scratch;
+    std::wstring label;
+    for (size_t index = 0; index < count; ++index)
+    {
+      // keep the nodes of the previous item around, only its values have to go. This has to be
+      // a plain null, a ConstNullVariant can't be assigned to anymore.
+      for (auto& value : scratch)
+        value.second = CVariant();
+
+      SortItem& item = getItem(index, scratch);
+
+      // add all fields to the item that are required for sorting if they are currently missing
+      for (const auto& field : sortingFields)
+        item.try_emplace(field);
+
+      label.clear();
+      g_charsetConverter.utf8ToW(preparator(attributes, item), label, false);
+      result.labels.append(label);
+      result.labelOffsets.emplace_back(result.labels.size());
+
+      auto it = item.find(FieldSortSpecial);
+      if (it != item.end() && it->second.asInteger() <= static_cast<int64_t>(SortSpecialOnBottom))
+        special[index] = static_cast<SortSpecial>(it->second.asInteger());
+      it = item.find(FieldFolder);
+      if (it != item.end())
+        folder[index] = it->second.asBoolean() ? 1 : 0;
+    }
+
+    // same rules as preliminarySort() and the Sorter* functions
+    const bool handleFolder = !(attributes & SortAttributeIgnoreFolders);
+    const bool descending = sortDescription.sortOrder == SortOrderDescending;
+    std::stable_sort(result.order.begin(), result.order.end(),
+                     [&](size_t left, size_t right)
+                     {
+                       if (special[left] != special[right])
+                         return special[left] == SortSpecialOnTop ||
+                                special[right] == SortSpecialOnBottom;
+                       if (special[left] != SortSpecialNone)
+                         return false;
+
+                       if (handleFolder && folder[left] >= 0 && folder[right] >= 0 &&
+                           folder[left] != folder[right])
+                         return folder[left] > 0;
+
+                       const int64_t compare = StringUtils::AlphaNumericCompare(
+                           result.GetSortLabel(left), result.GetSortLabel(right));
+                       return descending ? compare > 0 : compare < 0;
+                     });
+  }
+
+  int limitEnd = sortDescription.limitEnd;
+  if (sortDescription.limitStart > 0 &&
+      static_cast<size_t>(sortDescription.limitStart) < result.order.size())
+  {
+    result.order.erase(result.order.begin(), result.order.begin() + sortDescription.limitStart);
+    limitEnd -= sortDescription.limitStart;
+  }
+  if (limitEnd > 0 && static_cast<size_t>(limitEnd) < result.order.size())
+    result.order.erase(result.order.begin() + limitEnd, result.order.end());
+
+  return result;
+}
+
 bool SortUtils::SortFromDataset(const SortDescription& sortDescription,
                                 const MediaType& mediaType,
                                 dbiplus::Dataset& dataset,
@@ -1110,14 +1187,6 @@ const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
   return m_preparators[SortByNone];
 }
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrderDescending ? SorterIgnoreFoldersDescending : SorterIgnoreFoldersAscending;
-
-  return sortOrder == SortOrderDescending ? SorterDescending : SorterAscending;
-}
-
 SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
 {
   if (attributes & SortAttributeIgnoreFolders)
@@ -11,9 +11,11 @@
 #include "DatabaseUtils.h"
 #include "LabelFormatter.h"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 enum class SortMethod;
@@ -216,6 +218,39 @@ public:
   static void Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, SortItems& items, int limitEnd = -1, int limitStart = 0);
   static void Sort(const SortDescription &sortDescription, DatabaseResults& items);
   static void Sort(const SortDescription &sortDescription, SortItems& items);
+
+  /*! \brief Result of SortIndices(), the sort order of a list and the prepared sort labels.
+   */
+  struct SortedIndices
+  {
+    std::vector<size_t> order; //!< item indices in sorted order with the limits applied
+    std::wstring labels; //!< sort labels of all items back to back
+    std::vector<size_t> labelOffsets; //!< start of each item's label in labels, plus the end
+
+    /*! \brief Sort label of the item at the given (unsorted) index, empty if nothing was sorted.
+     */
+    std::wstring_view GetSortLabel(size_t index) const;
+  };
+
+  /*! \brief Called by SortIndices() once per item to get its sortable values.
+   The passed SortItem is reused for all items, values of a previous item are reset to null.
+   Either fill and return it or return a SortItem owned by the caller.
+   */
+  using SortItemGetter = std::function<SortItem&(size_t index, SortItem& scratch)>;
+
+  /*! \brief Sort count items without touching the items themselves.
+   The sort label, special sort flag and folder flag of every item are extracted once into
+   contiguous columns and only an index array is sorted, so comparisons neither look up fields
+   nor copy strings. Produces the same order as Sort().
+   \param sortDescription how to sort, limits are applied to the returned order
+   \param count number of items
+   \param getItem provides the sortable values of an item, see SortItemGetter
+   \return the sorted indices and the sort labels by original index
+   */
+  static SortedIndices SortIndices(const SortDescription& sortDescription,
+                                   size_t count,
+                                   const SortItemGetter& getItem);
+
   static bool SortFromDataset(const SortDescription& sortDescription,
                               const MediaType& mediaType,
                               dbiplus::Dataset& dataset,
@@ -231,7 +266,6 @@ public:
 
 private:
   static const SortPreparator& getPreparator(SortBy sortBy);
-  static Sorter getSorter(SortOrder sortOrder, SortAttribute attributes);
   static SorterIndirect getSorterIndirect(SortOrder sortOrder, SortAttribute attributes);
 
   static std::map<SortBy, SortPreparator> m_preparators;
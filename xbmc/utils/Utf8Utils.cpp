@@ -8,6 +8,13 @@
 
 #include "Utf8Utils.h"
 
+#include <bit>
+#include <cstring>
+#include <stdint.h>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 {
@@ -18,6 +25,10 @@ CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 
   while (pos < len)
   {
+    pos += SizeOfAsciiPrefix(strC + pos, len - pos);
+    if (pos == len)
+      break;
+
     const size_t chrLen = SizeOfUtf8Char(strC + pos);
     if (chrLen == 0)
       return hiAscii; // non valid UTF-8 sequence
@@ -71,6 +82,41 @@ size_t CUtf8Utils::RFindValidUtf8Char(const std::string& str, const size_t start
   return std::string::npos;
 }
 
+size_t CUtf8Utils::SizeOfAsciiPrefix(const char* str, size_t len)
+{
+  size_t pos = 0;
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; pos + 16 <= len; pos += 16)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+    // one bit for each byte with the high bit set
+    const int highBits = _mm_movemask_epi8(chunk);
+    if (highBits)
+      return pos + std::countr_zero(static_cast<unsigned int>(highBits));
+  }
+#else
+  for (; pos + 8 <= len; pos += 8)
+  {
+    uint64_t chunk;
+    std::memcpy(&chunk, str + pos, sizeof(chunk));
+    chunk &= UINT64_C(0x8080808080808080);
+    if (chunk)
+    {
+      if constexpr (std::endian::native == std::endian::little)
+        return pos + std::countr_zero(chunk) / 8;
+      else
+        return pos + std::countl_zero(chunk) / 8;
+    }
+  }
+#endif
+
+  while (pos < len && !(str[pos] & 0x80))
+    pos++;
+
+  return pos;
+}
+
 inline size_t CUtf8Utils::SizeOfUtf8Char(const std::string& str, const size_t charStart /*= 0*/)
 {
   if (charStart >= str.length())
@@ -37,6 +37,14 @@ public:
   static size_t RFindValidUtf8Char(const std::string& str, const size_t startPos);
 
   static size_t SizeOfUtf8Char(const std::string& str, const size_t charStart = 0);
+
+  /**
+   * Get the length of the US-ASCII run at the start of given buffer
+   * @param str buffer to check, doesn't need to be null-terminated
+   * @param len length of the buffer
+   * @return number of leading US-ASCII characters, "len" if buffer is US-ASCII only
+   */
+  static size_t SizeOfAsciiPrefix(const char* str, size_t len);
 private:
   static size_t SizeOfUtf8Char(const char* const str);
 };
@@ -18,6 +18,7 @@
 #include "settings/SettingsContainer.h"
 #include "settings/lib/Setting.h"
 #include "settings/lib/SettingsManager.h"
+#include "utils/AsyncLogSink.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 
@@ -116,13 +117,15 @@ void CLog::Initialize(const std::string& path)
       file.Write(Utf8Bom, sizeof(Utf8Bom));
   }
 
-  // create the file sink within a duplicate filter sink
+  // create the file sink within a duplicate filter sink, messages are formatted by the sink
+  // in between, which can move writing them to a thread of its own
   auto duplicateFilterSink =
       std::make_shared<spdlog::sinks::dup_filter_sink_st>(std::chrono::seconds(10));
   auto basicFileSink = std::make_shared<spdlog::sinks::basic_file_sink_st>(
       m_platform->GetLogFilename(filePath), false);
-  basicFileSink->set_pattern(LogPattern);
-  duplicateFilterSink->add_sink(basicFileSink);
+  m_asyncSink = std::make_shared<CAsyncLogSink>(basicFileSink);
+  m_asyncSink->set_pattern(LogPattern);
+  duplicateFilterSink->add_sink(m_asyncSink);
   m_fileSink = duplicateFilterSink;
 
   // add it to the existing sinks
@@ -150,9 +153,26 @@ void CLog::Deinitialize()
   // flush the file sink
   m_fileSink->flush();
 
-  // remove and destroy the file sink
+  // remove and destroy the file sink, which writes whatever is still queued
   m_sinks->remove_sink(m_fileSink);
   m_fileSink.reset();
+  m_asyncSink.reset();
+}
+
+void CLog::SetAsync(bool async, size_t queueSize, LogOverflowPolicy policy)
+{
+  if (m_asyncSink == nullptr)
+    return;
+
+  m_asyncSink->SetAsync(async, queueSize, policy);
+}
+
+uint64_t CLog::GetDroppedMessages() const
+{
+  if (m_asyncSink == nullptr)
+    return 0;
+
+  return m_asyncSink->GetDroppedMessages();
 }
 
 void CLog::SetLogLevel(int level)
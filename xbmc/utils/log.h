@@ -31,6 +31,7 @@
 #include "utils/logtypes.h"
 
 #include <source_location>
+#include <stdint.h>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,8 @@ template<typename Mutex>
 class dist_sink;
 } // namespace spdlog::sinks
 
+class CAsyncLogSink;
+
 #if FMT_VERSION >= 100000
 using fmt::enums::format_as;
 
@@ -73,6 +76,14 @@ public:
   void Deinitialize();
 
   void SetLogLevel(int level);
+  /*!
+   * \brief Write the log file on a thread of its own instead of the logging threads.
+   * \param async whether to write the log file asynchronously
+   * \param queueSize the number of messages that can wait to be written
+   * \param policy what happens to a message logged while the queue is full
+   */
+  void SetAsync(bool async, size_t queueSize, LogOverflowPolicy policy);
+  uint64_t GetDroppedMessages() const;
   int GetLogLevel() const { return m_logLevel; }
   bool IsLogLevelLogged(int loglevel) const;
 
@@ -144,6 +155,7 @@ private:
   Logger m_defaultLogger;
 
   std::shared_ptr<spdlog::sinks::sink> m_fileSink;
+  std::shared_ptr<CAsyncLogSink> m_asyncSink;
 
   int m_logLevel{LOG_LEVEL_DEBUG};
 
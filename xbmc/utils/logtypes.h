@@ -16,3 +16,12 @@ class logger;
 }
 
 using Logger = std::shared_ptr<spdlog::logger>;
+
+/*!
+ * \brief What happens to a message logged while the queue of the asynchronous log file is full.
+ */
+enum class LogOverflowPolicy
+{
+  DROP, ///< the message is dropped and counted
+  BLOCK, ///< the logging thread waits until the message can be queued
+};
@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/Event.h"
+#include "utils/ActorProtocol.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+using namespace Actor;
+using namespace std::chrono_literals;
+
+namespace
+{
+struct Payload
+{
+  int64_t pts;
+  int index;
+};
+
+// send and receive on one thread, the cost of the message itself
+void BM_SendOutMessage(benchmark::State& state)
+{
+  Protocol port("bench");
+  const Payload data{1000, 1};
+  Message* msg;
+
+  for (auto _ : state)
+  {
+    port.SendOutMessage(1, &data, sizeof(data));
+    port.ReceiveOutMessage(&msg);
+    msg->Release();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SendOutMessage);
+
+void BM_SendOutMessagePayload(benchmark::State& state)
+{
+  Protocol port("bench");
+  Payload data{1000, 1};
+  Message* msg;
+
+  for (auto _ : state)
+  {
+    port.SendOutMessage(1, new CPayloadWrap<Payload>(data));
+    port.ReceiveOutMessage(&msg);
+    msg->Release();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SendOutMessagePayload);
+
+// throughput with an actor thread receiving, like the ActiveAE control port
+void BM_SendOutMessageThroughput(benchmark::State& state)
+{
+  CEvent outEvent;
+  Protocol port("bench", nullptr, &outEvent);
+  std::atomic<bool> stop{false};
+
+  std::thread actor([&]() {
+    Message* msg;
+    while (!stop)
+    {
+      if (port.ReceiveOutMessage(&msg))
+        msg->Release();
+      else
+        outEvent.Wait(1ms);
+    }
+    port.Purge();
+  });
+
+  const Payload data{1000, 1};
+  for (auto _ : state)
+    port.SendOutMessage(1, &data, sizeof(data));
+
+  stop = true;
+  outEvent.Set();
+  actor.join();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SendOutMessageThroughput)->UseRealTime();
+
+// round trip latency of a sync message answered by an actor thread
+void BM_SendOutMessageSync(benchmark::State& state)
+{
+  CEvent outEvent;
+  Protocol port("bench", nullptr, &outEvent);
+  std::atomic<bool> stop{false};
+
+  std::thread actor([&]() {
+    Message* msg;
+    while (!stop)
+    {
+      if (port.ReceiveOutMessage(&msg))
+      {
+        msg->Reply(2);
+        msg->Release();
+      }
+      else
+        outEvent.Wait(1ms);
+    }
+  });
+
+  const Payload data{1000, 1};
+  Message* reply;
+  for (auto _ : state)
+  {
+    if (port.SendOutMessageSync(1, &reply, 1s, &data, sizeof(data)))
+      reply->Release();
+  }
+
+  stop = true;
+  outEvent.Set();
+  actor.join();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SendOutMessageSync)->UseRealTime();
+} // namespace
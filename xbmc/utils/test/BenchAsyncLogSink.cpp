@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/SpecialProtocol.h"
+#include "utils/AsyncLogSink.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/dist_sink.h>
+#include <spdlog/sinks/dup_filter_sink.h>
+
+namespace
+{
+// the sink chain CLog sets up for the log file
+struct LogFile
+{
+  explicit LogFile(bool async, LogOverflowPolicy policy)
+    : path(CSpecialProtocol::TranslatePath("special://temp/BenchAsyncLogSink.log"))
+  {
+    auto basicFileSink = std::make_shared<spdlog::sinks::basic_file_sink_st>(path, true);
+    sink = std::make_shared<CAsyncLogSink>(basicFileSink);
+    sink->SetAsync(async, 4096, policy);
+    auto duplicateFilterSink =
+        std::make_shared<spdlog::sinks::dup_filter_sink_st>(std::chrono::seconds(10));
+    duplicateFilterSink->add_sink(sink);
+    auto sinks = std::make_shared<spdlog::sinks::dist_sink_mt>();
+    sinks->add_sink(duplicateFilterSink);
+
+    logger = std::make_unique<spdlog::logger>("general", sinks);
+    logger->set_pattern("%Y-%m-%d %T.%e T:%-5t %7l <%n>: %v");
+    logger->set_level(spdlog::level::trace);
+    logger->flush_on(spdlog::level::debug);
+  }
+
+  ~LogFile()
+  {
+    logger.reset();
+    sink.reset();
+    std::remove(path.c_str());
+  }
+
+  std::string path;
+  std::shared_ptr<CAsyncLogSink> sink;
+  std::unique_ptr<spdlog::logger> logger;
+};
+
+std::unique_ptr<LogFile> logFile;
+
+// time spent in a log call by the logging threads, e.g. the render or audio thread
+void BM_LogCall(benchmark::State& state, bool async, LogOverflowPolicy policy)
+{
+  if (state.thread_index() == 0)
+    logFile = std::make_unique<LogFile>(async, policy);
+
+  int64_t i = 0;
+  for (auto _ : state)
+    logFile->logger->debug("CVideoPlayer::Process - frame {} of thread {} presented", i++,
+                           state.thread_index());
+
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0)
+  {
+    state.counters["dropped"] = static_cast<double>(logFile->sink->GetDroppedMessages());
+    logFile.reset();
+  }
+}
+BENCHMARK_CAPTURE(BM_LogCall, sync, false, LogOverflowPolicy::BLOCK)->Threads(1)->Threads(4);
+BENCHMARK_CAPTURE(BM_LogCall, async_block, true, LogOverflowPolicy::BLOCK)->Threads(1)->Threads(4);
+BENCHMARK_CAPTURE(BM_LogCall, async_drop, true, LogOverflowPolicy::DROP)->Threads(1)->Threads(4);
+} // namespace
@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/CharsetConverter.h"
+#include "utils/Utf8Utils.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string& GetUtf8Text()
+{
+  static const std::string text = []() {
+    std::string text;
+    while (text.size() < 4096)
+      text += "Amélie – Le Fabuleux Destin · 天空の城ラピュタ · Ёжик в тумане / ";
+    return text;
+  }();
+  return text;
+}
+
+const std::string& GetAsciiText()
+{
+  static const std::string text = []() {
+    std::string text;
+    while (text.size() < 4096)
+      text += "The.Fabulous.Destiny.of.Amelie.Poulain.2001.1080p.BluRay.x264.mkv / ";
+    return text;
+  }();
+  return text;
+}
+
+// a typical label, converted by the GUI fonts whenever it changes
+const std::string LABEL = "Recently added movies";
+
+void BM_CharsetUtf8ToUtf32(benchmark::State& state)
+{
+  const std::string& text = GetUtf8Text();
+  for (auto _ : state)
+  {
+    std::u32string result;
+    CCharsetConverter::utf8ToUtf32(text, result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_CharsetUtf8ToUtf32);
+
+void BM_CharsetUtf8ToUtf32Ascii(benchmark::State& state)
+{
+  const std::string& text = GetAsciiText();
+  for (auto _ : state)
+  {
+    std::u32string result;
+    CCharsetConverter::utf8ToUtf32(text, result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_CharsetUtf8ToUtf32Ascii);
+
+void BM_CharsetUtf8ToUtf32Label(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::u32string result;
+    CCharsetConverter::utf8ToUtf32Visual(LABEL, result);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_CharsetUtf8ToUtf32Label);
+
+void BM_CharsetUtf32ToUtf8(benchmark::State& state)
+{
+  std::u32string utf32;
+  CCharsetConverter::utf8ToUtf32(GetUtf8Text(), utf32);
+  for (auto _ : state)
+  {
+    std::string result;
+    CCharsetConverter::utf32ToUtf8(utf32, result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * utf32.size());
+}
+BENCHMARK(BM_CharsetUtf32ToUtf8);
+
+void BM_CharsetUtf8ToW(benchmark::State& state)
+{
+  const std::string& text = GetUtf8Text();
+  for (auto _ : state)
+  {
+    std::wstring result;
+    CCharsetConverter::utf8ToW(text, result, false);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_CharsetUtf8ToW);
+
+void BM_CharsetWToUtf8(benchmark::State& state)
+{
+  std::wstring wide;
+  CCharsetConverter::utf8ToW(GetUtf8Text(), wide, false);
+  for (auto _ : state)
+  {
+    std::string result;
+    CCharsetConverter::wToUTF8(wide, result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * wide.size());
+}
+BENCHMARK(BM_CharsetWToUtf8);
+
+void BM_CharsetCheckStrForUtf8(benchmark::State& state)
+{
+  const std::string& text = GetAsciiText();
+  for (auto _ : state)
+    benchmark::DoNotOptimize(CUtf8Utils::checkStrForUtf8(text));
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_CharsetCheckStrForUtf8);
+} // namespace
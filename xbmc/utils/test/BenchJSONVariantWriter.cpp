@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// roughly the shape of a VideoLibrary.GetMovies response
+CVariant MakeMovies(int count)
+{
+  CVariant movies(CVariant::VariantTypeArray);
+  for (int i = 0; i < count; ++i)
+  {
+    CVariant movie(CVariant::VariantTypeObject);
+    movie["movieid"] = i;
+    movie["label"] = "Movie " + std::to_string(i);
+    movie["year"] = 1980 + i % 40;
+    movie["rating"] = 6.5 + (i % 30) / 10.0;
+    movie["file"] = "/storage/movies/Movie " + std::to_string(i) + ".mkv";
+    movie["plot"] = "A \"quoted\" plot\nspanning two lines of text for movie " + std::to_string(i);
+    movie["genre"].push_back("Drama");
+    movie["genre"].push_back("Thriller");
+    movies.push_back(movie);
+  }
+  return movies;
+}
+
+void BM_JSONWrite(benchmark::State& state)
+{
+  const CVariant movies = MakeMovies(state.range(0));
+  for (auto _ : state)
+  {
+    std::string json;
+    CJSONVariantWriter::Write(movies, json, true);
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JSONWrite)->Arg(100)->Arg(5000);
+
+// what the web server does with a response, 64 KiB at a time
+void BM_JSONStream(benchmark::State& state)
+{
+  const CVariant movies = MakeMovies(state.range(0));
+  std::vector<char> buffer(64 * 1024);
+  for (auto _ : state)
+  {
+    CJSONVariantStreamWriter writer(movies, true);
+    while (writer.Read(buffer.data(), buffer.size()) == buffer.size())
+      ;
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JSONStream)->Arg(100)->Arg(5000);
+} // namespace
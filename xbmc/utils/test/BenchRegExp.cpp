@@ -0,0 +1,163 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/RegExp.h"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// one of the default tvshowmatching expressions from AdvancedSettings
+constexpr const char* EPISODE_REGEXP = "s([0-9]+)[ ._x-]*e([0-9]+(?:(?:[a-i]|\\.[1-9])(?![0-9]))?)";
+const std::string FILENAME = "/storage/tv/Some.Show.2019.S02E05.1080p.WEB-DL.x264.mkv";
+
+// the default tvshowmatching expressions
+const std::vector<std::string> EPISODE_REGEXPS = {
+    "s([0-9]+)[ ._x-]*e([0-9]+(?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([^\\\\/]*)$",
+    "[\\._ -]?()e(?:p[ ._-]?)?([0-9]+(?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([^\\\\/]*)$",
+    "([0-9]{4})[\\.-]([0-9]{2})[\\.-]([0-9]{2})",
+    "([0-9]{2})[\\.-]([0-9]{2})[\\.-]([0-9]{4})",
+    "[\\\\/\\._ \\[\\(-]([0-9]+)x([0-9]+(?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([^\\\\/]*)$",
+    "[\\/._ -]p(?:ar)?t[_. -]()([ivx]+|[0-9]+)([._ -][^\\/]*)$",
+    "[\\\\/]([^\\\\/]+)\\.special\\.[a-z0-9]+$",
+    "[\\\\/\\._ -]([0-9]+)([0-9][0-9](?:(?:[a-i]|\\.[1-9])(?![0-9]))?)([\\._ -][^\\\\/]*)$",
+};
+
+// typical excludefromscan expressions
+const std::vector<std::string> EXCLUDE_REGEXPS = {
+    "-trailer", "[!-._ \\\\/]sample[-._ \\\\/]", "[\\/]extrathumbs[\\/]", "\\.nfo$",
+};
+
+constexpr int CORPUS_SIZE = 100000;
+
+// filenames of a large library, most of them episodes, some dated and some not matching at all
+const std::vector<std::string>& GetCorpus()
+{
+  static const std::vector<std::string> corpus = []
+  {
+    std::vector<std::string> names;
+    names.reserve(CORPUS_SIZE);
+    for (int i = 0; i < CORPUS_SIZE; ++i)
+    {
+      const std::string show = "Show " + std::to_string(i % 500);
+      switch (i % 4)
+      {
+        case 0:
+          names.push_back("/storage/tv/" + show + "/Season 1/" + show + ".S01E" +
+                          std::to_string(i % 24) + ".1080p.WEB-DL.x264.mkv");
+          break;
+        case 1:
+          names.push_back("/storage/tv/" + show + "/" + show + " 2x" + std::to_string(i % 24) +
+                          " - Title.avi");
+          break;
+        case 2:
+          names.push_back("/storage/tv/" + show + "/" + show + ".2019.05." +
+                          std::to_string(10 + i % 18) + ".mp4");
+          break;
+        default:
+          names.push_back("/storage/movies/Movie " + std::to_string(i) + " (2001)/movie.mkv");
+          break;
+      }
+    }
+    return names;
+  }();
+  return corpus;
+}
+
+void BM_RegExpCompile(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    CRegExp reg(true, CRegExp::autoUtf8);
+    benchmark::DoNotOptimize(reg.RegComp(EPISODE_REGEXP));
+  }
+}
+BENCHMARK(BM_RegExpCompile);
+
+void BM_RegExpFind(benchmark::State& state)
+{
+  CRegExp reg(true, CRegExp::autoUtf8);
+  reg.RegComp(EPISODE_REGEXP);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(reg.RegFind(FILENAME));
+    std::string season = reg.GetMatch(1);
+    benchmark::DoNotOptimize(season);
+  }
+}
+BENCHMARK(BM_RegExpFind);
+
+// what the scanner does for each file: compile each expression until one matches
+void BM_RegExpEpisodeCorpus(benchmark::State& state)
+{
+  const std::vector<std::string>& corpus = GetCorpus();
+  for (auto _ : state)
+  {
+    int matched = 0;
+    for (const auto& name : corpus)
+    {
+      for (const auto& expression : EPISODE_REGEXPS)
+      {
+        CRegExp reg(true, CRegExp::autoUtf8);
+        if (reg.RegComp(expression) && reg.RegFind(name) >= 0)
+        {
+          matched++;
+          break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(matched);
+  }
+  state.SetItemsProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_RegExpEpisodeCorpus)->Unit(benchmark::kMillisecond);
+
+// excluding files one by one, with the expressions compiled once
+void BM_RegExpExcludeCorpus(benchmark::State& state)
+{
+  const std::vector<std::string>& corpus = GetCorpus();
+  VECCREGEXP expressions;
+  for (const auto& expression : EXCLUDE_REGEXPS)
+    expressions.emplace_back(true, CRegExp::autoUtf8, expression.c_str());
+
+  for (auto _ : state)
+  {
+    int excluded = 0;
+    for (const auto& name : corpus)
+    {
+      for (auto& expression : expressions)
+      {
+        if (expression.RegFind(name) >= 0)
+        {
+          excluded++;
+          break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(excluded);
+  }
+  state.SetItemsProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_RegExpExcludeCorpus)->Unit(benchmark::kMillisecond);
+
+void BM_RegExpExcludeCorpusBatch(benchmark::State& state)
+{
+  const std::vector<std::string>& corpus = GetCorpus();
+  VECCREGEXP expressions;
+  for (const auto& expression : EXCLUDE_REGEXPS)
+    expressions.emplace_back(true, CRegExp::autoUtf8, expression.c_str());
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(CRegExp::FindFirstMatching(expressions, corpus));
+  state.SetItemsProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_RegExpExcludeCorpusBatch)->Unit(benchmark::kMillisecond);
+} // namespace
@@ -0,0 +1,34 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/RingBuffer.h"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+void BM_RingBufferWriteRead(benchmark::State& state)
+{
+  const unsigned int chunk = static_cast<unsigned int>(state.range(0));
+  CRingBuffer buffer;
+  buffer.Create(chunk * 8 + 1);
+  std::vector<char> in(chunk, 'x');
+  std::vector<char> out(chunk);
+
+  for (auto _ : state)
+  {
+    buffer.WriteData(in.data(), chunk);
+    buffer.ReadData(out.data(), chunk);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * chunk);
+}
+BENCHMARK(BM_RingBufferWriteRead)->Arg(188)->Arg(64 * 1024);
+} // namespace
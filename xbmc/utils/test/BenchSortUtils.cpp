@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SortUtils.h"
+#include "utils/Variant.h"
+
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// items as CFileItemList::Sort hands them to SortUtils for a large library listing
+SortItems MakeItems(int count)
+{
+  std::mt19937 random(42);
+  SortItems items;
+  items.reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    auto item = std::make_shared<SortItem>();
+    (*item)[FieldLabel] = "The Movie " + std::to_string(random() % 100000);
+    (*item)[FieldYear] = static_cast<int>(1950 + random() % 75);
+    (*item)[FieldRating] = (random() % 100) / 10.0;
+    items.push_back(item);
+  }
+  return items;
+}
+
+void BM_SortUtils(benchmark::State& state, SortBy sortBy, SortAttribute attributes)
+{
+  const SortItems source = MakeItems(state.range(0));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems items = source;
+    state.ResumeTiming();
+    SortUtils::Sort(sortBy, SortOrderAscending, attributes, items);
+    benchmark::DoNotOptimize(items);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_SortUtils, Label, SortByLabel, SortAttributeNone)->Arg(1000)->Arg(20000);
+BENCHMARK_CAPTURE(BM_SortUtils, LabelIgnoreArticle, SortByLabel, SortAttributeIgnoreArticle)
+    ->Arg(20000);
+BENCHMARK_CAPTURE(BM_SortUtils, Year, SortByYear, SortAttributeNone)->Arg(20000);
+BENCHMARK_CAPTURE(BM_SortUtils, Rating, SortByRating, SortAttributeNone)->Arg(20000);
+
+// the same listings through the column based path CFileItemList::Sort uses
+void BM_SortIndices(benchmark::State& state, SortBy sortBy, SortAttribute attributes)
+{
+  const SortItems source = MakeItems(state.range(0));
+  SortDescription sorting;
+  sorting.sortBy = sortBy;
+  sorting.sortAttributes = attributes;
+  for (auto _ : state)
+  {
+    const SortUtils::SortedIndices sorted = SortUtils::SortIndices(
+        sorting, source.size(), [&source](size_t index, SortItem& scratch) -> SortItem&
+        {
+          for (const auto& value : *source[index])
+            scratch[value.first] = value.second;
+          return scratch;
+        });
+    benchmark::DoNotOptimize(sorted.order.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_SortIndices, Label, SortByLabel, SortAttributeNone)->Arg(1000)->Arg(20000);
+BENCHMARK_CAPTURE(BM_SortIndices, LabelIgnoreArticle, SortByLabel, SortAttributeIgnoreArticle)
+    ->Arg(20000);
+BENCHMARK_CAPTURE(BM_SortIndices, Year, SortByYear, SortAttributeNone)->Arg(20000);
+BENCHMARK_CAPTURE(BM_SortIndices, Rating, SortByRating, SortAttributeNone)->Arg(20000);
+} // namespace
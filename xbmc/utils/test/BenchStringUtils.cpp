@@ -0,0 +1,55 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+void BM_StringUtilsFormat(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string result =
+        StringUtils::Format("{} - {:02}x{:02} - {} ({:.1f})", "Show", 3, 12, "Episode title", 8.5);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_StringUtilsFormat);
+
+void BM_StringUtilsSplit(benchmark::State& state)
+{
+  std::string input;
+  for (int i = 0; i < state.range(0); ++i)
+    input += "Genre" + std::to_string(i) + " / ";
+
+  for (auto _ : state)
+  {
+    std::vector<std::string> result = StringUtils::Split(input, " / ");
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_StringUtilsSplit)->Arg(8)->Arg(512);
+
+void BM_StringUtilsToLower(benchmark::State& state)
+{
+  const std::string input(state.range(0), 'K');
+  for (auto _ : state)
+  {
+    std::string result = input;
+    StringUtils::ToLower(result);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_StringUtilsToLower)->Arg(32)->Arg(4096);
+} // namespace
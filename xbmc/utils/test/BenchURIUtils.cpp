@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/URIUtils.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string PATH = "smb://nas/media/TV Shows/Some Show (2019)/Season 02/Some Show S02E05.mkv";
+
+void BM_URIUtilsGetParentPath(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string result = URIUtils::GetParentPath(PATH);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_URIUtilsGetParentPath);
+
+void BM_URIUtilsGetFileName(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string result = URIUtils::GetFileName(PATH);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_URIUtilsGetFileName);
+
+void BM_URIUtilsGetExtension(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string result = URIUtils::GetExtension(PATH);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_URIUtilsGetExtension);
+
+void BM_URIUtilsAddFileToFolder(benchmark::State& state)
+{
+  const std::string folder = URIUtils::GetDirectory(PATH);
+  for (auto _ : state)
+  {
+    std::string result = URIUtils::AddFileToFolder(folder, "extrafanart", "fanart1.jpg");
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_URIUtilsAddFileToFolder);
+
+void BM_URIUtilsIsInternetStream(benchmark::State& state)
+{
+  const std::string url = "https://example.com/stream/playlist.m3u8";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(URIUtils::IsInternetStream(url));
+}
+BENCHMARK(BM_URIUtilsIsInternetStream);
+} // namespace
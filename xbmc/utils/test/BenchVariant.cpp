@@ -0,0 +1,63 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// roughly the shape of a VideoLibrary.GetMovies response
+CVariant MakeMovies(int count)
+{
+  CVariant movies(CVariant::VariantTypeArray);
+  for (int i = 0; i < count; ++i)
+  {
+    CVariant movie(CVariant::VariantTypeObject);
+    movie["movieid"] = i;
+    movie["label"] = "Movie " + std::to_string(i);
+    movie["year"] = 1980 + i % 40;
+    movie["rating"] = 6.5 + (i % 30) / 10.0;
+    movie["file"] = "/storage/movies/Movie " + std::to_string(i) + ".mkv";
+    movie["genre"].push_back("Drama");
+    movie["genre"].push_back("Thriller");
+    movies.push_back(movie);
+  }
+  return movies;
+}
+
+void BM_VariantConstruct(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    CVariant movies = MakeMovies(state.range(0));
+    benchmark::DoNotOptimize(movies);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VariantConstruct)->Arg(100)->Arg(5000);
+
+void BM_VariantJsonRoundTrip(benchmark::State& state)
+{
+  const CVariant movies = MakeMovies(state.range(0));
+  for (auto _ : state)
+  {
+    std::string json;
+    CJSONVariantWriter::Write(movies, json, true);
+    CVariant parsed;
+    CJSONVariantParser::Parse(json, parsed);
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VariantJsonRoundTrip)->Arg(100)->Arg(5000);
+} // namespace
@@ -0,0 +1,43 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/XBMCTinyXML2.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// an nfo sized document, with the repeated elements of a long cast list
+std::string MakeNfo(int actors)
+{
+  std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\n"
+                    "<movie><title>Movie</title><year>2001</year><plot>A plot.</plot>";
+  for (int i = 0; i < actors; ++i)
+  {
+    xml += "<actor><name>Actor " + std::to_string(i) + "</name><role>Role</role><order>" +
+           std::to_string(i) + "</order><thumb>https://image.example.com/" + std::to_string(i) +
+           ".jpg</thumb></actor>";
+  }
+  xml += "</movie>";
+  return xml;
+}
+
+void BM_XBMCTinyXML2Parse(benchmark::State& state)
+{
+  const std::string xml = MakeNfo(state.range(0));
+  for (auto _ : state)
+  {
+    CXBMCTinyXML2 doc;
+    benchmark::DoNotOptimize(doc.Parse(xml));
+  }
+  state.SetBytesProcessed(state.iterations() * xml.size());
+}
+BENCHMARK(BM_XBMCTinyXML2Parse)->Arg(10)->Arg(200);
+} // namespace
@@ -0,0 +1,186 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/Event.h"
+#include "utils/ActorProtocol.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Actor;
+using namespace std::chrono_literals;
+
+TEST(TestActorProtocol, KeepsSendOrder)
+{
+  Protocol port("test");
+  for (int i = 0; i < 10; i++)
+    port.SendOutMessage(i);
+  port.SendInMessage(42);
+
+  Message* msg;
+  for (int i = 0; i < 10; i++)
+  {
+    ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+    EXPECT_EQ(i, msg->signal);
+    EXPECT_TRUE(msg->isOut);
+    msg->Release();
+  }
+  EXPECT_FALSE(port.ReceiveOutMessage(&msg));
+
+  ASSERT_TRUE(port.ReceiveInMessage(&msg));
+  EXPECT_EQ(42, msg->signal);
+  EXPECT_FALSE(msg->isOut);
+  msg->Release();
+}
+
+TEST(TestActorProtocol, Data)
+{
+  Protocol port("test");
+  const int small = 1234;
+  const std::vector<char> large(1000, 'x');
+  port.SendOutMessage(1, &small, sizeof(small));
+  port.SendOutMessage(2, large.data(), large.size());
+
+  Message* msg;
+  ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+  EXPECT_EQ(small, *reinterpret_cast<int*>(msg->data));
+  msg->Release();
+
+  ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+  EXPECT_EQ(large, std::vector<char>(msg->data, msg->data + large.size()));
+  msg->Release();
+}
+
+TEST(TestActorProtocol, Payload)
+{
+  Protocol port("test");
+  std::string text("payload");
+  port.SendOutMessage(1, new CPayloadWrap<std::string>(text));
+  port.SendOutMessage(2, new CPayloadWrap<std::string>(new std::string("owned")));
+
+  Message* msg;
+  ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+  auto* payload = dynamic_cast<CPayloadWrap<std::string>*>(msg->payloadObj.get());
+  ASSERT_NE(nullptr, payload);
+  EXPECT_EQ("payload", *payload->GetPlayload());
+  msg->Release();
+
+  ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+  payload = dynamic_cast<CPayloadWrap<std::string>*>(msg->payloadObj.get());
+  ASSERT_NE(nullptr, payload);
+  EXPECT_EQ("owned", *payload->GetPlayload());
+  msg->Release();
+}
+
+TEST(TestActorProtocol, PurgeOut)
+{
+  Protocol port("test");
+  for (int i = 0; i < 6; i++)
+    port.SendOutMessage(i % 2);
+  port.PurgeOut(0);
+
+  Message* msg;
+  for (int i = 0; i < 3; i++)
+  {
+    ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+    EXPECT_EQ(1, msg->signal);
+    msg->Release();
+  }
+  EXPECT_FALSE(port.ReceiveOutMessage(&msg));
+
+  // the queue must still take new messages at its end
+  port.SendOutMessage(7);
+  ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+  EXPECT_EQ(7, msg->signal);
+  msg->Release();
+}
+
+TEST(TestActorProtocol, Defer)
+{
+  Protocol port("test");
+  port.SendOutMessage(1);
+  port.DeferOut(true);
+
+  Message* msg;
+  EXPECT_FALSE(port.ReceiveOutMessage(&msg));
+  port.DeferOut(false);
+  ASSERT_TRUE(port.ReceiveOutMessage(&msg));
+  msg->Release();
+}
+
+TEST(TestActorProtocol, SendOutMessageSync)
+{
+  CEvent outEvent;
+  Protocol port("test", nullptr, &outEvent);
+
+  std::thread actor([&port, &outEvent]() {
+    for (int replies = 0; replies < 100;)
+    {
+      Message* msg;
+      if (!port.ReceiveOutMessage(&msg))
+      {
+        outEvent.Wait(10ms);
+        continue;
+      }
+      int value = *reinterpret_cast<int*>(msg->data) * 2;
+      msg->Reply(msg->signal + 1, &value, sizeof(value));
+      msg->Release();
+      replies++;
+    }
+  });
+
+  for (int i = 0; i < 100; i++)
+  {
+    Message* reply = nullptr;
+    ASSERT_TRUE(port.SendOutMessageSync(i, &reply, 5s, &i, sizeof(i)));
+    ASSERT_NE(nullptr, reply);
+    EXPECT_EQ(i + 1, reply->signal);
+    EXPECT_EQ(i * 2, *reinterpret_cast<int*>(reply->data));
+    reply->Release();
+  }
+
+  actor.join();
+}
+
+TEST(TestActorProtocol, ConcurrentSenders)
+{
+  Protocol port("test");
+  constexpr int SENDERS = 4;
+  constexpr int MESSAGES = 10000;
+
+  std::vector<std::thread> senders;
+  for (int sender = 0; sender < SENDERS; sender++)
+  {
+    senders.emplace_back([&port, sender]() {
+      for (int i = 0; i < MESSAGES; i++)
+        port.SendOutMessage(sender, &i, sizeof(i));
+    });
+  }
+
+  // messages of each sender arrive in order
+  std::vector<int> next(SENDERS, 0);
+  int received = 0;
+  while (received < SENDERS * MESSAGES)
+  {
+    Message* msg;
+    if (!port.ReceiveOutMessage(&msg))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    EXPECT_EQ(next[msg->signal]++, *reinterpret_cast<int*>(msg->data));
+    msg->Release();
+    received++;
+  }
+
+  for (auto& sender : senders)
+    sender.join();
+}
@@ -0,0 +1,216 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/AsyncLogSink.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <spdlog/logger.h>
+
+namespace
+{
+// collects the messages it gets, holding up the first one until it's released
+class CBlockingSink : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+  void WaitForFirst()
+  {
+    std::unique_lock lock(m_blockMutex);
+    m_condition.wait(lock, [this] { return m_entered; });
+  }
+
+  void Release()
+  {
+    std::unique_lock lock(m_blockMutex);
+    m_released = true;
+    m_condition.notify_all();
+  }
+
+  std::string GetOutput()
+  {
+    std::unique_lock lock(mutex_);
+    return m_output.str();
+  }
+
+protected:
+  void sink_it_(const spdlog::details::log_msg& msg) override
+  {
+    {
+      std::unique_lock lock(m_blockMutex);
+      m_entered = true;
+      m_condition.notify_all();
+      m_condition.wait(lock, [this] { return m_released; });
+    }
+
+    spdlog::memory_buf_t buffer;
+    formatter_->format(msg, buffer);
+    m_output.write(buffer.data(), buffer.size());
+  }
+
+  void flush_() override {}
+
+private:
+  std::ostringstream m_output;
+  std::mutex m_blockMutex;
+  std::condition_variable m_condition;
+  bool m_entered = false;
+  bool m_released = false;
+};
+
+// collects the messages it gets, failing to write those containing "fail" and to flush
+class CThrowingSink : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+  std::string GetOutput()
+  {
+    std::unique_lock lock(mutex_);
+    return m_output.str();
+  }
+
+protected:
+  void sink_it_(const spdlog::details::log_msg& msg) override
+  {
+    spdlog::memory_buf_t buffer;
+    formatter_->format(msg, buffer);
+    const std::string message(buffer.data(), buffer.size());
+    if (message.find("fail") != std::string::npos)
+      throw spdlog::spdlog_ex("write failed");
+    m_output << message;
+  }
+
+  void flush_() override { throw spdlog::spdlog_ex("flush failed"); }
+
+private:
+  std::ostringstream m_output;
+};
+} // namespace
+
+class TestAsyncLogSink : public testing::Test
+{
+protected:
+  TestAsyncLogSink()
+    : m_target(std::make_shared<CBlockingSink>()),
+      m_sink(std::make_shared<CAsyncLogSink>(m_target)),
+      m_logger("test", m_sink)
+  {
+    m_sink->set_pattern("%l %v");
+  }
+
+  std::shared_ptr<CBlockingSink> m_target;
+  std::shared_ptr<CAsyncLogSink> m_sink;
+  spdlog::logger m_logger;
+};
+
+TEST_F(TestAsyncLogSink, WritesSynchronously)
+{
+  m_target->Release();
+  m_logger.info("first");
+  m_logger.warn("second");
+  EXPECT_EQ("info first\nwarning second\n", m_target->GetOutput());
+}
+
+TEST_F(TestAsyncLogSink, WritesEverythingInOrder)
+{
+  m_target->Release();
+  m_sink->SetAsync(true, 16, LogOverflowPolicy::BLOCK);
+
+  std::string expected;
+  for (int i = 0; i < 1000; i++)
+  {
+    m_logger.info("message {}", i);
+    expected += "info message " + std::to_string(i) + "\n";
+  }
+
+  // switching back writes whatever is still queued
+  m_sink->SetAsync(false, 16, LogOverflowPolicy::BLOCK);
+  EXPECT_EQ(expected, m_target->GetOutput());
+  EXPECT_EQ(0u, m_sink->GetDroppedMessages());
+}
+
+TEST_F(TestAsyncLogSink, DropsWhenFull)
+{
+  m_sink->SetAsync(true, 4, LogOverflowPolicy::DROP);
+
+  // the writer thread is stuck writing the first message
+  m_logger.info("first");
+  m_target->WaitForFirst();
+
+  for (int i = 0; i < 10; i++)
+    m_logger.info("message {}", i);
+  EXPECT_EQ(6u, m_sink->GetDroppedMessages());
+
+  m_target->Release();
+  m_sink->SetAsync(false, 4, LogOverflowPolicy::DROP);
+  m_logger.info("last");
+
+  EXPECT_EQ("info first\n"
+            "info message 0\n"
+            "info message 1\n"
+            "info message 2\n"
+            "info message 3\n"
+            "warning 6 messages were dropped, the log queue was full or not writable\n"
+            "info last\n",
+            m_target->GetOutput());
+}
+
+TEST_F(TestAsyncLogSink, BlocksWhenFull)
+{
+  m_sink->SetAsync(true, 4, LogOverflowPolicy::BLOCK);
+
+  m_logger.info("first");
+  m_target->WaitForFirst();
+
+  std::thread logger(
+      [this]
+      {
+        for (int i = 0; i < 10; i++)
+          m_logger.info("message {}", i);
+      });
+
+  m_target->Release();
+  logger.join();
+  m_sink->SetAsync(false, 4, LogOverflowPolicy::BLOCK);
+
+  std::string expected = "info first\n";
+  for (int i = 0; i < 10; i++)
+    expected += "info message " + std::to_string(i) + "\n";
+  EXPECT_EQ(expected, m_target->GetOutput());
+  EXPECT_EQ(0u, m_sink->GetDroppedMessages());
+}
+
+TEST(TestAsyncLogSinkTarget, KeepsWritingWhenTargetThrows)
+{
+  auto target = std::make_shared<CThrowingSink>();
+  auto sink = std::make_shared<CAsyncLogSink>(target);
+  spdlog::logger logger("test", sink);
+  sink->set_pattern("%l %v");
+  sink->SetAsync(true, 4, LogOverflowPolicy::BLOCK);
+
+  // more messages than the queue holds, so logging blocks on a writer thread that has to go on
+  std::string expected;
+  for (int i = 0; i < 20; i++)
+  {
+    if (i % 5 == 0)
+    {
+      logger.info("fail {}", i);
+      continue;
+    }
+    logger.info("message {}", i);
+    expected += "info message " + std::to_string(i) + "\n";
+  }
+
+  sink->SetAsync(false, 4, LogOverflowPolicy::BLOCK);
+  EXPECT_EQ(expected, target->GetOutput());
+  EXPECT_EQ(4u, sink->GetDroppedMessages());
+}
@@ -12,6 +12,11 @@
 #include "utils/CharsetConverter.h"
 #include "utils/Utf8Utils.h"
 
+#include <bit>
+#include <random>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #if 0
@@ -399,3 +404,191 @@ TEST_F(TestCharsetConverter, fromW)
   g_charsetConverter.fromW(refstrw1, varstra1, "UTF-16LE");
   EXPECT_STREQ(refstra1.c_str(), varstra1.c_str());
 }
+
+namespace
+{
+// UTF-32 in the byte order of char32_t, as used by utf8ToUtf32()
+const std::string UTF32_CHARSET =
+    std::endian::native == std::endian::little ? "UTF-32LE" : "UTF-32BE";
+
+// random text mixing ASCII runs and characters of every UTF-8 length, some of them broken
+std::string GetRandomUtf8(std::mt19937& random, bool broken)
+{
+  static const std::vector<std::string> pieces = {
+      "a",
+      "Some ASCII text longer than a vector register",
+      "\t\r\n",
+      std::string(1, '\0'),
+      "\xC3\xA9",
+      "\xD0\x81",
+      "\xE2\x80\x93",
+      "\xE5\xA4\xA9",
+      "\xEF\xBB\xBF",
+      "\xEF\xBF\xBF",
+      "\xF0\x9F\x90\xAD",
+      "\xF4\x8F\xBF\xBF",
+  };
+  // stray and truncated sequences, overlong forms, surrogates, code points above U+10FFFF
+  static const std::vector<std::string> brokenPieces = {
+      "\x80",
+      "\xBF",
+      "\xFE",
+      "\xFF",
+      "\xC3",
+      "\xE2\x80",
+      "\xF0\x9F\x90",
+      "\xC0\xAF",
+      "\xC1\xBF",
+      "\xE0\x9F\xBF",
+      "\xF0\x8F\xBF\xBF",
+      "\xED\xA0\x80",
+      "\xED\xBF\xBF",
+      "\xF4\x90\x80\x80",
+      "\xF5\x80\x80\x80",
+  };
+
+  std::string text;
+  const int count = std::uniform_int_distribution<int>(0, 40)(random);
+  for (int i = 0; i < count; i++)
+  {
+    if (broken && std::uniform_int_distribution<int>(0, 9)(random) == 0)
+      text += brokenPieces[random() % brokenPieces.size()];
+    else
+      text += pieces[random() % pieces.size()];
+  }
+  return text;
+}
+
+// random code points but null, some of them surrogates or out of the Unicode range
+std::u32string GetRandomUtf32(std::mt19937& random, bool broken)
+{
+  std::u32string text;
+  const int count = std::uniform_int_distribution<int>(0, 80)(random);
+  for (int i = 0; i < count; i++)
+  {
+    char32_t codePoint;
+    switch (random() % 4)
+    {
+      case 0:
+        codePoint = random() % 0x80;
+        break;
+      case 1:
+        codePoint = random() % 0x800;
+        break;
+      case 2:
+        codePoint = random() % 0x10000;
+        break;
+      default:
+        codePoint = random() % 0x110000;
+        break;
+    }
+    if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+      codePoint -= 0x800;
+    // a null at the end is kept in the output, which is tested separately
+    if (codePoint == 0)
+      codePoint = U' ';
+    if (broken && random() % 10 == 0)
+      codePoint = random() % 2 ? 0xD800 + random() % 0x800 : 0x110000 + random() % 0x1000;
+    text += codePoint;
+  }
+  return text;
+}
+} // namespace
+
+// conversions between Unicode encodings skip iconv when they can, compare with iconv
+TEST_F(TestCharsetConverter, utf8ToUtf32MatchesIconv)
+{
+  std::mt19937 random(4711);
+  for (int i = 0; i < 10000; i++)
+  {
+    const std::string text = GetRandomUtf8(random, i % 2);
+    std::u32string converted;
+    std::u32string expected;
+    EXPECT_EQ(CCharsetConverter::utf8To(UTF32_CHARSET, text, expected),
+              CCharsetConverter::utf8ToUtf32(text, converted, false));
+    EXPECT_EQ(expected, converted);
+  }
+}
+
+TEST_F(TestCharsetConverter, utf8ToWMatchesIconv)
+{
+  std::mt19937 random(4711);
+  for (int i = 0; i < 10000; i++)
+  {
+    const std::string text = GetRandomUtf8(random, i % 2);
+    std::wstring converted;
+    std::wstring expected;
+    EXPECT_EQ(CCharsetConverter::toW(text, expected, "UTF-8"),
+              CCharsetConverter::utf8ToW(text, converted, false, false, false));
+    EXPECT_EQ(expected, converted);
+  }
+}
+
+TEST_F(TestCharsetConverter, wToUTF8MatchesIconv)
+{
+  std::mt19937 random(4711);
+  for (int i = 0; i < 10000; i++)
+  {
+    std::wstring text;
+    CCharsetConverter::utf32ToW(GetRandomUtf32(random, false), text);
+    if (i % 2)
+    {
+      // lone surrogates, for UTF-16 as well
+      text.insert(random() % (text.size() + 1), 1, static_cast<wchar_t>(0xD800 + random() % 0x800));
+    }
+
+    std::string converted;
+    std::string expected;
+    EXPECT_EQ(CCharsetConverter::fromW(text, expected, "UTF-8"),
+              CCharsetConverter::wToUTF8(text, converted));
+    EXPECT_EQ(expected, converted);
+  }
+}
+
+TEST_F(TestCharsetConverter, utf32ToUtf8MatchesIconv)
+{
+  std::mt19937 random(4711);
+  for (int i = 0; i < 10000; i++)
+  {
+    const std::u32string text = GetRandomUtf32(random, false);
+    std::string converted;
+    EXPECT_TRUE(CCharsetConverter::utf32ToUtf8(text, converted, true));
+
+    // iconv has to give the text back
+    std::u32string decoded;
+    EXPECT_TRUE(CCharsetConverter::utf8To(UTF32_CHARSET, converted, decoded));
+    EXPECT_EQ(text, decoded);
+  }
+
+  for (int i = 0; i < 1000; i++)
+  {
+    std::u32string text = GetRandomUtf32(random, true);
+    text += U'\xD800';
+    std::string converted;
+    EXPECT_FALSE(CCharsetConverter::utf32ToUtf8(text, converted, true));
+    EXPECT_TRUE(converted.empty());
+  }
+}
+
+TEST_F(TestCharsetConverter, unicodeTrailingNull)
+{
+  std::u32string converted;
+  EXPECT_TRUE(CCharsetConverter::utf8ToUtf32(std::string("ab\0", 3), converted));
+  EXPECT_EQ(std::u32string(U"ab\0\0", 4), converted);
+
+  std::string convertedBack;
+  EXPECT_TRUE(CCharsetConverter::utf32ToUtf8(std::u32string(U"ab\0", 3), convertedBack));
+  EXPECT_EQ(std::string("ab\0\0", 4), convertedBack);
+}
+
+TEST_F(TestCharsetConverter, checkStrForUtf8)
+{
+  EXPECT_EQ(CUtf8Utils::plainAscii,
+            CUtf8Utils::checkStrForUtf8("ASCII text which is longer than a vector register"));
+  EXPECT_EQ(CUtf8Utils::utf8string,
+            CUtf8Utils::checkStrForUtf8("ASCII text which is longer than a vector \xC3\xA9"));
+  EXPECT_EQ(CUtf8Utils::hiAscii,
+            CUtf8Utils::checkStrForUtf8("ASCII text which is longer than a vector \xC3"));
+  EXPECT_EQ(CUtf8Utils::hiAscii,
+            CUtf8Utils::checkStrForUtf8("ASCII text which is longer than a vector \xED\xA0\x80"));
+}
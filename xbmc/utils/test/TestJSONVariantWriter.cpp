@@ -9,6 +9,9 @@
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 
+#include <cstring>
+#include <string>
+
 #include <gtest/gtest.h>
 
 TEST(TestJSONVariantWriter, CanWriteNull)
@@ -149,3 +152,86 @@ TEST(TestJSONVariantWriter, CanWriteArray)
   ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
   ASSERT_STREQ("[\n\t{\n\t\t\"foo\": \"bar\"\n\t}\n]", str.c_str());
 }
+
+TEST(TestJSONVariantWriter, CanWriteCompact)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  variant["foo"].push_back(1);
+  variant["foo"].push_back(2);
+  variant["bar"] = CVariant(CVariant::VariantTypeObject);
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, true));
+  ASSERT_STREQ("{\"bar\":{},\"foo\":[1,2]}", str.c_str());
+}
+
+TEST(TestJSONVariantWriter, CanEscapeString)
+{
+  CVariant variant("\"a\\b\"\n\t\x01\xc3\xa9");
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
+  ASSERT_STREQ("\"\\\"a\\\\b\\\"\\n\\t\\u0001\xc3\xa9\"", str.c_str());
+}
+
+TEST(TestJSONVariantWriter, FailsOnInvalidUtf8)
+{
+  std::string str = "unchanged";
+  ASSERT_FALSE(CJSONVariantWriter::Write(CVariant("\xc3"), str, false));
+  ASSERT_FALSE(CJSONVariantWriter::Write(CVariant("\xc0\xaf"), str, false));
+  ASSERT_FALSE(CJSONVariantWriter::Write(CVariant("\xed\xa0\x80"), str, false));
+
+  CVariant variant(CVariant::VariantTypeObject);
+  variant["\xff"] = "foo";
+  ASSERT_FALSE(CJSONVariantWriter::Write(variant, str, false));
+  ASSERT_STREQ("unchanged", str.c_str());
+}
+
+TEST(TestJSONVariantWriter, CanStream)
+{
+  CVariant variant(CVariant::VariantTypeArray);
+  for (int i = 0; i < 20; ++i)
+  {
+    CVariant item(CVariant::VariantTypeObject);
+    item["id"] = i;
+    item["label"] = "Item " + std::to_string(i);
+    item["rating"] = i / 4.0;
+    item["tags"].push_back("foo");
+    item["tags"].push_back(CVariant(CVariant::VariantTypeArray));
+    variant.push_back(item);
+  }
+
+  for (bool compact : {false, true})
+  {
+    std::string expected;
+    ASSERT_TRUE(CJSONVariantWriter::Write(variant, expected, compact));
+
+    for (size_t size : {1, 7, 64, 4096})
+    {
+      CJSONVariantStreamWriter writer(variant, compact);
+      std::string str;
+      std::string buffer(size, '\0');
+      size_t read;
+      do
+      {
+        read = writer.Read(buffer.data(), buffer.size());
+        str.append(buffer, 0, read);
+      } while (read == size);
+
+      EXPECT_TRUE(writer.IsDone());
+      EXPECT_FALSE(writer.HasFailed());
+      EXPECT_EQ(expected, str);
+    }
+  }
+}
+
+TEST(TestJSONVariantWriter, StreamFailsOnInvalidUtf8)
+{
+  CVariant variant(CVariant::VariantTypeArray);
+  variant.push_back("foo");
+  variant.push_back("\xc3");
+
+  CJSONVariantStreamWriter writer(variant, true);
+  char buffer[64];
+  ASSERT_EQ(std::strlen("[\"foo\""), writer.Read(buffer, sizeof(buffer)));
+  ASSERT_TRUE(writer.HasFailed());
+  ASSERT_EQ(0u, writer.Read(buffer, sizeof(buffer)));
+}
@@ -13,11 +13,13 @@
 #include "utils/XTimeUtils.h"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 #include <gtest/gtest.h>
 
 using namespace ConditionPoll;
+using namespace std::chrono_literals;
 
 struct Flags
 {
@@ -211,3 +213,79 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+namespace
+{
+class TypedJob : public DummyJob
+{
+public:
+  explicit TypedJob(Flags* flags) : DummyJob(flags) {}
+
+  const char* GetType() const override { return "TypedJob"; }
+};
+} // namespace
+
+TEST_F(TestJobManager, ConcurrencyLimit)
+{
+  Flags first;
+  Flags second;
+  CServiceBroker::GetJobManager()->SetConcurrencyLimit("TypedJob", 1);
+  CServiceBroker::GetJobManager()->AddJob(new TypedJob(&first), nullptr);
+  CServiceBroker::GetJobManager()->AddJob(new TypedJob(&second), nullptr);
+
+  ASSERT_TRUE(poll([&first]() -> bool { return first.started; }));
+
+  // the second job must wait for the first even though workers are free
+  KODI::TIME::Sleep(100ms);
+  EXPECT_FALSE(second.started);
+  EXPECT_EQ(1, CServiceBroker::GetJobManager()->IsProcessing("TypedJob"));
+
+  first.lingerAtWork = false;
+  ASSERT_TRUE(poll([&second]() -> bool { return second.started; }));
+  second.lingerAtWork = false;
+  ASSERT_TRUE(poll([&second]() -> bool { return second.finished; }));
+}
+
+TEST_F(TestJobManager, ConcurrencyLimitSetWhileProcessing)
+{
+  Flags unlimited;
+  Flags limited;
+  Flags waiting;
+  CServiceBroker::GetJobManager()->AddJob(new TypedJob(&unlimited), nullptr);
+  ASSERT_TRUE(poll([&unlimited]() -> bool { return unlimited.started; }));
+
+  // the running job didn't take a slot, so it mustn't give one back either
+  CServiceBroker::GetJobManager()->SetConcurrencyLimit("TypedJob", 1);
+  CServiceBroker::GetJobManager()->AddJob(new TypedJob(&limited), nullptr);
+  ASSERT_TRUE(poll([&limited]() -> bool { return limited.started; }));
+
+  unlimited.lingerAtWork = false;
+  ASSERT_TRUE(poll([&unlimited]() -> bool { return unlimited.finished; }));
+
+  CServiceBroker::GetJobManager()->AddJob(new TypedJob(&waiting), nullptr);
+  KODI::TIME::Sleep(100ms);
+  EXPECT_FALSE(waiting.started);
+
+  limited.lingerAtWork = false;
+  ASSERT_TRUE(poll([&waiting]() -> bool { return waiting.started; }));
+  waiting.lingerAtWork = false;
+  ASSERT_TRUE(poll([&waiting]() -> bool { return waiting.finished; }));
+}
+
+TEST_F(TestJobManager, Stats)
+{
+  Flags flags[3];
+  for (auto& flag : flags)
+    CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(&flag), nullptr,
+                                            CJob::PRIORITY_HIGH);
+
+  for (auto& flag : flags)
+    ASSERT_TRUE(poll([&flag]() -> bool { return flag.finished; }));
+
+  const CJobManager::Stats stats = CServiceBroker::GetJobManager()->GetStats();
+  EXPECT_EQ(3u, stats.started[CJob::PRIORITY_HIGH]);
+  EXPECT_EQ(0u, stats.queued[CJob::PRIORITY_HIGH]);
+  EXPECT_EQ(0u, stats.started[CJob::PRIORITY_LOW]);
+  EXPECT_LE(stats.meanWait[CJob::PRIORITY_HIGH], stats.maxWait[CJob::PRIORITY_HIGH]);
+  EXPECT_GE(stats.workers, 1u);
+}
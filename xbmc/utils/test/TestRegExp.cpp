@@ -129,6 +129,42 @@ TEST(TestRegExp, operatorEqual)
   EXPECT_EQ(0, regexcopy.RegFind("Test string."));
 }
 
+TEST(TestRegExp, CopyKeepsMatch)
+{
+  CRegExp regex;
+
+  EXPECT_TRUE(regex.RegComp("^(Test)\\s*(.*)\\."));
+  EXPECT_EQ(0, regex.RegFind("Test string."));
+  CRegExp regexcopy(regex);
+  EXPECT_EQ(0, regex.RegFind("Test other string."));
+  EXPECT_EQ("string", regexcopy.GetMatch(2));
+  EXPECT_EQ("other string", regex.GetMatch(2));
+}
+
+TEST(TestRegExp, SameExpression)
+{
+  CRegExp caseless(true), regex;
+
+  // compiled expressions are shared, but not across options
+  EXPECT_TRUE(caseless.RegComp("^test"));
+  EXPECT_TRUE(regex.RegComp("^test"));
+  EXPECT_EQ(0, caseless.RegFind("Test string."));
+  EXPECT_EQ(-1, regex.RegFind("Test string."));
+}
+
+TEST(TestRegExp, FindFirstMatching)
+{
+  VECCREGEXP expressions(3, CRegExp(true));
+  EXPECT_TRUE(expressions[0].RegComp("\\.nfo$"));
+  EXPECT_FALSE(expressions[1].RegComp("+"));
+  EXPECT_TRUE(expressions[2].RegComp("[-._ ]sample[-._ ]"));
+
+  const std::vector<std::string> strings = {"/movies/Movie.mkv", "/movies/Movie.NFO",
+                                            "/movies/Movie.sample.mkv", "/movies/Movie.sample.nfo"};
+  EXPECT_EQ(std::vector<int>({-1, 0, 2, 0}), CRegExp::FindFirstMatching(expressions, strings));
+  EXPECT_EQ(std::vector<int>({-1, -1, -1, -1}), CRegExp::FindFirstMatching({}, strings));
+}
+
 class TestRegExpLog : public testing::Test
 {
 protected:
@@ -103,6 +103,84 @@ TEST(TestSortUtils, Sort_SortDescription)
   EXPECT_STREQ("R Artist", (*items.at(6))[FieldArtist].asString().c_str());
 }
 
+TEST(TestSortUtils, SortIndices_MatchesSort)
+{
+  // labels with ties, folders and items forced to the top or bottom
+  std::vector<SortItem> values;
+  for (int i = 0; i < 60; i++)
+  {
+    SortItem item;
+    item[FieldLabel] = "Item " + std::to_string((i * 7) % 13);
+    item[FieldFolder] = i % 4 == 0;
+    item[FieldSortSpecial] = i % 11 == 0 ? SortSpecialOnTop
+                                         : (i % 17 == 0 ? SortSpecialOnBottom : SortSpecialNone);
+    if (i % 2 == 0)
+      item[FieldYear] = 2000 + i % 5;
+    item[FieldId] = i;
+    values.push_back(item);
+  }
+
+  for (SortBy sortBy : {SortByLabel, SortByYear})
+  {
+    for (SortOrder sortOrder : {SortOrderAscending, SortOrderDescending})
+    {
+      for (SortAttribute attributes : {SortAttributeNone, SortAttributeIgnoreFolders})
+      {
+        SortDescription desc;
+        desc.sortBy = sortBy;
+        desc.sortOrder = sortOrder;
+        desc.sortAttributes = attributes;
+        desc.limitStart = 2;
+        desc.limitEnd = 50;
+
+        SortItems items;
+        for (const auto& value : values)
+          items.push_back(std::make_shared<SortItem>(value));
+        SortUtils::Sort(desc, items);
+
+        // fill the reused SortItem like CFileItemList::Sort does
+        const SortUtils::SortedIndices sorted = SortUtils::SortIndices(
+            desc, values.size(), [&values](size_t index, SortItem& scratch) -> SortItem&
+            {
+              for (const auto& value : values[index])
+                scratch[value.first] = value.second;
+              return scratch;
+            });
+
+        ASSERT_EQ(items.size(), sorted.order.size());
+        for (size_t i = 0; i < items.size(); i++)
+        {
+          EXPECT_EQ((*items[i])[FieldId].asInteger(), static_cast<int64_t>(sorted.order[i]));
+          EXPECT_EQ((*items[i])[FieldSort].asWideString(), sorted.GetSortLabel(sorted.order[i]));
+        }
+      }
+    }
+  }
+}
+
+TEST(TestSortUtils, Sort_DatabaseResults)
+{
+  DatabaseResults results;
+  for (const char* artist : {"M Artist", "B Artist", "R Artist", "A Artist", "G Artist"})
+  {
+    DatabaseResult result;
+    result[FieldArtist] = artist;
+    results.push_back(result);
+  }
+
+  SortDescription desc;
+  desc.sortBy = SortByArtist;
+  desc.sortOrder = SortOrderDescending;
+  desc.limitStart = 1;
+  desc.limitEnd = 4;
+  SortUtils::Sort(desc, results);
+
+  ASSERT_EQ(3u, results.size());
+  EXPECT_STREQ("M Artist", results[0][FieldArtist].asString().c_str());
+  EXPECT_STREQ("G Artist", results[1][FieldArtist].asString().c_str());
+  EXPECT_STREQ("B Artist", results[2][FieldArtist].asString().c_str());
+}
+
 TEST(TestSortUtils, GetFieldsForSorting)
 {
   Fields fields;
@@ -92,3 +92,40 @@ TEST_F(Testlog, SetLogLevel)
   CServiceBroker::GetLogging().Deinitialize();
   EXPECT_TRUE(XFILE::CFile::Delete(logfile));
 }
+
+TEST_F(Testlog, AsyncLog)
+{
+  std::string logfile, logstring;
+  char buf[100];
+  ssize_t bytesread;
+  XFILE::CFile file;
+
+  std::string appName = CCompileInfo::GetAppName();
+  StringUtils::ToLower(appName);
+  logfile = CSpecialProtocol::TranslatePath("special://temp/") + appName + ".log";
+  CServiceBroker::GetLogging().Initialize(CSpecialProtocol::TranslatePath("special://temp/"));
+  CServiceBroker::GetLogging().SetAsync(true, 16, LogOverflowPolicy::BLOCK);
+
+  for (int i = 0; i < 100; i++)
+    CLog::Log(LOGINFO, "async log message {}", i);
+  // everything still queued is written
+  CServiceBroker::GetLogging().Deinitialize();
+
+  EXPECT_TRUE(file.Open(logfile));
+  while ((bytesread = file.Read(buf, sizeof(buf) - 1)) > 0)
+  {
+    buf[bytesread] = '\0';
+    logstring.append(buf);
+  }
+  file.Close();
+
+  size_t pos = 0;
+  for (int i = 0; i < 100; i++)
+  {
+    pos = logstring.find(StringUtils::Format("async log message {}\n", i), pos);
+    EXPECT_NE(std::string::npos, pos);
+  }
+  EXPECT_EQ(0u, CServiceBroker::GetLogging().GetDroppedMessages());
+
+  EXPECT_TRUE(XFILE::CFile::Delete(logfile));
+}
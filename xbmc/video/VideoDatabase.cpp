@@ -19,6 +19,7 @@
 #include "VideoInfoScanner.h"
 #include "XBDateTime.h"
 #include "addons/AddonManager.h"
+#include "dbwrappers/FullTextIndex.h"
 #include "dbwrappers/dataset.h"
 #include "dialogs/GUIDialogExtendedProgressBar.h"
 #include "dialogs/GUIDialogKaiToast.h"
@@ -78,6 +79,57 @@ using namespace KODI::MESSAGING;
 using namespace KODI::GUILIB;
 using namespace KODI::VIDEO;
 
+namespace
+{
+std::string VideoColumn(int column)
+{
+  return StringUtils::Format("c{:02}", column);
+}
+
+const CFullTextIndex& GetMovieSearchIndex()
+{
+  static const CFullTextIndex index{
+      "movie",
+      "idMovie",
+      {VideoColumn(VIDEODB_ID_TITLE), VideoColumn(VIDEODB_ID_ORIGINALTITLE)},
+      CFullTextIndex::Tokenizer::TRIGRAM};
+  return index;
+}
+
+const CFullTextIndex& GetTvShowSearchIndex()
+{
+  static const CFullTextIndex index{
+      "tvshow", "idShow", {VideoColumn(VIDEODB_ID_TV_TITLE)}, CFullTextIndex::Tokenizer::TRIGRAM};
+  return index;
+}
+
+const CFullTextIndex& GetEpisodeSearchIndex()
+{
+  static const CFullTextIndex index{"episode",
+                                    "idEpisode",
+                                    {VideoColumn(VIDEODB_ID_EPISODE_TITLE)},
+                                    CFullTextIndex::Tokenizer::TRIGRAM};
+  return index;
+}
+
+const CFullTextIndex& GetMusicVideoSearchIndex()
+{
+  static const CFullTextIndex index{
+      "musicvideo",
+      "idMVideo",
+      {VideoColumn(VIDEODB_ID_MUSICVIDEO_TITLE), VideoColumn(VIDEODB_ID_MUSICVIDEO_ALBUM)},
+      CFullTextIndex::Tokenizer::TRIGRAM};
+  return index;
+}
+
+const CFullTextIndex& GetPersonSearchIndex()
+{
+  static const CFullTextIndex index{"actor", "actor_id", {"name"},
+                                    CFullTextIndex::Tokenizer::TRIGRAM};
+  return index;
+}
+} // unnamed namespace
+
 //********************************************************************************************************************************
 CVideoDatabase::CVideoDatabase() = default;
 
@@ -380,6 +432,13 @@ void CVideoDatabase::CreateAnalytics()
               "DELETE FROM streamdetails WHERE idFile=old.idFile; "
               "END");
 
+  // Trigram indexes for search, they match the same substrings as the LIKE conditions
+  CreateFullTextIndex(GetMovieSearchIndex());
+  CreateFullTextIndex(GetTvShowSearchIndex());
+  CreateFullTextIndex(GetEpisodeSearchIndex());
+  CreateFullTextIndex(GetMusicVideoSearchIndex());
+  CreateFullTextIndex(GetPersonSearchIndex());
+
   CreateViews();
 }
 
@@ -646,8 +705,8 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
 
     URIUtils::AddSlashAtEnd(strPath1);
 
-    strSQL=PrepareSQL("select idPath from path where strPath='%s'",strPath1.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "select idPath from path where strPath=?";
+    m_pDS->query(strSQL, make_bind_list(strPath1));
     if (!m_pDS->eof())
       idPath = m_pDS->fv("path.idPath").get_asInt();
 
@@ -863,21 +922,17 @@ int CVideoDatabase::AddPath(const std::string& strPath, const std::string &paren
     int idParentPath = GetPathId(parentPath.empty() ? URIUtils::GetParentPath(strPath1) : parentPath);
 
     // add the path
-    if (idParentPath < 0)
-    {
-      if (dateAdded.IsValid())
-        strSQL=PrepareSQL("insert into path (idPath, strPath, dateAdded) values (NULL, '%s', '%s')", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str());
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath) values (NULL, '%s')", strPath1.c_str());
-    }
+    field_value dateAddedValue;
+    if (dateAdded.IsValid())
+      dateAddedValue.set_asString(dateAdded.GetAsDBDateTime());
     else
-    {
-      if (dateAdded.IsValid())
-        strSQL = PrepareSQL("insert into path (idPath, strPath, dateAdded, idParentPath) values (NULL, '%s', '%s', %i)", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str(), idParentPath);
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath, idParentPath) values (NULL, '%s', %i)", strPath1.c_str(), idParentPath);
-    }
-    m_pDS->exec(strSQL);
+      dateAddedValue.set_isNull();
+    field_value parentPathValue(idParentPath);
+    if (idParentPath < 0)
+      parentPathValue.set_isNull();
+
+    strSQL = "insert into path (idPath, strPath, dateAdded, idParentPath) values (NULL, ?, ?, ?)";
+    m_pDS->exec(strSQL, BindList{field_value(strPath1), dateAddedValue, parentPathValue});
     idPath = static_cast<int>(m_pDS->lastinsertid());
     return idPath;
   }
@@ -1019,10 +1074,9 @@ int CVideoDatabase::AddFile(const std::string& strFileNameAndPath,
     if (idPath < 0)
       return -1;
 
-    strSQL = PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i",
-                        strFileName.c_str(), idPath);
+    strSQL = "select idFile from files where strFileName=? and idPath=?";
 
-    m_pDS->query(strSQL);
+    m_pDS->query(strSQL, make_bind_list(strFileName, idPath));
     if (m_pDS->num_rows() > 0)
     {
       idFile = m_pDS->fv("idFile").get_asInt() ;
@@ -1031,17 +1085,19 @@ int CVideoDatabase::AddFile(const std::string& strFileNameAndPath,
     }
     m_pDS->close();
 
-    std::string strPlaycount = "NULL";
-    if (playcount > 0)
-      strPlaycount = std::to_string(playcount);
-    std::string strLastPlayed = "NULL";
+    field_value playcountValue(playcount);
+    if (playcount <= 0)
+      playcountValue.set_isNull();
+    field_value lastPlayedValue;
     if (lastPlayed.IsValid())
-      strLastPlayed = "'" + lastPlayed.GetAsDBDateTime() + "'";
+      lastPlayedValue.set_asString(lastPlayed.GetAsDBDateTime());
+    else
+      lastPlayedValue.set_isNull();
 
-    strSQL = PrepareSQL("INSERT INTO files (idFile, idPath, strFileName, playCount, lastPlayed, dateAdded) "
-                        "VALUES(NULL, %i, '%s', " + strPlaycount + ", " + strLastPlayed + ", '%s')",
-                        idPath, strFileName.c_str(), finalDateAdded.GetAsDBDateTime().c_str());
-    m_pDS->exec(strSQL);
+    strSQL = "INSERT INTO files (idFile, idPath, strFileName, playCount, lastPlayed, dateAdded) "
+             "VALUES(NULL, ?, ?, ?, ?, ?)";
+    m_pDS->exec(strSQL, BindList{field_value(idPath), field_value(strFileName), playcountValue,
+                                 lastPlayedValue, field_value(finalDateAdded.GetAsDBDateTime())});
     idFile = static_cast<int>(m_pDS->lastinsertid());
     return idFile;
   }
@@ -1121,6 +1177,40 @@ bool CVideoDatabase::SetPathHash(const std::string &path, const std::string &has
   return false;
 }
 
+bool CVideoDatabase::SetPathHashes(
+    const std::vector<std::pair<std::string, std::string>>& pathHashes)
+{
+  if (pathHashes.empty())
+    return true;
+
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    BeginTransaction();
+    for (const auto& [path, hash] : pathHashes)
+    {
+      int idPath = AddPath(path);
+      if (idPath < 0)
+        continue;
+
+      m_pDS->exec(PrepareSQL("update path set strHash='%s' where idPath=%ld", hash.c_str(), idPath));
+    }
+    CommitTransaction();
+
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({} paths) failed", pathHashes.size());
+  }
+  RollbackTransaction();
+  return false;
+}
+
 bool CVideoDatabase::LinkMovieToTvshow(int idMovie, int idShow, bool bRemove)
 {
    try
@@ -1223,9 +1313,8 @@ int CVideoDatabase::GetFileId(const std::string& strFilenameAndPath)
     int idPath = GetPathId(strPath);
     if (idPath >= 0)
     {
-      std::string strSQL;
-      strSQL=PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i", strFileName.c_str(),idPath);
-      m_pDS->query(strSQL);
+      m_pDS->query("select idFile from files where strFileName=? and idPath=?",
+                   make_bind_list(strFileName, idPath));
       if (m_pDS->num_rows() > 0)
       {
         int idFile = m_pDS->fv("files.idFile").get_asInt();
@@ -1664,14 +1753,15 @@ int CVideoDatabase::AddToTable(const std::string& table, const std::string& firs
     if (nullptr == m_pDS)
       return -1;
 
-    std::string strSQL = PrepareSQL("select %s from %s where %s like '%s'", firstField.c_str(), table.c_str(), secondField.c_str(), value.substr(0, 255).c_str());
-    m_pDS->query(strSQL);
+    const std::string name = value.substr(0, 255);
+    std::string strSQL = PrepareSQL("select %s from %s where %s like ?", firstField.c_str(), table.c_str(), secondField.c_str());
+    m_pDS->query(strSQL, make_bind_list(name));
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("insert into %s (%s, %s) values(NULL, '%s')", table.c_str(), firstField.c_str(), secondField.c_str(), value.substr(0, 255).c_str());
-      m_pDS->exec(strSQL);
+      strSQL = PrepareSQL("insert into %s (%s, %s) values(NULL, ?)", table.c_str(), firstField.c_str(), secondField.c_str());
+      m_pDS->exec(strSQL, make_bind_list(name));
       return static_cast<int>(m_pDS->lastinsertid());
     }
     else
@@ -1958,12 +2048,13 @@ void CVideoDatabase::AddLinkToActor(int mediaId, const char *mediaType, int acto
 void CVideoDatabase::AddToLinkTable(int mediaId, const std::string& mediaType, const std::string& table, int valueId, const char *foreignKey)
 {
   const char *key = foreignKey ? foreignKey : table.c_str();
-  std::string sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=%i AND media_id=%i AND media_type='%s'", table.c_str(), key, valueId, mediaId, mediaType.c_str());
+  const BindList params = make_bind_list(valueId, mediaId, mediaType);
+  std::string sql = PrepareSQL("SELECT 1 FROM %s_link WHERE %s_id=? AND media_id=? AND media_type=?", table.c_str(), key);
 
-  if (GetSingleValue(sql).empty())
+  if (GetSingleValue(sql, params).empty())
   { // doesn't exists, add it
-    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(%i,%i,'%s')", table.c_str(), key, valueId, mediaId, mediaType.c_str());
-    ExecuteQuery(sql);
+    sql = PrepareSQL("INSERT INTO %s_link (%s_id,media_id,media_type) VALUES(?,?,?)", table.c_str(), key);
+    ExecuteQuery(sql, params);
   }
 }
 
@@ -7006,7 +7097,7 @@ void CVideoDatabase::UpdateTables(int iVersion)
 
 int CVideoDatabase::GetSchemaVersion() const
 {
-  return 136;
+  return 137;
 }
 
 bool CVideoDatabase::LookupByFolders(const std::string &path, bool shows)
@@ -8817,6 +8908,8 @@ bool CVideoDatabase::GetMoviesBySet(const std::string& baseDir, CFileItemList& i
 
 bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, const SortDescription &sortDescription /* = SortDescription() */, int getDetails /* = VideoDbDetailsNone */)
 {
+  CReadScope readScope(*this);
+
   try
   {
     if (nullptr == m_pDB)
@@ -8976,6 +9069,8 @@ bool CVideoDatabase::GetTvShowsNav(const std::string& strBaseDir, CFileItemList&
 
 bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, const SortDescription &sortDescription /* = SortDescription() */, int getDetails /* = VideoDbDetailsNone */)
 {
+  CReadScope readScope(*this);
+
   try
   {
     if (nullptr == m_pDB)
@@ -9105,6 +9200,8 @@ bool CVideoDatabase::GetEpisodesNav(const std::string& strBaseDir, CFileItemList
 
 bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, bool appendFullShowPath /* = true */, const SortDescription &sortDescription /* = SortDescription() */, int getDetails /* = VideoDbDetailsNone */)
 {
+  CReadScope readScope(*this);
+
   try
   {
     if (nullptr == m_pDB)
@@ -9803,6 +9900,7 @@ void CVideoDatabase::GetMovieActorsByName(const std::string& strSearch, CFileIte
       strSQL=PrepareSQL("SELECT actor.actor_id, actor.name, path.strPath FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON path.idPath=files.idPath WHERE actor_link.media_type='movie' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
     else
       strSQL=PrepareSQL("SELECT DISTINCT actor.actor_id, actor.name FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN movie ON actor_link.media_id=movie.idMovie WHERE actor_link.media_type='movie' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetPersonSearchIndex(), "actor.actor_id", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9846,6 +9944,7 @@ void CVideoDatabase::GetTvShowsActorsByName(const std::string& strSearch, CFileI
       strSQL=PrepareSQL("SELECT actor.actor_id, actor.name, path.strPath FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN tvshow ON actor_link.media_id=tvshow.idShow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idPath=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath WHERE actor_link.media_type='tvshow' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
     else
       strSQL=PrepareSQL("SELECT DISTINCT actor.actor_id, actor.name FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN tvshow ON actor_link.media_id=tvshow.idShow WHERE actor_link.media_type='tvshow' AND actor.name LIKE '%%%s%%'",strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetPersonSearchIndex(), "actor.actor_id", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9892,6 +9991,7 @@ void CVideoDatabase::GetMusicVideoArtistsByName(const std::string& strSearch, CF
       strSQL=PrepareSQL("SELECT actor.actor_id, actor.name, path.strPath FROM actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id INNER JOIN musicvideo ON actor_link.media_id=musicvideo.idMVideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath WHERE actor_link.media_type='musicvideo' "+strLike, strSearch.c_str());
     else
       strSQL=PrepareSQL("SELECT DISTINCT actor.actor_id, actor.name from actor INNER JOIN actor_link ON actor_link.actor_id=actor.actor_id WHERE actor_link.media_type='musicvideo' "+strLike,strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetPersonSearchIndex(), "actor.actor_id", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -9985,8 +10085,13 @@ void CVideoDatabase::GetMusicVideoAlbumsByName(const std::string& strSearch, CFi
                                  "  path.idPath=files.idPath",
                                  VIDEODB_ID_MUSICVIDEO_ALBUM);
     if (!strSearch.empty())
+    {
       strSQL += PrepareSQL(" WHERE musicvideo.c%02d like '%%%s%%'",VIDEODB_ID_MUSICVIDEO_ALBUM, strSearch.c_str());
 
+      AppendFullTextSearch(strSQL, GetMusicVideoSearchIndex(), "musicvideo.idMVideo", strSearch,
+                           {VideoColumn(VIDEODB_ID_MUSICVIDEO_ALBUM)});
+    }
+
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10036,6 +10141,8 @@ void CVideoDatabase::GetMusicVideosByAlbum(const std::string& strSearch, CFileIt
       strSQL = PrepareSQL("SELECT musicvideo.idMVideo, musicvideo.c%02d,musicvideo.c%02d, path.strPath FROM musicvideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath WHERE musicvideo.c%02d LIKE '%%%s%%'", VIDEODB_ID_MUSICVIDEO_ALBUM, VIDEODB_ID_MUSICVIDEO_TITLE, VIDEODB_ID_MUSICVIDEO_ALBUM, strSearch.c_str());
     else
       strSQL = PrepareSQL("select musicvideo.idMVideo,musicvideo.c%02d,musicvideo.c%02d from musicvideo where musicvideo.c%02d like '%%%s%%'",VIDEODB_ID_MUSICVIDEO_ALBUM,VIDEODB_ID_MUSICVIDEO_TITLE,VIDEODB_ID_MUSICVIDEO_ALBUM,strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetMusicVideoSearchIndex(), "musicvideo.idMVideo", strSearch,
+                         {VideoColumn(VIDEODB_ID_MUSICVIDEO_ALBUM)});
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10068,6 +10175,8 @@ void CVideoDatabase::GetMusicVideosByAlbum(const std::string& strSearch, CFileIt
 
 bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Filter &filter, CFileItemList &items, bool checkLocks /*= true*/, const SortDescription &sortDescription /* = SortDescription() */, int getDetails /* = VideoDbDetailsNone */)
 {
+  CReadScope readScope(*this);
+
   try
   {
 
@@ -10273,14 +10382,15 @@ void CVideoDatabase::GetMoviesByName(const std::string& strSearch, CFileItemList
       strSQL = PrepareSQL("SELECT movie.idMovie, movie.c%02d, path.strPath, movie.idSet FROM movie "
                           "INNER JOIN files ON files.idFile=movie.idFile INNER JOIN path ON "
                           "path.idPath=files.idPath "
-                          "WHERE movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
+                          "WHERE (movie.c%02d LIKE '%%%s%%' OR movie.c%02d LIKE '%%%s%%')",
                           VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
                           VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("SELECT movie.idMovie,movie.c%02d, movie.idSet FROM movie WHERE "
-                          "movie.c%02d like '%%%s%%' OR movie.c%02d LIKE '%%%s%%'",
+                          "(movie.c%02d like '%%%s%%' OR movie.c%02d LIKE '%%%s%%')",
                           VIDEODB_ID_TITLE, VIDEODB_ID_TITLE, strSearch.c_str(),
                           VIDEODB_ID_ORIGINALTITLE, strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetMovieSearchIndex(), "movie.idMovie", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10330,6 +10440,7 @@ void CVideoDatabase::GetTvShowsByName(const std::string& strSearch, CFileItemLis
       strSQL = PrepareSQL("SELECT tvshow.idShow, tvshow.c%02d, path.strPath FROM tvshow INNER JOIN tvshowlinkpath ON tvshowlinkpath.idShow=tvshow.idShow INNER JOIN path ON path.idPath=tvshowlinkpath.idPath WHERE tvshow.c%02d LIKE '%%%s%%'", VIDEODB_ID_TV_TITLE, VIDEODB_ID_TV_TITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("select tvshow.idShow,tvshow.c%02d from tvshow where tvshow.c%02d like '%%%s%%'",VIDEODB_ID_TV_TITLE,VIDEODB_ID_TV_TITLE,strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetTvShowSearchIndex(), "tvshow.idShow", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10376,6 +10487,7 @@ void CVideoDatabase::GetEpisodesByName(const std::string& strSearch, CFileItemLi
       strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d, path.strPath FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow INNER JOIN files ON files.idFile=episode.idFile INNER JOIN path ON path.idPath=files.idPath WHERE episode.c%02d LIKE '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("SELECT episode.idEpisode, episode.c%02d, episode.c%02d, episode.idShow, tvshow.c%02d FROM episode INNER JOIN tvshow ON tvshow.idShow=episode.idShow WHERE episode.c%02d like '%%%s%%'", VIDEODB_ID_EPISODE_TITLE, VIDEODB_ID_EPISODE_SEASON, VIDEODB_ID_TV_TITLE, VIDEODB_ID_EPISODE_TITLE, strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetEpisodeSearchIndex(), "episode.idEpisode", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10426,6 +10538,8 @@ void CVideoDatabase::GetMusicVideosByName(const std::string& strSearch, CFileIte
       strSQL = PrepareSQL("SELECT musicvideo.idMVideo, musicvideo.c%02d, path.strPath FROM musicvideo INNER JOIN files ON files.idFile=musicvideo.idFile INNER JOIN path ON path.idPath=files.idPath WHERE musicvideo.c%02d LIKE '%%%s%%'", VIDEODB_ID_MUSICVIDEO_TITLE, VIDEODB_ID_MUSICVIDEO_TITLE, strSearch.c_str());
     else
       strSQL = PrepareSQL("select musicvideo.idMVideo,musicvideo.c%02d from musicvideo where musicvideo.c%02d like '%%%s%%'",VIDEODB_ID_MUSICVIDEO_TITLE,VIDEODB_ID_MUSICVIDEO_TITLE,strSearch.c_str());
+    AppendFullTextSearch(strSQL, GetMusicVideoSearchIndex(), "musicvideo.idMVideo", strSearch,
+                         {VideoColumn(VIDEODB_ID_MUSICVIDEO_TITLE)});
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10572,6 +10686,7 @@ void CVideoDatabase::GetMovieDirectorsByName(const std::string& strSearch, CFile
     else
       strSQL = PrepareSQL("SELECT DISTINCT director_link.actor_id, actor.name FROM actor INNER JOIN director_link ON director_link.actor_id=actor.actor_id INNER JOIN movie ON director_link.media_id=movie.idMovie WHERE director_link.media_type='movie' AND actor.name like '%%%s%%'", strSearch.c_str());
 
+    AppendFullTextSearch(strSQL, GetPersonSearchIndex(), "actor.actor_id", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10617,6 +10732,7 @@ void CVideoDatabase::GetTvShowsDirectorsByName(const std::string& strSearch, CFi
     else
       strSQL = PrepareSQL("SELECT DISTINCT director_link.actor_id, actor.name FROM actor INNER JOIN director_link ON director_link.actor_id=actor.actor_id INNER JOIN tvshow ON director_link.media_id=tvshow.idShow WHERE director_link.media_type='tvshow' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
 
+    AppendFullTextSearch(strSQL, GetPersonSearchIndex(), "actor.actor_id", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -10662,6 +10778,7 @@ void CVideoDatabase::GetMusicVideoDirectorsByName(const std::string& strSearch,
     else
       strSQL = PrepareSQL("SELECT DISTINCT director_link.actor_id, actor.name FROM actor INNER JOIN director_link ON director_link.actor_id=actor.actor_id INNER JOIN musicvideo ON director_link.media_id=musicvideo.idMVideo WHERE director_link.media_type='musicvideo' AND actor.name LIKE '%%%s%%'", strSearch.c_str());
 
+    AppendFullTextSearch(strSQL, GetPersonSearchIndex(), "actor.actor_id", strSearch);
     m_pDS->query( strSQL );
 
     while (!m_pDS->eof())
@@ -897,6 +897,12 @@ public:
 
   // scanning hashes and paths scanned
   bool SetPathHash(const std::string &path, const std::string &hash);
+  /*! \brief Store the scan hashes of several paths in a single transaction.
+   Must not be called while another transaction is open on this database.
+   \param pathHashes pairs of path and hash to store
+   \return true on success, false if the transaction failed
+   */
+  bool SetPathHashes(const std::vector<std::pair<std::string, std::string>>& pathHashes);
   bool GetPathHash(const std::string &path, std::string &hash);
   bool GetPaths(std::set<std::string, std::less<>>& paths);
   bool GetPathsForTvShow(int idShow, std::set<int>& paths);
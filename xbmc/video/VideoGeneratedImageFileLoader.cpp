@@ -64,17 +64,26 @@ std::unique_ptr<CTexture> CVideoGeneratedImageFileLoader::Load(
     return {};
   }
 
+  return CDVDFileInfo::ExtractThumbToTexture(GetVideoItem(imageFile), GetChapter(imageFile));
+}
+
+CFileItem CVideoGeneratedImageFileLoader::GetVideoItem(const IMAGE_FILES::CImageFileURL& imageFile)
+{
   const std::string& filePath = imageFile.GetTargetFile();
   CFileItem item{filePath, false};
 
   if (URIUtils::IsInRAR(filePath))
     SetupRarOptions(item, filePath);
 
+  return item;
+}
+
+int CVideoGeneratedImageFileLoader::GetChapter(const IMAGE_FILES::CImageFileURL& imageFile)
+{
   std::string chapterOption = imageFile.GetOption("chapter");
   int chapter = 0;
   std::from_chars(chapterOption.data(), chapterOption.data() + chapterOption.size(), chapter);
-
-  return CDVDFileInfo::ExtractThumbToTexture(item, chapter);
+  return chapter;
 }
 
 } // namespace KODI::VIDEO
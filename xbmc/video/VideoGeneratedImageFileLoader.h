@@ -10,6 +10,8 @@
 
 #include "imagefiles/SpecialImageFileLoader.h"
 
+class CFileItem;
+
 namespace KODI::VIDEO
 {
 /*!
@@ -21,6 +23,16 @@ class CVideoGeneratedImageFileLoader : public IMAGE_FILES::ISpecialImageFileLoad
 public:
   bool CanLoad(const std::string& specialType) const override;
   std::unique_ptr<CTexture> Load(const IMAGE_FILES::CImageFileURL& imageFile) const override;
+
+  /*!
+   * @brief Get the video file an image is generated from.
+   */
+  static CFileItem GetVideoItem(const IMAGE_FILES::CImageFileURL& imageFile);
+
+  /*!
+   * @brief Get the chapter an image is generated for, 0 for the frame approx 1/3 into the video.
+   */
+  static int GetChapter(const IMAGE_FILES::CImageFileURL& imageFile);
 };
 
 } // namespace KODI::VIDEO
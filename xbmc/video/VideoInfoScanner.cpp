@@ -40,9 +40,12 @@
 #include "settings/SettingsComponent.h"
 #include "tags/SetInfoTagLoaderFactory.h"
 #include "tags/VideoInfoTagLoaderFactory.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
 #include "utils/ArtUtils.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
+#include "utils/JobManager.h"
 #include "utils/RegExp.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
@@ -51,13 +54,17 @@
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
 #include "video/VideoManagerTypes.h"
+#include "video/VideoThumbBatchExtractor.h"
 #include "video/VideoThumbLoader.h"
 #include "video/VideoUtils.h"
 #include "video/dialogs/GUIDialogVideoManagerExtras.h"
 #include "video/dialogs/GUIDialogVideoManagerVersions.h"
 
 #include <algorithm>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 using namespace XFILE;
@@ -183,11 +190,220 @@ void OnDirectoryScanned(const std::string& strDirectory)
   CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg);
 }
 
+//! Number of path hashes collected before they are written in one transaction
+constexpr size_t PATH_HASH_BATCH_SIZE = 32;
+
+/*! \brief List a movie or music video folder the way the scanner hashes it: video files and
+ folders without .nomedia, with stacks collapsed.
+ */
+void GetScanListing(const std::string& strDirectory, CFileItemList& items)
+{
+  CDirectory::GetDirectory(strDirectory, items,
+                           CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                           DIR_FLAG_DEFAULTS);
+  // do not consider inner folders with .nomedia
+  items.erase(std::remove_if(items.begin(), items.end(),
+                             [](const CFileItemPtr& item)
+                             { return item->IsFolder() && CInfoScanner::HasNoMedia(item->GetPath()); }),
+              items.end());
+  items.Stack();
+}
+
+//! The path CDVDFileInfo::GetFileStreamDetails() opens for an item
+std::string GetStreamDetailsPath(const CFileItem& item)
+{
+  if (item.HasVideoInfoTag() && !item.GetVideoInfoTag()->m_strFileNameAndPath.empty())
+    return item.GetVideoInfoTag()->m_strFileNameAndPath;
+  return item.GetDynPath();
+}
+
 } // namespace
 
 namespace KODI::VIDEO
 {
 
+/*!
+ \brief Runs the filesystem work of a scan ahead of the scanner thread.
+
+ Folder listings and hashes run on one job queue, stream detail extraction on another. The
+ scanner thread still makes every decision and owns every database write; it only takes the
+ prepared results. A job only touches its own result, so a job abandoned on cancel can safely
+ finish after the scan has moved on.
+ */
+class CVideoInfoScanner::CPrefetcher
+{
+public:
+  struct CFolder
+  {
+    CEvent done{true};
+    bool noMedia{false};
+    bool listed{false}; //!< false when the fast hash matched and no listing was needed
+    std::string fastHash;
+    CFileItemList items;
+  };
+
+  CPrefetcher(unsigned int ioThreads, unsigned int probeThreads)
+    : m_ioThreads(ioThreads),
+      m_probeThreads(probeThreads),
+      m_ioQueue(false, std::max(ioThreads, 1u)),
+      m_probeQueue(false, std::max(probeThreads, 1u))
+  {
+  }
+
+  ~CPrefetcher() { Cancel(); }
+
+  unsigned int GetIOThreads() const { return m_ioThreads; }
+  bool CanProbe() const { return m_probeThreads > 0; }
+
+  bool IsFolderQueued(const std::string& path) const
+  {
+    std::unique_lock lock(m_section);
+    return m_folders.contains(path);
+  }
+
+  void QueueFolder(const std::string& path,
+                   const std::vector<std::string>& excludes,
+                   bool useFastHash,
+                   const std::string& dbHash)
+  {
+    auto folder = std::make_shared<CFolder>();
+    {
+      std::unique_lock lock(m_section);
+      if (!m_folders.try_emplace(path, folder).second)
+        return;
+    }
+
+    m_ioQueue.Submit(
+        [folder, path, excludes, useFastHash, dbHash]()
+        {
+          folder->noMedia = HasNoMedia(path);
+          if (!folder->noMedia)
+          {
+            if (useFastHash)
+              folder->fastHash = GetFastHash(path, excludes);
+
+            // the listing is only needed when the fast hash can't prove the folder unchanged
+            if (folder->fastHash.empty() || !StringUtils::EqualsNoCase(folder->fastHash, dbHash))
+            {
+              GetScanListing(path, folder->items);
+              folder->listed = true;
+            }
+          }
+          folder->done.Set();
+        });
+  }
+
+  /*! \brief Take the prefetched result for a folder, waiting for it if it is still in flight.
+   \return the result, or nullptr if the folder wasn't queued, its job was dropped or the scan
+   was stopped while waiting.
+   */
+  std::shared_ptr<const CFolder> TakeFolder(const std::string& path, const bool& stop)
+  {
+    std::shared_ptr<CFolder> folder;
+    {
+      std::unique_lock lock(m_section);
+      auto it = m_folders.find(path);
+      if (it == m_folders.end())
+        return {};
+      folder = std::move(it->second);
+      m_folders.erase(it);
+    }
+    return Wait(folder->done, m_ioQueue, stop) ? folder : nullptr;
+  }
+
+  void QueueStreamDetails(const CFileItem& item)
+  {
+    const std::string path = GetStreamDetailsPath(item);
+    auto probe = std::make_shared<CProbe>();
+    {
+      std::unique_lock lock(m_section);
+      if (!m_probes.try_emplace(path, probe).second)
+        return;
+    }
+
+    auto file = std::make_shared<CFileItem>(item);
+    m_probeQueue.Submit(
+        [probe, file]()
+        {
+          probe->extracted = CDVDFileInfo::GetFileStreamDetails(file.get());
+          if (probe->extracted)
+            probe->details = file->GetVideoInfoTag()->m_streamDetails;
+          probe->done.Set();
+        });
+  }
+
+  /*! \brief Take the prefetched stream details for an item.
+   \return true if the item was probed and details holds the outcome, false if the caller
+   should probe the item itself.
+   */
+  bool TakeStreamDetails(const CFileItem& item, CStreamDetails& details, const bool& stop)
+  {
+    std::shared_ptr<CProbe> probe;
+    {
+      std::unique_lock lock(m_section);
+      auto it = m_probes.find(GetStreamDetailsPath(item));
+      if (it == m_probes.end())
+        return false;
+      probe = std::move(it->second);
+      m_probes.erase(it);
+    }
+    if (!Wait(probe->done, m_probeQueue, stop))
+      return false;
+
+    if (probe->extracted)
+      details = probe->details;
+    return true;
+  }
+
+  //! Drop probes for items that were never added, e.g. because no information was found.
+  void CancelProbes()
+  {
+    m_probeQueue.CancelJobs();
+    std::unique_lock lock(m_section);
+    m_probes.clear();
+  }
+
+  void Cancel()
+  {
+    m_ioQueue.CancelJobs();
+    m_probeQueue.CancelJobs();
+    std::unique_lock lock(m_section);
+    m_folders.clear();
+    m_probes.clear();
+  }
+
+private:
+  struct CProbe
+  {
+    CEvent done{true};
+    bool extracted{false};
+    CStreamDetails details;
+  };
+
+  static bool Wait(CEvent& done, const CJobQueue& queue, const bool& stop)
+  {
+    using namespace std::chrono_literals;
+
+    while (!stop)
+    {
+      if (done.Wait(100ms))
+        return true;
+      // a job dropped by the job manager never signals, so stop waiting once nothing is queued
+      if (!queue.IsProcessing())
+        return done.Wait(0ms);
+    }
+    return false;
+  }
+
+  const unsigned int m_ioThreads;
+  const unsigned int m_probeThreads;
+  mutable CCriticalSection m_section;
+  std::map<std::string, std::shared_ptr<CFolder>, std::less<>> m_folders;
+  std::map<std::string, std::shared_ptr<CProbe>, std::less<>> m_probes;
+  CJobQueue m_ioQueue;
+  CJobQueue m_probeQueue;
+};
+
 CVideoInfoScanner::CVideoInfoScanner()
   : m_advancedSettings(CServiceBroker::GetSettingsComponent()->GetAdvancedSettings())
 {
@@ -242,6 +458,21 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
       m_database.Open();
 
+      if (m_advancedSettings->m_videoScannerIOThreads > 0 ||
+          m_advancedSettings->m_videoScannerProbeThreads > 0)
+      {
+        CLog::Log(LOGDEBUG, "VideoInfoScanner: Using {} I/O and {} probe workers",
+                  m_advancedSettings->m_videoScannerIOThreads,
+                  m_advancedSettings->m_videoScannerProbeThreads);
+        m_prefetcher = std::make_unique<CPrefetcher>(m_advancedSettings->m_videoScannerIOThreads,
+                                                     m_advancedSettings->m_videoScannerProbeThreads);
+      }
+      if (m_advancedSettings->m_videoScannerThumbThreads > 0)
+      {
+        m_thumbExtractor = std::make_unique<CVideoThumbBatchExtractor>(
+            m_advancedSettings->m_videoScannerThumbThreads);
+      }
+
       m_bCanInterrupt = true;
 
       CLog::Log(LOGINFO, "VideoInfoScanner: Starting scan ..");
@@ -254,6 +485,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
       m_bCanInterrupt = false;
 
       bool bCancelled = false;
+      std::string prefetchedUpTo;
       while (!bCancelled && !m_pathsToScan.empty())
       {
         /*
@@ -278,10 +510,40 @@ CVideoInfoScanner::~CVideoInfoScanner()
                     CURL::GetRedacted(directory), m_bClean ? " and clean" : "");
           m_pathsToScan.erase(m_pathsToScan.begin());
         }
-        else if (!DoScan(directory))
-          bCancelled = true;
+        else
+        {
+          if (m_prefetcher && m_prefetcher->GetIOThreads() > 0)
+          { // keep the next few paths in flight on the I/O workers
+            auto next = m_pathsToScan.begin();
+            for (unsigned int i = 0;
+                 i < 2 * m_prefetcher->GetIOThreads() && next != m_pathsToScan.end(); ++i, ++next)
+            {
+              if (*next > prefetchedUpTo)
+              {
+                PrefetchFolder(*next);
+                prefetchedUpTo = *next;
+              }
+            }
+          }
+
+          if (!DoScan(directory))
+            bCancelled = true;
+        }
       }
 
+      if (m_prefetcher)
+        m_prefetcher->Cancel();
+      FlushPathHashes();
+
+      // thumbs generated from the files are extracted once all of the files are known
+      if (!bCancelled && m_thumbExtractor && !m_thumbExtractor->IsEmpty())
+      {
+        if (m_handle)
+          m_handle->SetTitle(g_localizeStrings.Get(110));
+        m_thumbExtractor->Process(m_bStop);
+      }
+      m_thumbExtractor.reset();
+
       if (!bCancelled)
       {
         if (m_bClean)
@@ -308,6 +570,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
       CLog::Log(LOGERROR, "VideoInfoScanner: Exception while scanning.");
     }
 
+    m_prefetcher.reset();
+    m_thumbExtractor.reset();
+    m_pathHashes.clear();
     m_bRunning = false;
     CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
                                                        "OnScanFinished");
@@ -395,7 +660,15 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if (CUtil::ExcludeFileOrFolder(strDirectory, regexps))
       return true;
 
-    if (HasNoMedia(strDirectory))
+    std::shared_ptr<const CPrefetcher::CFolder> prefetched;
+    if (m_prefetcher)
+    {
+      prefetched = m_prefetcher->TakeFolder(strDirectory, m_bStop);
+      if (m_bStop)
+        return false;
+    }
+
+    if (prefetched ? prefetched->noMedia : HasNoMedia(strDirectory))
       return true;
 
     bool ignoreFolder = !m_scanAll && settings.noupdate;
@@ -421,7 +694,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
       }
 
       std::string fastHash;
-      if (m_advancedSettings->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(strDirectory))
+      if (prefetched)
+        fastHash = prefetched->fastHash;
+      else if (m_advancedSettings->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(strDirectory))
         fastHash = GetFastHash(strDirectory, regexps);
 
       if (m_database.GetPathHash(strDirectory, dbHash) && !fastHash.empty() && StringUtils::EqualsNoCase(fastHash, dbHash))
@@ -430,13 +705,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
       }
       else
       { // need to fetch the folder
-        CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
-                                 DIR_FLAG_DEFAULTS);
-        // do not consider inner folders with .nomedia
-        items.erase(std::remove_if(items.begin(), items.end(), [](const CFileItemPtr& item)
-                                   { return item->IsFolder() && HasNoMedia(item->GetPath()); }),
-                    items.end());
-        items.Stack();
+        if (prefetched && prefetched->listed)
+          items.Assign(prefetched->items);
+        else
+          GetScanListing(strDirectory, items);
 
         // check whether to re-use previously computed fast hash
         if (!CanFastHash(items, regexps) || fastHash.empty())
@@ -506,7 +778,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
       {
         if (!m_bStop && (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS))
         {
-          m_database.SetPathHash(strDirectory, hash);
+          QueuePathHash(strDirectory, hash);
           if (m_bClean)
             m_pathsToClean.insert(m_database.GetPathId(strDirectory));
           CLog::Log(LOGDEBUG, "VideoInfoScanner: Finished adding information from dir {}",
@@ -524,12 +796,21 @@ CVideoInfoScanner::~CVideoInfoScanner()
     else if (!StringUtils::EqualsNoCase(hash, dbHash) &&
              (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS))
     { // update the hash either way - we may have changed the hash to a fast version
-      m_database.SetPathHash(strDirectory, hash);
+      QueuePathHash(strDirectory, hash);
     }
 
     if (m_handle)
       OnDirectoryScanned(strDirectory);
 
+    // if we have a directory item (non-playlist) we then recurse into that folder
+    // do not recurse for tv shows - we have already looked recursively for episodes
+    const auto isSubfolder = [&settings, content](const CFileItem& item)
+    {
+      return item.IsFolder() && !item.IsParentFolder() && !PLAYLIST::IsPlayList(item) &&
+             settings.recurse > 0 && content != ContentType::TVSHOWS;
+    };
+
+    int prefetchedItems = 0;
     for (int i = 0; i < items.Size(); ++i)
     {
       CFileItemPtr pItem = items[i];
@@ -537,6 +818,17 @@ CVideoInfoScanner::~CVideoInfoScanner()
       if (m_bStop)
         break;
 
+      if (m_prefetcher && m_prefetcher->GetIOThreads() > 0)
+      { // keep the next few subfolders in flight on the I/O workers
+        const int window = std::min(items.Size(), i + 2 * static_cast<int>(m_prefetcher->GetIOThreads()));
+        for (; prefetchedItems < window; ++prefetchedItems)
+        {
+          const CFileItem& item = *items[prefetchedItems];
+          if (isSubfolder(item) && !IsVideoExtrasFolder(item))
+            PrefetchFolder(item.GetPath());
+        }
+      }
+
       // See if set needs updating
       if (content == ContentType::MOVIES)
         UpdateSet(pItem);
@@ -555,10 +847,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
         continue;
       }
 
-      // if we have a directory item (non-playlist) we then recurse into that folder
-      // do not recurse for tv shows - we have already looked recursively for episodes
-      if (pItem->IsFolder() && !pItem->IsParentFolder() && !PLAYLIST::IsPlayList(*pItem) &&
-          settings.recurse > 0 && content != ContentType::TVSHOWS)
+      if (isSubfolder(*pItem))
       {
         if (!DoScan(pItem->GetPath()))
         {
@@ -569,6 +858,72 @@ CVideoInfoScanner::~CVideoInfoScanner()
     return !m_bStop;
   }
 
+  void CVideoInfoScanner::PrefetchFolder(const std::string& strDirectory)
+  {
+    // plugin listings and tv show folders are left to DoScan()
+    if (!m_prefetcher || m_prefetcher->GetIOThreads() == 0 || URIUtils::IsPlugin(strDirectory) ||
+        m_prefetcher->IsFolderQueued(strDirectory))
+      return;
+
+    SScanSettings settings;
+    bool foundDirectly = false;
+    const ScraperPtr info =
+        m_database.GetScraperForPath(strDirectory, settings, foundDirectly, &m_scraperCache);
+    const ContentType content = info ? info->Content() : ContentType::NONE;
+    if ((content != ContentType::MOVIES && content != ContentType::MUSICVIDEOS) ||
+        (!m_scanAll && settings.noupdate))
+      return;
+
+    const std::vector<std::string>& regexps = m_advancedSettings->m_moviesExcludeFromScanRegExps;
+    if (CUtil::ExcludeFileOrFolder(strDirectory, regexps))
+      return;
+
+    std::string dbHash;
+    m_database.GetPathHash(strDirectory, dbHash);
+    m_prefetcher->QueueFolder(strDirectory, regexps, m_advancedSettings->m_bVideoLibraryUseFastHash,
+                              dbHash);
+  }
+
+  void CVideoInfoScanner::PrefetchStreamDetails(const CFileItemList& items, ContentType content)
+  {
+    if (!m_prefetcher || !m_prefetcher->CanProbe() ||
+        (content != ContentType::MOVIES && content != ContentType::MUSICVIDEOS) ||
+        !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+            CSettings::SETTING_MYVIDEOS_EXTRACTFLAGS))
+      return;
+
+    for (const auto& item : items)
+    {
+      if (item->IsFolder() || !IsVideo(*item) || item->IsNFO() || PLAYLIST::IsPlayList(*item) ||
+          CUtil::ExcludeFileOrFolder(item->GetPath(),
+                                     m_advancedSettings->m_moviesExcludeFromScanRegExps))
+        continue;
+
+      // items already in the library are skipped without being added, so don't probe them
+      const bool known = content == ContentType::MOVIES
+                             ? m_database.HasMovieInfo(item->GetDynPath())
+                             : m_database.HasMusicVideoInfo(item->GetPath());
+      if (!known)
+        m_prefetcher->QueueStreamDetails(*item);
+    }
+  }
+
+  void CVideoInfoScanner::QueuePathHash(const std::string& strDirectory, const std::string& hash)
+  {
+    m_pathHashes.emplace_back(strDirectory, hash);
+    if (m_pathHashes.size() >= PATH_HASH_BATCH_SIZE)
+      FlushPathHashes();
+  }
+
+  void CVideoInfoScanner::FlushPathHashes()
+  {
+    if (m_pathHashes.empty())
+      return;
+
+    m_database.SetPathHashes(m_pathHashes);
+    m_pathHashes.clear();
+  }
+
   void CVideoInfoScanner::UpdateSet(const std::shared_ptr<CFileItem>& item)
   {
     bool update{false};
@@ -690,6 +1045,8 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
     m_database.Open();
 
+    PrefetchStreamDetails(items, content);
+
     bool FoundSomeInfo = false;
     std::vector<int> seenPaths;
     for (int i = 0; i < items.Size(); ++i)
@@ -790,6 +1147,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if(pDlgProgress)
       pDlgProgress->ShowProgressBar(false);
 
+    if (m_prefetcher)
+      m_prefetcher->CancelProbes();
+
     m_database.Close();
     return FoundSomeInfo;
   }
@@ -1323,6 +1683,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
                        }),
         items.end());
 
+    // Discard all exclude files defined by regExExcludes
+    CUtil::ExcludeFilesOrFolders(items, regexps);
+
     // enumerate
     for (int i=0;i<items.Size();++i)
     {
@@ -1334,10 +1697,6 @@ CVideoInfoScanner::~CVideoInfoScanner()
       if (StringUtils::EqualsNoCase(URIUtils::GetFileName(strPath), "sample"))
         continue;
 
-      // Discard all exclude files defined by regExExcludes
-      if (CUtil::ExcludeFileOrFolder(items[i]->GetPath(), regexps))
-        continue;
-
       /*
        * Check if the media source has already set the season and episode or original air date in
        * the VideoInfoTag. If it has, do not try to parse any of them from the file path to avoid
@@ -1780,7 +2139,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
           strmdetails.GetVideoWidth(1) == 0 || strmdetails.GetVideoDuration(1) == 0)
 
       {
-        CDVDFileInfo::GetFileStreamDetails(pItem);
+        if (!m_prefetcher ||
+            !m_prefetcher->TakeStreamDetails(*pItem, movieDetails.m_streamDetails, m_bStop))
+          CDVDFileInfo::GetFileStreamDetails(pItem);
         CLog::Log(LOGDEBUG, "VideoInfoScanner: Extracted filestream details from video file {}",
                   CURL::GetRedacted(pItem->GetPath()));
       }
@@ -2106,7 +2467,10 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
     for (const auto& artType : artTypes)
     {
-      if (art.contains(artType))
+      if (!art.contains(artType))
+        continue;
+      // a scan extracts the thumbs generated from its files in a batch
+      if (!m_thumbExtractor || !m_thumbExtractor->Add(art[artType]))
         CServiceBroker::GetTextureCache()->BackgroundCacheImage(art[artType]);
     }
 
@@ -2463,8 +2827,8 @@ CVideoInfoScanner::~CVideoInfoScanner()
     return true;
   }
 
-  std::string CVideoInfoScanner::GetFastHash(const std::string &directory,
-      const std::vector<std::string> &excludes) const
+  std::string CVideoInfoScanner::GetFastHash(const std::string& directory,
+                                             const std::vector<std::string>& excludes)
   {
     CDigest digest{CDigest::Type::MD5};
 
@@ -14,8 +14,10 @@
 #include "guilib/GUIListItem.h"
 #include "utils/Artwork.h"
 
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CAdvancedSettings;
@@ -27,6 +29,7 @@ namespace KODI::VIDEO
 {
   class IVideoInfoTagLoader;
   class ISetInfoTagLoader;
+  class CVideoThumbBatchExtractor;
 
   typedef struct SScanSettings
   {
@@ -253,7 +256,8 @@ namespace KODI::VIDEO
      \param excludes string array of exclude expressions
      \return the md5 hash of the folder"
      */
-    std::string GetFastHash(const std::string &directory, const std::vector<std::string> &excludes) const;
+    static std::string GetFastHash(const std::string& directory,
+                                   const std::vector<std::string>& excludes);
 
     /*! \brief Retrieve a "fast" hash of the given directory recursively (if available)
      Performs a stat() on the directory, and uses modified time to create a "fast"
@@ -303,6 +307,28 @@ namespace KODI::VIDEO
     std::pair<InfoType, std::unique_ptr<IVideoInfoTagLoader>> ReadInfoTag(
         CFileItem& item, const ADDON::ScraperPtr& scraper, bool lookInFolder, bool resetTag);
 
+    /*! \brief Queue a folder on the I/O workers so its listing and hashes are ready by the time
+     DoScan() reaches it. Only movie and music video folders are prefetched.
+     \param strDirectory folder to prefetch
+     */
+    void PrefetchFolder(const std::string& strDirectory);
+
+    /*! \brief Queue stream detail extraction for the items RetrieveVideoInfo() is about to add.
+     \param items list of items about to be processed
+     \param content content type of the items
+     */
+    void PrefetchStreamDetails(const CFileItemList& items, ADDON::ContentType content);
+
+    /*! \brief Queue a path hash for the next batched write.
+     */
+    void QueuePathHash(const std::string& strDirectory, const std::string& hash);
+
+    /*! \brief Write all queued path hashes in a single transaction.
+     */
+    void FlushPathHashes();
+
+    class CPrefetcher;
+
     bool m_bStop;
     bool m_scanAll;
     bool m_ignoreVideoVersions{false};
@@ -311,6 +337,9 @@ namespace KODI::VIDEO
     std::set<int> m_pathsToClean;
     std::shared_ptr<CAdvancedSettings> m_advancedSettings;
     CVideoDatabase::ScraperCache m_scraperCache;
+    std::unique_ptr<CPrefetcher> m_prefetcher; //!< only set during a parallel Process()
+    std::unique_ptr<CVideoThumbBatchExtractor> m_thumbExtractor; //!< only set during Process()
+    std::vector<std::pair<std::string, std::string>> m_pathHashes; //!< pending hash writes
 
     void UpdateSet(const std::shared_ptr<CFileItem>& item);
   };
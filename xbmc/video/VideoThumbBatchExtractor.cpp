@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoThumbBatchExtractor.h"
+
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "TextureCache.h"
+#include "cores/VideoPlayer/DVDFileInfo.h"
+#include "cores/VideoPlayer/DVDThumbExtractor.h"
+#include "guilib/Texture.h"
+#include "imagefiles/ImageFileURL.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "utils/log.h"
+#include "video/VideoGeneratedImageFileLoader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+using namespace std::chrono_literals;
+
+namespace KODI::VIDEO
+{
+
+/*!
+ \brief State shared with the extraction jobs, which may outlive a cancelled batch.
+ */
+class CVideoThumbBatchExtractor::CState
+{
+public:
+  explicit CState(size_t files) : m_remaining(files) {}
+
+  void ExtractFile(const std::vector<std::string>& images)
+  {
+    const IMAGE_FILES::CImageFileURL imageURL{images.front()};
+    const CFileItem item = CVideoGeneratedImageFileLoader::GetVideoItem(imageURL);
+
+    std::unique_ptr<CDVDThumbExtractor> extractor = TakeExtractor();
+    if (!m_cancelled && CDVDFileInfo::CanExtract(item) && extractor->Open(item))
+    {
+      m_files++;
+      for (const auto& image : images)
+      {
+        if (m_cancelled)
+          break;
+
+        const int chapter =
+            CVideoGeneratedImageFileLoader::GetChapter(IMAGE_FILES::CImageFileURL{image});
+        std::unique_ptr<CTexture> texture = extractor->Extract(chapter);
+        if (texture &&
+            !CServiceBroker::GetTextureCache()->CacheGeneratedImage(image, *texture).empty())
+          m_images++;
+        else
+          m_failed++;
+      }
+      extractor->Close();
+    }
+    else
+      m_failed += static_cast<unsigned int>(images.size());
+
+    ReturnExtractor(std::move(extractor));
+
+    if (--m_remaining == 0)
+      m_done.Set();
+  }
+
+  bool Wait(const CJobQueue& queue, const bool& stop)
+  {
+    while (!stop)
+    {
+      if (m_done.Wait(100ms))
+        return true;
+      // a job dropped by the job manager never signals, so stop waiting once nothing is queued
+      if (!queue.IsProcessing())
+        return m_done.Wait(0ms);
+    }
+    m_cancelled = true;
+    return false;
+  }
+
+  void GetStats(Stats& stats) const
+  {
+    stats.files = m_files;
+    stats.images = m_images;
+    stats.failed = m_failed;
+  }
+
+private:
+  // the extractors of finished files keep their scaler for the next ones
+  std::unique_ptr<CDVDThumbExtractor> TakeExtractor()
+  {
+    std::unique_lock lock(m_section);
+    if (m_extractors.empty())
+      return std::make_unique<CDVDThumbExtractor>();
+
+    std::unique_ptr<CDVDThumbExtractor> extractor = std::move(m_extractors.back());
+    m_extractors.pop_back();
+    return extractor;
+  }
+
+  void ReturnExtractor(std::unique_ptr<CDVDThumbExtractor> extractor)
+  {
+    std::unique_lock lock(m_section);
+    m_extractors.emplace_back(std::move(extractor));
+  }
+
+  CCriticalSection m_section;
+  std::vector<std::unique_ptr<CDVDThumbExtractor>> m_extractors;
+  std::atomic<size_t> m_remaining;
+  std::atomic<bool> m_cancelled{false};
+  std::atomic<unsigned int> m_files{0};
+  std::atomic<unsigned int> m_images{0};
+  std::atomic<unsigned int> m_failed{0};
+  CEvent m_done{true};
+};
+
+double CVideoThumbBatchExtractor::Stats::GetFilesPerSecond() const
+{
+  if (duration.count() <= 0)
+    return 0.0;
+  return files * 1000.0 / duration.count();
+}
+
+CVideoThumbBatchExtractor::CVideoThumbBatchExtractor(unsigned int threads)
+  : m_queue(false, std::max(threads, 1u))
+{
+}
+
+CVideoThumbBatchExtractor::~CVideoThumbBatchExtractor()
+{
+  m_queue.CancelJobs();
+}
+
+bool CVideoThumbBatchExtractor::Add(const std::string& image)
+{
+  const IMAGE_FILES::CImageFileURL imageURL{image};
+  if (imageURL.GetSpecialType() != "video")
+    return false;
+
+  if (!CServiceBroker::GetTextureCache()->HasCachedImage(image))
+    m_files[imageURL.GetTargetFile()].emplace_back(image);
+  return true;
+}
+
+CVideoThumbBatchExtractor::Stats CVideoThumbBatchExtractor::Process(const bool& stop)
+{
+  Stats stats;
+  if (m_files.empty())
+    return stats;
+
+  auto start = std::chrono::steady_clock::now();
+
+  auto state = std::make_shared<CState>(m_files.size());
+  for (auto& [_, images] : m_files)
+    m_queue.Submit([state, images = std::move(images)]() { state->ExtractFile(images); });
+  m_files.clear();
+
+  if (!state->Wait(m_queue, stop))
+    m_queue.CancelJobs();
+
+  auto end = std::chrono::steady_clock::now();
+  stats.duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+  state->GetStats(stats);
+
+  CLog::LogF(LOGINFO, "extracted {} images from {} files in {} ms, {:.1f} files/s ({} failed)",
+             stats.images, stats.files, stats.duration.count(), stats.GetFilesPerSecond(),
+             stats.failed);
+
+  return stats;
+}
+
+} // namespace KODI::VIDEO
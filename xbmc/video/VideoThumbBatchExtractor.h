@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/JobManager.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace KODI::VIDEO
+{
+/*!
+ * @brief Extracts the generated thumbnails of many video files in parallel and writes them
+ * straight to the texture cache.
+ *
+ * The images of a file, e.g. its thumb and chapter previews, are extracted from one open
+ * demuxer. No more than the given number of files are open at once and each of them holds a
+ * single decoded picture, so memory doesn't grow with the size of the batch.
+ */
+class CVideoThumbBatchExtractor
+{
+public:
+  struct Stats
+  {
+    unsigned int files{0}; //!< files the images were extracted from
+    unsigned int images{0}; //!< images written to the texture cache
+    unsigned int failed{0}; //!< images that couldn't be extracted or cached
+    std::chrono::milliseconds duration{0};
+
+    double GetFilesPerSecond() const;
+  };
+
+  explicit CVideoThumbBatchExtractor(unsigned int threads);
+  ~CVideoThumbBatchExtractor();
+
+  /*!
+   * @brief Queue an image for extraction.
+   * @param image url of the image, of special type "video".
+   * @return true if the image is taken care of, i.e. it is queued or cached already. false if it
+   * isn't an image generated from a video.
+   */
+  bool Add(const std::string& image);
+
+  bool IsEmpty() const { return m_files.empty(); }
+
+  /*!
+   * @brief Number of video files images are queued for.
+   */
+  size_t GetFileCount() const { return m_files.size(); }
+
+  /*!
+   * @brief Extract the queued images, blocking until all of them are done.
+   * @param stop set when the batch should be cancelled, files being extracted are finished.
+   * @return the counts of the batch.
+   */
+  Stats Process(const bool& stop);
+
+private:
+  class CState;
+
+  std::map<std::string, std::vector<std::string>, std::less<>> m_files; //!< images by video file
+  CJobQueue m_queue;
+};
+
+} // namespace KODI::VIDEO
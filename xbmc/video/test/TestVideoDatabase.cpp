@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "settings/AdvancedSettings.h"
+#include "video/VideoDatabase.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+class TestVideoDatabase : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    DatabaseSettings settings;
+    settings.type = "sqlite3";
+    settings.host = CSpecialProtocol::TranslatePath("special://temp/");
+
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              m_database.Connect("TestVideoDatabase", settings, true));
+  }
+
+  void TearDown() override
+  {
+    m_database.Close();
+    XFILE::CFile::Delete("special://temp/TestVideoDatabase.db");
+  }
+
+  std::string GetPathHash(const std::string& path)
+  {
+    std::string hash;
+    EXPECT_TRUE(m_database.GetPathHash(path, hash));
+    return hash;
+  }
+
+  CVideoDatabase m_database;
+};
+
+TEST_F(TestVideoDatabase, SetPathHashes)
+{
+  EXPECT_TRUE(m_database.SetPathHashes({}));
+
+  ASSERT_TRUE(m_database.SetPathHash("/movies/first/", "old"));
+  ASSERT_TRUE(m_database.SetPathHashes({{"/movies/first/", "1"},
+                                        {"/movies/second/", "2"},
+                                        {"/movies/third/", "3"}}));
+
+  // known paths get the new hash, the others are added
+  EXPECT_EQ("1", GetPathHash("/movies/first/"));
+  EXPECT_EQ("2", GetPathHash("/movies/second/"));
+  EXPECT_EQ("3", GetPathHash("/movies/third/"));
+
+  // every batch is committed, the next one starts a transaction of its own
+  EXPECT_TRUE(m_database.SetPathHashes({{"/movies/second/", "4"}}));
+  EXPECT_EQ("4", GetPathHash("/movies/second/"));
+}
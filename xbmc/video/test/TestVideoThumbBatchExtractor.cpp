@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DatabaseManager.h"
+#include "ServiceBroker.h"
+#include "TextureCache.h"
+#include "imagefiles/ImageFileURL.h"
+#include "utils/JobManager.h"
+#include "video/VideoThumbBatchExtractor.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+using namespace std::chrono_literals;
+
+namespace
+{
+std::string GetImage(const std::string& file, int chapter = 0)
+{
+  IMAGE_FILES::CImageFileURL image = IMAGE_FILES::CImageFileURL::FromFile(file, "video");
+  if (chapter > 0)
+    image.AddOption("chapter", std::to_string(chapter));
+  return image.ToString();
+}
+} // namespace
+
+class TestVideoThumbBatchExtractor : public testing::Test
+{
+protected:
+  TestVideoThumbBatchExtractor()
+  {
+    CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+
+    // the texture cache only opens its database once the database manager has set it up
+    CServiceBroker::GetDatabaseManager().Initialize();
+    m_textureCache->Initialize();
+    CServiceBroker::RegisterTextureCache(m_textureCache);
+  }
+
+  ~TestVideoThumbBatchExtractor() override
+  {
+    CServiceBroker::UnregisterTextureCache();
+    m_textureCache->Deinitialize();
+
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::GetJobManager()->Restart();
+    CServiceBroker::UnregisterJobManager();
+  }
+
+  std::shared_ptr<CTextureCache> m_textureCache{std::make_shared<CTextureCache>()};
+};
+
+TEST_F(TestVideoThumbBatchExtractor, GroupsImagesByFile)
+{
+  CVideoThumbBatchExtractor extractor(2);
+  EXPECT_TRUE(extractor.IsEmpty());
+
+  EXPECT_TRUE(extractor.Add(GetImage("/movies/first.mkv")));
+  EXPECT_TRUE(extractor.Add(GetImage("/movies/first.mkv", 1)));
+  EXPECT_TRUE(extractor.Add(GetImage("/movies/first.mkv", 2)));
+  EXPECT_TRUE(extractor.Add(GetImage("/movies/second.mkv")));
+  EXPECT_FALSE(extractor.IsEmpty());
+  EXPECT_EQ(2u, extractor.GetFileCount());
+}
+
+TEST_F(TestVideoThumbBatchExtractor, IgnoresOtherImages)
+{
+  CVideoThumbBatchExtractor extractor(2);
+  EXPECT_FALSE(extractor.Add("/movies/first-poster.jpg"));
+  EXPECT_FALSE(extractor.Add(IMAGE_FILES::URLFromFile("/music/first.mp3", "music")));
+  EXPECT_TRUE(extractor.IsEmpty());
+}
+
+TEST_F(TestVideoThumbBatchExtractor, SkipsCachedImages)
+{
+  const std::string cached = GetImage("/movies/first.mkv");
+  CTextureDetails details;
+  details.file = "0/0123abcd.jpg";
+  details.width = 320;
+  details.height = 180;
+  ASSERT_TRUE(m_textureCache->AddCachedTexture(IMAGE_FILES::ToCacheKey(cached), details));
+
+  CVideoThumbBatchExtractor extractor(2);
+  EXPECT_TRUE(extractor.Add(cached));
+  EXPECT_TRUE(extractor.IsEmpty());
+
+  // the chapter previews of the same file aren't cached yet
+  EXPECT_TRUE(extractor.Add(GetImage("/movies/first.mkv", 1)));
+  EXPECT_EQ(1u, extractor.GetFileCount());
+}
+
+TEST_F(TestVideoThumbBatchExtractor, CountsFailedImages)
+{
+  CVideoThumbBatchExtractor extractor(2);
+  extractor.Add(GetImage("special://temp/missing/first.mkv"));
+  extractor.Add(GetImage("special://temp/missing/first.mkv", 1));
+  extractor.Add(GetImage("special://temp/missing/second.mkv"));
+
+  const bool stop = false;
+  const CVideoThumbBatchExtractor::Stats stats = extractor.Process(stop);
+  EXPECT_EQ(0u, stats.files);
+  EXPECT_EQ(0u, stats.images);
+  EXPECT_EQ(3u, stats.failed);
+  EXPECT_TRUE(extractor.IsEmpty());
+
+  // nothing is left to be done
+  const CVideoThumbBatchExtractor::Stats empty = extractor.Process(stop);
+  EXPECT_EQ(0u, empty.failed);
+  EXPECT_EQ(0ms, empty.duration);
+}
+
+TEST_F(TestVideoThumbBatchExtractor, Cancels)
+{
+  CVideoThumbBatchExtractor extractor(1);
+  for (int i = 0; i < 20; i++)
+    extractor.Add(GetImage("special://temp/missing/" + std::to_string(i) + ".mkv"));
+
+  // a stopped batch returns right away, whatever the jobs got to do isn't extracted
+  const bool stop = true;
+  const CVideoThumbBatchExtractor::Stats stats = extractor.Process(stop);
+  EXPECT_EQ(0u, stats.files);
+  EXPECT_EQ(0u, stats.images);
+  EXPECT_LE(stats.failed, 20u);
+  EXPECT_TRUE(extractor.IsEmpty());
+}
+
+TEST(TestVideoThumbBatchExtractorStats, FilesPerSecond)
+{
+  CVideoThumbBatchExtractor::Stats stats;
+  EXPECT_EQ(0.0, stats.GetFilesPerSecond());
+
+  stats.files = 10;
+  stats.duration = 2000ms;
+  EXPECT_DOUBLE_EQ(5.0, stats.GetFilesPerSecond());
+}
@@ -9,6 +9,7 @@
 #include "GUIWindowDebugInfo.h"
 
 #include "CompileInfo.h"
+#include "GUILargeTextureManager.h"
 #include "GUIInfoManager.h"
 #include "ServiceBroker.h"
 #include "addons/Skin.h"
@@ -129,6 +130,11 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetFPS(),
                                strCores, ucAppName, dCPU, profiling);
 #endif
+    const CGUILargeTextureManager::UploadStats textures =
+        CServiceBroker::GetGUI()->GetLargeTextureManager().GetUploadStats();
+    info += StringUtils::Format("\nTEX: {} loading, {} to upload - upload {:.1f} ms/frame",
+                                textures.loading, textures.pending,
+                                textures.lastFrame.count() / 1000.0);
   }
 
   // render the skin debug info